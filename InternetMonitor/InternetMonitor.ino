@@ -2,23 +2,29 @@
  * ESP32-S3 Internet Monitor - DUAL CORE OPTIMIZED
  * 
  * Core 0: LED effects (smooth 60fps, never blocks)
- * Core 1: Network operations (WiFi, HTTP checks, MQTT, web server)
+ * Core 1: Network operations (WiFi, HTTP checks, MQTT), web server task
  * 
  * Features:
  * - Dual-core architecture for smooth LED animations
- * - Multiple fallback check URLs
+ * - Event bus between tasks (no polling for state changes)
+ * - Runtime-configurable probe targets (weighted, quorum-based)
+ * - Packet loss / jitter bursts with a link quality score
+ * - Gateway and DNS probes to separate LAN, DNS and WAN outages
+ * - On-demand / scheduled throughput test
  * - Consecutive failure threshold
  * - Watchdog timer (auto-reboot on hang)
  * - Smooth fade transitions
  * - Multiple LED effects
  * - Password protected web UI
  * - OTA updates
- * - Uptime/downtime tracking
+ * - Uptime/downtime tracking with tiered check history
+ * - Outage journal on flash (survives reboots)
+ * - SNTP clock with drift tracking (UTC timestamps)
  * - MQTT publishing with Home Assistant auto-discovery
  * 
  * Architecture: Modular design with separate concerns
- * - core/       : Types, enums, state management
- * - storage/    : NVS persistence
+ * - core/       : Types, enums, state management, clock
+ * - storage/    : NVS persistence, check history, outage journal
  * - network/    : Connectivity checking
  * - mqtt/       : MQTT client, payloads, HA discovery
  * - web/        : HTTP server, auth, handlers
@@ -28,7 +34,6 @@
 
 #include <WiFi.h>
 #include <HTTPClient.h>
-#include <WebServer.h>
 #include <DNSServer.h>
 #include <Preferences.h>
 #include <ArduinoOTA.h>
@@ -39,18 +44,24 @@
 #include "config.h"
 #include "core/types.h"  // Enums and structs (must be early)
 #include "mqtt/mqtt_config.h"  // MQTT configuration struct
+#include "network/probe_config.h"  // Probe target list struct
+#include "network/throughput_config.h"  // Throughput test config/result structs
+#include "system/task_layout.h"  // Task core/priority layout struct
+#include "web/http_server.h"  // Non-blocking HTTP server (WebServer handler API)
 
 // ===========================================
 // GLOBAL INSTANCES
 // ===========================================
 
 Adafruit_NeoPixel pixels(NUM_LEDS, RGB_PIN, NEO_RGB + NEO_KHZ800);
-WebServer server(80);
+HttpServer server(HTTP_PORT);
 DNSServer dnsServer;
 Preferences preferences;
-HTTPClient httpClient;
-bool httpClientInitialized = false;
 MQTTConfig mqttConfig;  // MQTT configuration
+ProbeConfig probeConfig;  // Probe targets (loaded from NVS)
+ThroughputConfig throughputConfig;  // Bandwidth test settings (loaded from NVS)
+ThroughputResult throughputResult;  // Last bandwidth test
+TaskLayout taskLayout;  // Task cores/priorities (loaded from NVS)
 
 // ===========================================
 // TASK HANDLES
@@ -58,12 +69,22 @@ MQTTConfig mqttConfig;  // MQTT configuration
 
 TaskHandle_t ledTaskHandle = NULL;
 TaskHandle_t networkTaskHandle = NULL;
+TaskHandle_t webTaskHandle = NULL;  // HTTP server task
 
 // ===========================================
 // MUTEX FOR THREAD SAFETY
 // ===========================================
 
 portMUX_TYPE stateMux = portMUX_INITIALIZER_UNLOCKED;
+portMUX_TYPE probeMux = portMUX_INITIALIZER_UNLOCKED;
+portMUX_TYPE throughputMux = portMUX_INITIALIZER_UNLOCKED;
+portMUX_TYPE outageMux = portMUX_INITIALIZER_UNLOCKED;
+portMUX_TYPE clockMux = portMUX_INITIALIZER_UNLOCKED;
+portMUX_TYPE eventMux = portMUX_INITIALIZER_UNLOCKED;
+portMUX_TYPE renderMux = portMUX_INITIALIZER_UNLOCKED;
+portMUX_TYPE cpuMux = portMUX_INITIALIZER_UNLOCKED;
+portMUX_TYPE benchMux = portMUX_INITIALIZER_UNLOCKED;
+portMUX_TYPE histMux = portMUX_INITIALIZER_UNLOCKED;
 
 // ===========================================
 // LOOKUP TABLES
@@ -75,6 +96,8 @@ bool lutInitialized = false;
 // ===========================================
 // VOLATILE STATE (cross-core access)
 // ===========================================
+// Display settings are written on core 1 and reach the LED task as a
+// RenderParams snapshot (core/render_params.h), never read directly.
 
 volatile int currentState = STATE_BOOTING;
 volatile int currentEffect = EFFECT_RAIN;  // Default effect on boot
@@ -99,6 +122,8 @@ volatile bool ledTaskPaused = false;
 
 SystemStats stats;
 PerformanceMetrics perf;
+QualityMetrics quality;  // Loss/jitter from probe bursts
+SegmentStatus segment;   // Gateway / DNS reachability
 AuthState auth;
 
 // ===========================================
@@ -139,9 +164,12 @@ unsigned long lastSettingChangeTime = 0;
 
 // Storage
 #include "storage/nvs_manager.h"
+#include "storage/history.h"
+#include "storage/outage_log.h"
 
 // Network
 #include "network/connectivity.h"
+#include "network/throughput.h"
 
 // Web modules
 #include "web/auth.h"
@@ -153,6 +181,8 @@ unsigned long lastSettingChangeTime = 0;
 #include "system/watchdog.h"
 #include "system/ota.h"
 #include "system/tasks.h"
+#include "system/cpu_stats.h"
+#include "system/task_bench.h"
 
 // MQTT module (runs in its own task)
 #include "mqtt/mqtt_manager.h"
@@ -188,9 +218,31 @@ void setup() {
   
   // Load MQTT configuration from NVS
   loadMQTTConfigFromNVS();
+  
+  // Load probe targets from NVS (defaults from config.h)
+  loadProbeConfigFromNVS();
+  
+  // Load throughput test settings from NVS
+  loadThroughputConfigFromNVS();
+  
+  // Load NTP server from NVS
+  loadClockConfigFromNVS();
+
+  // Load the /metrics scrape token from NVS
+  loadMetricsConfigFromNVS();
+
+  // Load task cores/priorities from NVS
+  loadTaskLayoutFromNVS();
 
-  // Apply loaded brightness
+  // History lock (the network task records, /history reads)
+  initHistory();
+
+  // Mount LittleFS and open the outage journal
+  initOutageLog();
+
+  // Apply loaded brightness and hand the settings to the LED task
   pixels.setBrightness(currentBrightness);
+  publishRenderParams();
   fillMatrixImmediate(COLOR_BOOTING_R, COLOR_BOOTING_G, COLOR_BOOTING_B);
 
   changeState(STATE_BOOTING);
@@ -198,7 +250,7 @@ void setup() {
   // Setup watchdog
   setupWatchdog();
 
-  // Start LED task on Core 0 (runs independently for smooth animation)
+  // Start LED task (Core 0 by default, runs independently for smooth animation)
   startLEDTask();
 
   // Try to load credentials from NVS
@@ -249,13 +301,17 @@ void setup() {
 
     setupWebServer();
     setupOTA();
+    startClockSync();
     changeState(STATE_INTERNET_OK);
     
-    // Start network monitoring task on Core 1
+    // Start network monitoring task (Core 1 by default)
     startNetworkTask();
     
-    // Start MQTT task on Core 1 (runs independently, won't block network checks)
+    // Start MQTT task (Core 1 by default, won't block network checks)
     startMqttTask();
+    
+    // Start throughput test task on Core 1 (idle priority, on demand/scheduled)
+    startThroughputTask();
   } else {
     Serial.println("\nWiFi connection failed - entering config mode");
     enterConfigMode();
@@ -263,18 +319,20 @@ void setup() {
   }
 
   Serial.println("Setup complete!\n");
-  Serial.println("Architecture:");
-  Serial.println("  Core 0: LED effects @ 60fps");
-  Serial.println("  Core 1: Network monitoring (independent task)");
-  Serial.println("  Core 1: MQTT publishing (independent task)");
-  Serial.println("  Main:   Web server + OTA");
+  Serial.printf("Architecture (layout \"%s\"):\n", taskLayoutName(activeLayout));
+  Serial.printf("  Core %u: LED effects @ 60fps\n", activeLayout.ledCore);
+  Serial.printf("  Core %u: Network monitoring (independent task)\n", activeLayout.netCore);
+  Serial.printf("  Core %u: MQTT publishing (independent task)\n", activeLayout.mqttCore);
+  Serial.println("  Core 1: Throughput test (idle priority task)");
+  Serial.printf("  Core %d: Web server (independent task)\n", ARDUINO_RUNNING_CORE);
+  Serial.println("  Main:   OTA");
   if (mqttConfig.enabled) {
     Serial.println("  MQTT:   " + String(mqttConfig.broker) + ":" + String(mqttConfig.port));
   }
 }
 
 // ===========================================
-// MAIN LOOP (Core 1 - handles web server)
+// MAIN LOOP (Core 1 - OTA, portal DNS)
 // ===========================================
 
 void loop() {
@@ -283,10 +341,12 @@ void loop() {
   // Check for hardware factory reset (BOOT button held for 5 seconds)
   checkBootButtonFactoryReset();
 
+  // Print state transitions queued by changeState()
+  serviceStateLog();
+
   // Handle config portal mode
   if (configPortalActive) {
     dnsServer.processNextRequest();
-    server.handleClient();
 
     // Check for portal timeout (10 min inactivity)
     if (millis() - lastPortalActivity > CONFIG_PORTAL_TIMEOUT) {
@@ -299,14 +359,11 @@ void loop() {
     return;  // Skip normal operation
   }
 
-  // Save settings to NVS if needed (debounced)
-  saveSettingsToNVSIfNeeded();
-
   // Handle OTA updates
   ArduinoOTA.handle();
   
-  // Handle web server requests
-  server.handleClient();
+  // Web requests, settings saves, /events and CPU sampling run in the
+  // web task (server.h)
 
   // Small delay to prevent tight loop
   delay(5);
@@ -78,15 +78,33 @@ const char* FW_VERSION    = "0.7.1";
 #define NVS_KEY_MQTT_INTERVAL "mqtt_int"
 #define NVS_KEY_MQTT_HA_DISC  "mqtt_ha"
 
+// Probe target NVS Keys
+#define NVS_KEY_PROBES        "probes"       // ProbeConfig blob
+
+// Throughput test NVS Keys
+#define NVS_KEY_THROUGHPUT    "tput"         // ThroughputConfig blob
+
+// Clock NVS Keys
+#define NVS_KEY_NTP_SERVER    "ntp"          // Primary NTP server
+
+// Task layout NVS Keys
+#define NVS_KEY_TASK_LAYOUT   "tasks"        // TaskLayout blob
+
+// Prometheus NVS Keys
+#define NVS_KEY_METRICS_TOKEN "metrics_tok"  // /metrics scrape token ("" = open)
+
 // ===========================================
 // MQTT DEFAULTS
 // ===========================================
 #define MQTT_DEFAULT_PORT           1883
 #define MQTT_DEFAULT_INTERVAL_MS    30000    // 30 seconds
 #define MQTT_DEFAULT_TOPIC          "internet_monitor"
-#define MQTT_RECONNECT_INTERVAL_MS  10000    // 10 seconds between reconnect attempts
+#define MQTT_RECONNECT_INTERVAL_MS  10000    // First retry delay, doubles per failure
+#define MQTT_RECONNECT_MAX_MS       300000   // Backoff cap (5 minutes)
+#define MQTT_STARTUP_SPREAD_MS      15000    // First connect after boot spread over 15 s
 #define MQTT_KEEPALIVE_SEC          60       // MQTT keepalive
-#define MQTT_BUFFER_SIZE            768      // Message buffer size (HA discovery needs ~600)
+#define MQTT_BUFFER_SIZE            1024     // Message buffer size (state payload ~700)
+#define MQTT_PAYLOAD_MAX            896      // State payload buffer (fits MQTT_BUFFER_SIZE with the topic)
 
 // ===========================================
 // DEFAULT SETTINGS (used on first boot / factory reset)
@@ -126,6 +144,14 @@ const char* FW_VERSION    = "0.7.1";
 #define COLOR_DOWN_G          20
 #define COLOR_DOWN_B          0
 
+#define COLOR_ROUTER_R        100
+#define COLOR_ROUTER_G        0
+#define COLOR_ROUTER_B        30
+
+#define COLOR_DNS_R           90
+#define COLOR_DNS_G           0
+#define COLOR_DNS_B           90
+
 // ===========================================
 // EFFECT PARAMETERS
 // ===========================================
@@ -160,7 +186,202 @@ const char* FW_VERSION    = "0.7.1";
 #define FAST_SQRT_MAGIC       0x5f3759df  // Quake III fast inverse sqrt
 
 // ===========================================
-// CHECK URLs (multiple for redundancy)
+// PROBE TARGETS
+// ===========================================
+// The live target list is stored in NVS and editable via /probes.
+// checkUrls[] below seeds it on first boot and after a reset.
+#define MAX_PROBE_TARGETS       8       // Fixed-size table in ProbeConfig
+#define PROBE_URL_MAX_LEN       96      // URL (HTTP) or host:port (TCP)
+#define PROBE_DEFAULT_TIMEOUT   3000    // Per-target timeout (ms)
+#define PROBE_DEFAULT_WEIGHT    1       // Relative share of probes (1-10)
+#define PROBE_MAX_WEIGHT        10
+#define PROBE_DEFAULT_QUORUM    1       // Successful targets needed per check
+#define PROBE_DEFAULT_ATTEMPTS  2       // Max targets tried per check
+#define PROBE_POOL_SIZE         4       // Keep-alive connections held open (LRU)
+#define PROBE_POOL_IDLE_MS      55000   // Reconnect instead of reusing after this idle time
+#define PROBE_POOL_DRAIN_MAX    4096    // Larger (or unsized) bodies close the socket instead
+
+// ===========================================
+// PROBE SCHEDULING (many units, same targets)
+// ===========================================
+// Checks start at a MAC-derived phase and each interval is jittered, so
+// units powered up together don't probe in lockstep. A token bucket caps
+// target probes per minute (HTTP/TCP only; bursts and segment probes
+// aren't counted).
+#define CHECK_JITTER_PCT        10      // Each interval is CHECK_INTERVAL ±10%
+#define PROBE_RATE_PER_MIN      12      // Sustained target probes per minute
+#define PROBE_BUCKET_SIZE       MAX_PROBE_TARGETS  // Burst allowance, one full check always fits
+
+// ===========================================
+// PROBE BURSTS (packet loss / jitter)
+// ===========================================
+// A burst is N small ICMP echoes at fixed spacing. Loss, mean RTT and
+// RFC 3550 jitter feed a 0-100 quality score; a low score shows as
+// DEGRADED even while the HTTP/TCP checks still pass.
+#define BURST_HOST_MAX_LEN      64
+#define BURST_DEFAULT_ENABLED   true
+#define BURST_DEFAULT_HOST      "1.1.1.1"
+#define BURST_DEFAULT_COUNT     50      // Probes per burst (2% loss resolution)
+#define BURST_DEFAULT_INTERVAL  50      // ms between probes
+#define BURST_DEFAULT_EVERY     3       // Burst after every Nth passing check
+#define BURST_TIMEOUT_MS        500     // Reply timeout per probe
+#define BURST_PAYLOAD_SIZE      32      // ICMP payload bytes
+
+// Quality score = 100 minus penalties (clamped 0-100)
+#define QUALITY_LOSS_PENALTY    8       // Points per 1% loss
+#define QUALITY_JITTER_FREE_MS  10      // Jitter below this is free
+#define QUALITY_JITTER_PENALTY  1       // Points per ms of jitter above that
+#define QUALITY_RTT_FREE_MS     150     // Mean RTT below this is free
+#define QUALITY_RTT_PENALTY_MS  10      // One point per this many ms above that
+#define QUALITY_DEGRADED_BELOW  80      // Score that triggers DEGRADED (3%+ loss)
+#define QUALITY_RECOVER_AT      85      // Score needed to clear it (hysteresis)
+
+// ===========================================
+// SEGMENT PROBES (LAN vs WAN fault isolation)
+// ===========================================
+// Run in parallel with every check to tell router, DNS and upstream
+// faults apart.
+#define GATEWAY_PING_COUNT      3       // Echoes per check (gateway and WAN IP)
+#define GATEWAY_PING_INTERVAL   200     // ms between echoes
+#define GATEWAY_PING_TIMEOUT    500     // Reply timeout per echo
+#define SEGMENT_WAN_IP          "1.1.1.1"         // IP literal, reachable without DNS
+#define DNS_PROBE_HOST          "www.google.com"  // Name queried at the resolver
+#define DNS_PROBE_TIMEOUT_MS    2000    // From send, not from collect
+
+// ===========================================
+// THROUGHPUT TEST
+// ===========================================
+// Optional bandwidth test, runs in its own low-priority task on demand
+// (/throughput/run) or every intervalMin minutes when scheduled.
+// tools/throughput_server.py serves both endpoints for local testing.
+#define THROUGHPUT_URL_MAX_LEN      128
+#define THROUGHPUT_DEFAULT_DOWN_URL "http://speedtest.tele2.net/10MB.zip"
+#define THROUGHPUT_DEFAULT_UP_URL   "http://speedtest.tele2.net/upload.php"
+#define THROUGHPUT_DEFAULT_SIZE     (5UL * 1024 * 1024)    // Bytes per direction
+#define THROUGHPUT_MAX_SIZE         (100UL * 1024 * 1024)
+#define THROUGHPUT_DEFAULT_INTERVAL 360     // Minutes between scheduled runs
+#define THROUGHPUT_BUFFER_SIZE      4096    // Static scratch buffer (bytes)
+#define THROUGHPUT_IDLE_TIMEOUT_MS  5000    // Abort if no data moves for this long
+
+// ===========================================
+// CHECK HISTORY (in-RAM time series)
+// ===========================================
+// Every check lands in a raw ring and is folded into 1-minute, 1-hour and
+// 1-day buckets as it arrives. Fixed memory (~16 KB), lost on reboot.
+#define HISTORY_RAW_SLOTS       720     // 4 B each: 2 h at CHECK_INTERVAL
+#define HISTORY_MINUTE_SLOTS    1440    // 8 B each: 24 h
+#define HISTORY_HOUR_SLOTS      168     // 8 B each: 7 days
+#define HISTORY_DAY_SLOTS       90      // 8 B each: 90 days
+#define HISTORY_MAX_POINTS      360     // Per /history response (buckets merged to fit)
+
+// ===========================================
+// EVENT BUS
+// ===========================================
+// Typed events from changeState() and the network task, one ring per
+// consumer (LED task, MQTT task, web). Consumers sleep instead of polling.
+#define EVENT_RING_SIZE         16      // Events queued per consumer (12 B each)
+#define EVENT_LOG_SIZE          32      // Recent events kept for GET /events
+#define NET_IDLE_WAKE_MS        1000    // Network task max sleep between checks
+#define MQTT_IDLE_WAKE_MS       1000    // MQTT task max sleep (keepalive, reconnect)
+
+// ===========================================
+// CPU STATS
+// ===========================================
+// Per-task / per-core load from FreeRTOS run time counters, sampled from
+// the web task. Rolling average over CPU_WINDOW_SAMPLES intervals (1 min).
+#define CPU_SAMPLE_MS           5000    // Interval between samples
+#define CPU_WINDOW_SAMPLES      12      // Intervals in the rolling window
+#define CPU_MAX_TASKS           24      // Tasks tracked (IDF + ours)
+
+// ===========================================
+// WEB SERVER
+// ===========================================
+// Non-blocking HTTP server in its own task (web/http_server.h). Requests
+// are read and responses drained per connection, so a slow client only
+// delays itself; handlers still run one at a time.
+#define HTTP_PORT               80
+#define HTTP_MAX_CLIENTS        4       // Concurrent connections (more wait in the backlog)
+#define HTTP_REQUEST_MAX        3072    // Request line + headers + body
+#define HTTP_MAX_ARGS           16      // Query/form arguments per request
+#define HTTP_MAX_HEADERS        24      // Request headers kept per request
+#define HTTP_MAX_ROUTES         48      // server.on() registrations
+#define HTTP_OUT_CHUNK          1436    // Output block size (one TCP segment)
+#define HTTP_OUT_POOL           12      // Drained blocks kept for reuse (~17 KB)
+#define HTTP_OUT_MAX            16384   // Copied bytes queued per connection before the handler waits
+#define HTTP_FLUSH_WAIT_MS      200     // Most a handler waits on one slow client (stalls the web task)
+#define HTTP_IDLE_TIMEOUT_MS    10000   // Drop a connection with no progress for this long
+#define HTTP_POLL_MS            20      // select() timeout per web task cycle
+#define HTTP_LATENCY_SAMPLES    64      // Recent requests kept for percentiles
+#define HTTP_TASK_STACK         8192    // Same as the Arduino loop task
+#define TEMPLATE_CHUNK          1436    // Page render buffer (one TCP segment)
+#define TEMPLATE_SCRATCH        160     // printf() buffer for one placeholder value
+#define TEMPLATE_KEY_MAX        24      // Longest {{key}} + 1
+#define JSON_CHUNK              512     // JSON response writer buffer (/stats, /api/dashboard)
+
+// ===========================================
+// LIVE STATS (SERVER-SENT EVENTS)
+// ===========================================
+// GET /api/live keeps a connection open and pushes the /stats fields that
+// changed (web/live_stats.h); the dashboard falls back to polling /stats.
+#define HTTP_MAX_STREAMS        2       // Open event streams (of HTTP_MAX_CLIENTS)
+#define HTTP_STREAM_MAX         4096    // Unsent bytes before a stalled stream is dropped
+#define LIVE_INTERVAL_MS        1000    // Change check / push period
+#define LIVE_SLOW_INTERVAL_MS   5000    // "cpu" and "http" (change on nearly every check)
+#define LIVE_KEEPALIVE_MS       15000   // Comment line when nothing changed
+#define LIVE_RETRY_MS           3000    // Browser reconnect delay after a drop
+#define LIVE_JSON_MAX           4096    // Whole stats object, kept to cut changed fields from
+
+// ===========================================
+// PROMETHEUS METRICS
+// ===========================================
+// GET /metrics in the text exposition format (web/metrics_handlers.h),
+// streamed through the template writer. Open unless a token is set.
+#define METRICS_TOKEN_MIN       16
+#define METRICS_TOKEN_MAX       64
+#define HIST_MAX_BOUNDS         12      // Buckets per histogram, +Inf not counted
+#define PROBE_RTT_BOUNDS_MS     {10, 25, 50, 100, 250, 500, 1000, 2500, 5000}
+#define LED_FRAME_BOUNDS_US     {500, 1000, 2000, 4000, 8000, 16000, 33000}
+
+// ===========================================
+// TASK LAYOUT BENCHMARK
+// ===========================================
+// Core/priority of the LED, network, MQTT and web tasks come from the
+// saved TaskLayout (/tasks). The benchmark applies each preset in turn and
+// runs a fixed workload: probes on the network task's core/priority and
+// HTTP requests to the device's own web server, while the LED task's
+// frame jitter is recorded. Normal checks pause while it runs.
+#define TASK_PRIORITY_MAX       5       // Stay below the IDF WiFi/lwIP tasks
+#define BENCH_SETTLE_MS         3000    // After applying a layout
+#define BENCH_PROBES            4       // Per layout (drawn from the probe rate limit)
+#define BENCH_HTTP_REQUESTS     20      // Per layout, GET / on the local web server
+#define BENCH_HTTP_TIMEOUT_MS   2000
+#define BENCH_HOLD_TIMEOUT_MS   30000   // Wait for a running check to finish
+
+// ===========================================
+// CLOCK (SNTP)
+// ===========================================
+// Timestamps are kept on the 64-bit monotonic clock and converted to UTC
+// once SNTP has synced. Between syncs the measured drift is applied.
+#define NTP_SERVER_MAX_LEN      64
+#define NTP_DEFAULT_SERVER      "pool.ntp.org"      // Overridable via /time
+#define NTP_FALLBACK_SERVER     "time.google.com"   // Used when the primary fails
+#define NTP_SYNC_INTERVAL_MS    3600000 // Re-sync every hour
+#define NTP_STALE_MS            21600000 // No sync for 6 h: report holdover
+#define NTP_DRIFT_MIN_MS        600000  // Min time between syncs to measure drift
+#define NTP_MAX_DRIFT_PPM       500     // Larger jumps are clock steps, not drift
+
+// ===========================================
+// OUTAGE LOG (LittleFS)
+// ===========================================
+// Finished outages are journaled to flash in 24-byte CRC records.
+// Two segment files bound the size; the older one is dropped on rotation.
+#define OUTAGE_LOG_SEGMENT_RECORDS  256     // Per segment file (6 KB)
+#define OUTAGE_LOG_BATCH            8       // Write once this many are queued...
+#define OUTAGE_LOG_FLUSH_MS         300000  // ...or the oldest has waited 5 min
+#define OUTAGE_LOG_PAGE_MAX         50      // Max records per /outages page
+
+// ===========================================
+// CHECK URLs (default probe targets)
 // ===========================================
 const char* checkUrls[] = {
   "http://clients3.google.com/generate_204",
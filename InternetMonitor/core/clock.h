@@ -0,0 +1,217 @@
+#ifndef CORE_CLOCK_H
+#define CORE_CLOCK_H
+
+/**
+ * @file clock.h
+ * @brief Monotonic + UTC clock service (SNTP)
+ *
+ * Everything is timestamped on the 64-bit monotonic clock (esp_timer,
+ * never wraps or jumps). UTC is derived on demand as
+ *
+ *   utc = mono + offset + (mono - lastSync) * drift
+ *
+ * where offset is UTC minus monotonic at the last SNTP sync and drift is
+ * the measured rate difference between the local oscillator and NTP.
+ * Between syncs, and if the servers go away, the clock keeps running on
+ * the drift estimate (holdover). Before the first sync there is no UTC
+ * and callers fall back to uptime.
+ *
+ * Because events keep their monotonic time, anything recorded before the
+ * first sync still converts to UTC later (clockUtcAt()).
+ */
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_sntp.h>
+#include <time.h>
+#include "../config.h"
+
+// ===========================================
+// CLOCK STATE
+// ===========================================
+
+struct ClockStatus {
+  bool synced = false;          // At least one SNTP sync since boot
+  int64_t offsetMs = 0;         // UTC minus monotonic at the last sync
+  uint64_t lastSyncMono = 0;    // Monotonic ms of the last sync
+  float driftPpm = 0.0f;        // + = local clock runs slow
+  int32_t lastErrorMs = 0;      // Prediction error corrected at the last sync
+  uint32_t syncs = 0;
+};
+
+extern portMUX_TYPE clockMux;
+extern Preferences preferences;
+
+static ClockStatus clockStatus;
+
+// lwIP keeps the pointer, so the name must stay valid
+static char ntpServer[NTP_SERVER_MAX_LEN] = NTP_DEFAULT_SERVER;
+
+// ===========================================
+// READING THE CLOCK
+// ===========================================
+
+/**
+ * Milliseconds since boot (64-bit, monotonic)
+ */
+inline uint64_t clockMonoMs() {
+  return (uint64_t)(esp_timer_get_time() / 1000);
+}
+
+/**
+ * Seconds since boot
+ */
+inline uint32_t clockUptimeSec() {
+  return (uint32_t)(clockMonoMs() / 1000);
+}
+
+inline bool clockSynced() {
+  return clockStatus.synced;
+}
+
+/**
+ * Copy the sync state (the 64-bit fields can't be read unlocked)
+ */
+inline ClockStatus clockSnapshot() {
+  portENTER_CRITICAL(&clockMux);
+  ClockStatus c = clockStatus;
+  portEXIT_CRITICAL(&clockMux);
+  return c;
+}
+
+/**
+ * Convert a monotonic timestamp to UTC
+ * @param monoMs Monotonic ms (clockMonoMs())
+ * @return Unix ms, or 0 before the first sync
+ */
+inline uint64_t clockUtcAtMs(uint64_t monoMs) {
+  ClockStatus c = clockSnapshot();
+  if (!c.synced) return 0;
+  int64_t sinceSync = (int64_t)monoMs - (int64_t)c.lastSyncMono;
+  return (uint64_t)((int64_t)monoMs + c.offsetMs + (int64_t)(sinceSync * (c.driftPpm / 1e6f)));
+}
+
+/**
+ * Convert a monotonic timestamp to Unix seconds (0 before the first sync)
+ */
+inline uint32_t clockUtcAt(uint64_t monoMs) {
+  return (uint32_t)(clockUtcAtMs(monoMs) / 1000);
+}
+
+/**
+ * Current Unix time in seconds (0 before the first sync)
+ */
+inline uint32_t clockUtcSec() {
+  return clockUtcAt(clockMonoMs());
+}
+
+/**
+ * Format Unix seconds as ISO 8601 UTC ("2024-05-01T12:00:00Z")
+ * @param unixSec Unix time
+ * @param buf Destination (at least 21 bytes)
+ * @param len Size of buf
+ */
+inline void clockFormatIso(uint32_t unixSec, char* buf, size_t len) {
+  time_t t = unixSec;
+  struct tm tm;
+  gmtime_r(&t, &tm);
+  strftime(buf, len, "%Y-%m-%dT%H:%M:%SZ", &tm);
+}
+
+/**
+ * Short clock state for APIs: "unsynced", "synced" or "holdover"
+ */
+inline const char* clockStateText() {
+  ClockStatus c = clockSnapshot();
+  if (!c.synced) return "unsynced";
+  return (clockMonoMs() - c.lastSyncMono > NTP_STALE_MS) ? "holdover" : "synced";
+}
+
+// ===========================================
+// SNTP
+// ===========================================
+
+/**
+ * SNTP sync callback (runs in the lwIP task)
+ * Measures how far the local clock wandered since the last sync and
+ * folds that into the drift estimate.
+ */
+inline void onClockSync(struct timeval* tv) {
+  uint64_t mono = clockMonoMs();
+  int64_t utcMs = (int64_t)tv->tv_sec * 1000 + tv->tv_usec / 1000;
+  int64_t offset = utcMs - (int64_t)mono;
+
+  uint64_t predicted = clockUtcAtMs(mono);
+
+  portENTER_CRITICAL(&clockMux);
+  ClockStatus& c = clockStatus;
+  if (c.synced) {
+    c.lastErrorMs = (int32_t)(utcMs - (int64_t)predicted);
+    uint64_t interval = mono - c.lastSyncMono;
+    if (interval >= NTP_DRIFT_MIN_MS) {
+      float measured = (float)(offset - c.offsetMs) * 1e6f / (float)interval;
+      if (fabsf(measured) <= NTP_MAX_DRIFT_PPM) {
+        c.driftPpm = (c.syncs < 2) ? measured : c.driftPpm * 0.75f + measured * 0.25f;
+      }
+    }
+  }
+  c.offsetMs = offset;
+  c.lastSyncMono = mono;
+  c.synced = true;
+  c.syncs++;
+  int32_t errorMs = c.lastErrorMs;
+  float driftPpm = c.driftPpm;
+  portEXIT_CRITICAL(&clockMux);
+
+  char iso[24];
+  clockFormatIso(tv->tv_sec, iso, sizeof(iso));
+  Serial.printf("[Clock] SNTP sync %s (error %ld ms, drift %.1f ppm)\n",
+    iso, (long)errorMs, driftPpm);
+}
+
+/**
+ * (Re)start SNTP with the primary server and the fallback
+ * lwIP switches to the fallback when the primary doesn't answer.
+ */
+inline void startClockSync() {
+  if (esp_sntp_enabled()) {
+    esp_sntp_stop();
+  }
+  esp_sntp_setoperatingmode(ESP_SNTP_OPMODE_POLL);
+  esp_sntp_setservername(0, ntpServer);
+  esp_sntp_setservername(1, NTP_FALLBACK_SERVER);
+  sntp_set_time_sync_notification_cb(onClockSync);
+  sntp_set_sync_interval(NTP_SYNC_INTERVAL_MS);
+  esp_sntp_init();
+  Serial.printf("[Clock] SNTP started (%s, fallback %s)\n", ntpServer, NTP_FALLBACK_SERVER);
+}
+
+// ===========================================
+// NVS PERSISTENCE
+// ===========================================
+
+inline void loadClockConfigFromNVS() {
+  preferences.begin(NVS_NAMESPACE, true);  // read-only
+  String server = preferences.getString(NVS_KEY_NTP_SERVER, NTP_DEFAULT_SERVER);
+  preferences.end();
+  strlcpy(ntpServer, server.c_str(), sizeof(ntpServer));
+}
+
+/**
+ * Change the primary NTP server, persist it and restart SNTP
+ * @param server Host name or IP (validated by the caller)
+ */
+inline void setClockServer(const char* server) {
+  if (esp_sntp_enabled()) {
+    esp_sntp_stop();  // Before touching the name lwIP points at
+  }
+  strlcpy(ntpServer, server, sizeof(ntpServer));
+
+  preferences.begin(NVS_NAMESPACE, false);  // read-write
+  preferences.putString(NVS_KEY_NTP_SERVER, ntpServer);
+  preferences.end();
+
+  startClockSync();
+}
+
+#endif // CORE_CLOCK_H
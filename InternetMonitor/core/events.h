@@ -0,0 +1,139 @@
+#ifndef CORE_EVENTS_H
+#define CORE_EVENTS_H
+
+/**
+ * @file events.h
+ * @brief Event bus between tasks (state changes, check results)
+ *
+ * Producers (changeState(), the network and throughput tasks) publish
+ * small typed events. Every consumer has its own fixed ring, so a slow
+ * consumer never holds up the others:
+ *
+ * - EVENT_SUB_LED:  drained every frame by the LED task (state colors)
+ * - EVENT_SUB_MQTT: MQTT task sleeps on its task notification and is
+ *                   woken by each event, publishing state changes at once
+ * - EVENT_SUB_WEB:  drained by the web task into the /events log
+ * - EVENT_SUB_LOG:  drained by loop() to print state transitions
+ *
+ * Rings are statically allocated and exist from boot, so events published
+ * before a consumer task starts are queued, not lost. A full ring drops
+ * its oldest event and counts it.
+ */
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "../config.h"
+
+// ===========================================
+// EVENT TYPES
+// ===========================================
+
+enum EventType : uint8_t {
+  EVENT_STATE = 0,      // a = old state, b = new state
+  EVENT_CHECK,          // a = passed, value = check ms
+  EVENT_QUALITY,        // a = degraded, value = score (after a burst)
+  EVENT_THROUGHPUT      // a = ok, value = download kbit/s
+};
+
+struct Event {
+  uint8_t type;         // EventType
+  uint8_t a;
+  uint8_t b;
+  uint8_t reserved;
+  uint32_t value;
+  uint32_t ms;          // millis() when published
+};
+
+enum EventSubscriber : uint8_t {
+  EVENT_SUB_LED = 0,
+  EVENT_SUB_MQTT,
+  EVENT_SUB_WEB,
+  EVENT_SUB_LOG,
+  EVENT_SUB_COUNT
+};
+
+// ===========================================
+// PER-CONSUMER RINGS
+// ===========================================
+
+struct EventRing {
+  Event slots[EVENT_RING_SIZE];
+  uint8_t head = 0;               // Next write
+  uint8_t count = 0;
+  uint32_t dropped = 0;           // Overwritten before being read
+  TaskHandle_t notify = NULL;     // Woken on publish (optional)
+};
+
+extern portMUX_TYPE eventMux;
+
+static EventRing eventRings[EVENT_SUB_COUNT];
+
+/**
+ * Publish an event to every consumer
+ * Safe from any task. Holds eventMux only to copy 12 bytes per ring;
+ * consumers are notified after it is released.
+ */
+inline void publishEvent(EventType type, uint8_t a, uint8_t b = 0, uint32_t value = 0) {
+  Event ev = { (uint8_t)type, a, b, 0, value, (uint32_t)millis() };
+  TaskHandle_t wake[EVENT_SUB_COUNT];
+
+  portENTER_CRITICAL(&eventMux);
+  for (int i = 0; i < EVENT_SUB_COUNT; i++) {
+    EventRing& r = eventRings[i];
+    r.slots[r.head] = ev;
+    r.head = (r.head + 1) % EVENT_RING_SIZE;
+    if (r.count < EVENT_RING_SIZE) {
+      r.count++;
+    } else {
+      r.dropped++;  // Oldest overwritten
+    }
+    wake[i] = r.notify;
+  }
+  portEXIT_CRITICAL(&eventMux);
+
+  for (int i = 0; i < EVENT_SUB_COUNT; i++) {
+    if (wake[i]) xTaskNotifyGive(wake[i]);
+  }
+}
+
+/**
+ * Take the oldest event for a consumer
+ * @param sub Consumer
+ * @param out Event
+ * @return false if the ring is empty
+ */
+inline bool pollEvent(EventSubscriber sub, Event& out) {
+  bool got = false;
+  portENTER_CRITICAL(&eventMux);
+  EventRing& r = eventRings[sub];
+  if (r.count > 0) {
+    out = r.slots[(r.head + EVENT_RING_SIZE - r.count) % EVENT_RING_SIZE];
+    r.count--;
+    got = true;
+  }
+  portEXIT_CRITICAL(&eventMux);
+  return got;
+}
+
+/**
+ * Wake a task on every event for this consumer (NULL to stop)
+ * The task then blocks in ulTaskNotifyTake() instead of polling.
+ */
+inline void eventBindTask(EventSubscriber sub, TaskHandle_t task) {
+  portENTER_CRITICAL(&eventMux);
+  eventRings[sub].notify = task;
+  portEXIT_CRITICAL(&eventMux);
+}
+
+inline const char* eventTypeName(uint8_t type) {
+  switch (type) {
+    case EVENT_STATE:      return "state";
+    case EVENT_CHECK:      return "check";
+    case EVENT_QUALITY:    return "quality";
+    case EVENT_THROUGHPUT: return "throughput";
+    default:               return "unknown";
+  }
+}
+
+#endif // CORE_EVENTS_H
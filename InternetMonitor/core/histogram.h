@@ -0,0 +1,76 @@
+#ifndef CORE_HISTOGRAM_H
+#define CORE_HISTOGRAM_H
+
+/**
+ * @file histogram.h
+ * @brief Fixed-bucket latency histograms (probe RTT, LED frame time)
+ *
+ * Each histogram counts samples per bucket plus their sum, like a
+ * Prometheus histogram; /metrics exposes them cumulatively. Bounds are in
+ * the recorder's own unit (ms, us) and fixed at compile time.
+ *
+ * Recorders run on the LED and network tasks; histObserve() and
+ * histSnapshot() take histMux so a reader never sees the sum and the
+ * counts from different samples.
+ */
+
+#include <Arduino.h>
+#include "../config.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern portMUX_TYPE histMux;
+
+// ===========================================
+// HISTOGRAM
+// ===========================================
+
+struct Histogram {
+  const uint32_t* bounds;                   // Upper bounds, ascending
+  uint8_t boundCount;
+  uint32_t counts[HIST_MAX_BOUNDS + 1];     // Per bucket; the last is above every bound
+  uint64_t sum;
+  uint32_t count;
+};
+
+static const uint32_t probeRttBoundsMs[] = PROBE_RTT_BOUNDS_MS;
+static const uint32_t ledFrameBoundsUs[] = LED_FRAME_BOUNDS_US;
+
+#define HIST_BOUND_COUNT(b) (sizeof(b) / sizeof(b[0]))
+#define HIST_BOUNDS(b) b, (uint8_t)HIST_BOUND_COUNT(b)
+
+// histObserve() indexes counts[] by bound; a longer list would overrun it
+static_assert(HIST_BOUND_COUNT(probeRttBoundsMs) <= HIST_MAX_BOUNDS,
+  "PROBE_RTT_BOUNDS_MS has more than HIST_MAX_BOUNDS entries");
+static_assert(HIST_BOUND_COUNT(ledFrameBoundsUs) <= HIST_MAX_BOUNDS,
+  "LED_FRAME_BOUNDS_US has more than HIST_MAX_BOUNDS entries");
+
+static Histogram probeRttHist = {HIST_BOUNDS(probeRttBoundsMs), {}, 0, 0};  // Passed check targets, ms
+static Histogram ledFrameHist = {HIST_BOUNDS(ledFrameBoundsUs), {}, 0, 0};  // LED render time, us
+
+/**
+ * Record one sample
+ */
+inline void histObserve(Histogram& h, uint32_t value) {
+  uint8_t i = 0;
+  while (i < h.boundCount && value > h.bounds[i]) i++;
+
+  portENTER_CRITICAL(&histMux);
+  h.counts[i]++;
+  h.sum += value;
+  h.count++;
+  portEXIT_CRITICAL(&histMux);
+}
+
+/**
+ * Copy a histogram for reading from another task
+ */
+inline void histSnapshot(const Histogram& h, Histogram& out) {
+  portENTER_CRITICAL(&histMux);
+  out = h;
+  portEXIT_CRITICAL(&histMux);
+}
+
+#endif // CORE_HISTOGRAM_H
@@ -0,0 +1,75 @@
+#ifndef CORE_JITTER_H
+#define CORE_JITTER_H
+
+/**
+ * @file jitter.h
+ * @brief Per-device deterministic jitter (seeded from the MAC)
+ *
+ * Units that power up together after an outage would otherwise run the
+ * same timers in lockstep. Seeding from the factory MAC gives every unit
+ * its own, repeatable sequence: the same device always picks the same
+ * offsets, different devices spread evenly across the range.
+ *
+ * Each caller keeps its own 32-bit state (one per task), so no locking.
+ */
+
+#include <Arduino.h>
+
+/**
+ * 32-bit hash of the factory MAC (stable across reboots and resets)
+ */
+inline uint32_t deviceSeed() {
+  uint64_t mac = ESP.getEfuseMac();
+  uint32_t h = (uint32_t)mac ^ (uint32_t)(mac >> 32);
+
+  // murmur3 finalizer: neighbouring MACs map to unrelated seeds
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+  return h;
+}
+
+/**
+ * Initialise a jitter state
+ * @param state Caller-owned state
+ * @param salt Distinct per use, so timers don't share one sequence
+ */
+inline void jitterSeed(uint32_t& state, uint32_t salt) {
+  state = deviceSeed() ^ (salt * 0x9e3779b9);
+  if (state == 0) state = 1;  // xorshift never leaves 0
+}
+
+/**
+ * Next pseudo-random value (xorshift32)
+ */
+inline uint32_t jitterNext(uint32_t& state) {
+  uint32_t x = state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  state = x;
+  return x;
+}
+
+/**
+ * Pseudo-random value in [0, n)
+ */
+inline uint32_t jitterBelow(uint32_t& state, uint32_t n) {
+  return n > 0 ? jitterNext(state) % n : 0;
+}
+
+/**
+ * Spread a period by ±pct percent
+ * @param state Caller-owned state
+ * @param period Nominal period (ms)
+ * @param pct Maximum deviation in percent
+ * @return Value in [period - pct%, period + pct%]
+ */
+inline uint32_t jitterAround(uint32_t& state, uint32_t period, uint8_t pct) {
+  uint32_t span = period * pct / 100;
+  return period - span + jitterBelow(state, 2 * span + 1);
+}
+
+#endif // CORE_JITTER_H
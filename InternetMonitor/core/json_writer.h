@@ -0,0 +1,213 @@
+#ifndef CORE_JSON_WRITER_H
+#define CORE_JSON_WRITER_H
+
+/**
+ * @file json_writer.h
+ * @brief Streaming JSON writer over a caller-provided buffer
+ *
+ * Writes JSON text straight into a fixed buffer: no document tree, no
+ * String, no heap. Given a sink, a full buffer is handed to it and reused
+ * (e.g. the HTTP response); without one, output stops at the end of the
+ * buffer and overflow() reports it (e.g. an MQTT payload).
+ *
+ * Numbers go through num_format.h rather than printf: floats take a
+ * fixed number of decimals, and NaN/inf become null.
+ *
+ *   char buf[256];
+ *   JsonWriter out(buf, sizeof(buf));
+ *   out.beginObject();
+ *   out.field("checks", 1520);
+ *   out.field("rate", 99.5f, 1);
+ *   out.endObject();
+ *   publish(out.c_str(), out.length());
+ *
+ * Not thread-safe; each caller owns its writer and buffer.
+ */
+
+#include <Arduino.h>
+#include "num_format.h"
+
+// Receives each full buffer (and the rest on finish())
+typedef void (*JsonSink)(const char* data, size_t length);
+
+class JsonWriter {
+public:
+  JsonWriter(char* buf, size_t size, JsonSink sink = nullptr)
+    : _buf(buf), _size(sink ? size : size - 1), _sink(sink) {}
+
+  // ===========================================
+  // STRUCTURE
+  // ===========================================
+
+  // key is nullptr inside an array (and for the outermost value)
+  void beginObject(const char* k = nullptr) { open(k, '{'); }
+  void endObject() { close('}'); }
+  void beginArray(const char* k = nullptr) { open(k, '['); }
+  void endArray() { close(']'); }
+
+  void key(const char* k) {
+    separator();
+    writeString(k);
+    put(':');
+    _afterKey = true;
+  }
+
+  // ===========================================
+  // VALUES
+  // ===========================================
+
+  void value(const char* s) {
+    separator();
+    if (s) writeString(s);
+    else write("null", 4);
+  }
+  void value(bool b) {
+    separator();
+    if (b) write("true", 4);
+    else write("false", 5);
+  }
+  void value(int v) { value((long long)v); }
+  void value(long v) { value((long long)v); }
+  void value(unsigned v) { value((unsigned long long)v); }
+  void value(unsigned long v) { value((unsigned long long)v); }
+  void value(long long v) {
+    separator();
+    char num[NUM_FORMAT_MAX];
+    write(num, formatInt(num, v));
+  }
+  void value(unsigned long long v) {
+    separator();
+    char num[NUM_FORMAT_MAX];
+    write(num, formatUint(num, v));
+  }
+
+  // Fixed decimals (0-6), rounded half away from zero
+  void value(double v, uint8_t decimals) {
+    separator();
+    char num[NUM_FORMAT_MAX];
+    size_t n = formatFixed(num, v, decimals);
+    if (n > 0) write(num, n);
+    else write("null", 4);
+  }
+
+  template <typename T>
+  void field(const char* k, T v) {
+    key(k);
+    value(v);
+  }
+  void field(const char* k, double v, uint8_t decimals) {
+    key(k);
+    value(v, decimals);
+  }
+
+  // ===========================================
+  // OUTPUT
+  // ===========================================
+
+  // Hand the rest to the sink, or NUL-terminate the buffer
+  void finish() {
+    if (_sink) flush();
+    else _buf[_len] = '\0';
+  }
+
+  // Bytes written so far (including those already passed to the sink)
+  size_t length() const { return _flushed + _len; }
+
+  // Buffer contents; without a sink, call finish() first
+  const char* c_str() const { return _buf; }
+
+  // Ran out of buffer (no sink); the output is truncated
+  bool overflow() const { return _overflow; }
+
+private:
+  char* _buf;
+  size_t _size;             // Usable bytes (one kept for the NUL without a sink)
+  JsonSink _sink;
+  size_t _len = 0;
+  size_t _flushed = 0;
+  uint32_t _more = 0;       // Bit per depth: a value was written at this level
+  uint8_t _depth = 0;
+  bool _afterKey = false;
+  bool _overflow = false;
+
+  void flush() {
+    if (_len == 0) return;
+    _sink(_buf, _len);
+    _flushed += _len;
+    _len = 0;
+  }
+
+  void put(char c) {
+    if (_len == _size) {
+      if (!_sink) {
+        _overflow = true;
+        return;
+      }
+      flush();
+    }
+    _buf[_len++] = c;
+  }
+
+  void write(const char* data, size_t length) {
+    while (length > 0) {
+      if (_len == _size) {
+        if (!_sink) {
+          _overflow = true;
+          return;
+        }
+        flush();
+      }
+      size_t n = min(length, _size - _len);
+      memcpy(_buf + _len, data, n);
+      _len += n;
+      data += n;
+      length -= n;
+    }
+  }
+
+  // Comma before every value but the first at its level (not after a key)
+  void separator() {
+    if (_afterKey) {
+      _afterKey = false;
+      return;
+    }
+    uint32_t bit = 1UL << _depth;
+    if (_more & bit) put(',');
+    _more |= bit;
+  }
+
+  void open(const char* k, char c) {
+    if (k) key(k);
+    else separator();
+    put(c);
+    _depth++;
+    _more &= ~(1UL << _depth);
+  }
+
+  void close(char c) {
+    if (_depth > 0) _depth--;
+    put(c);
+  }
+
+  void writeString(const char* s) {
+    static const char hex[] = "0123456789abcdef";
+    put('"');
+    for (; *s; s++) {
+      uint8_t c = *s;
+      if (c == '"' || c == '\\') {
+        put('\\');
+        put(c);
+      } else if (c == '\n') {
+        write("\\n", 2);
+      } else if (c < 0x20) {
+        char esc[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf]};
+        write(esc, 6);
+      } else {
+        put(c);
+      }
+    }
+    put('"');
+  }
+};
+
+#endif // CORE_JSON_WRITER_H
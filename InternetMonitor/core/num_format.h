@@ -0,0 +1,73 @@
+#ifndef CORE_NUM_FORMAT_H
+#define CORE_NUM_FORMAT_H
+
+/**
+ * @file num_format.h
+ * @brief Integer and fixed-point formatting without printf
+ *
+ * Shared by the JSON writer and the text writer behind /metrics. printf's
+ * float path goes through newlib's dtoa, which takes heap blocks; these
+ * write into the caller's buffer only.
+ */
+
+#include <Arduino.h>
+#include <math.h>
+
+#define NUM_FORMAT_MAX 24   // Buffer size for either function
+
+/**
+ * Format an unsigned integer
+ * @param buf At least NUM_FORMAT_MAX bytes (not NUL-terminated)
+ * @return Characters written
+ */
+inline size_t formatUint(char* buf, unsigned long long v) {
+  char digits[20];
+  size_t i = sizeof(digits);
+  do {
+    digits[--i] = '0' + v % 10;
+    v /= 10;
+  } while (v > 0);
+  size_t n = sizeof(digits) - i;
+  memcpy(buf, digits + i, n);
+  return n;
+}
+
+/**
+ * Format a signed integer
+ * @param buf At least NUM_FORMAT_MAX bytes (not NUL-terminated)
+ * @return Characters written
+ */
+inline size_t formatInt(char* buf, long long v) {
+  if (v >= 0) return formatUint(buf, v);
+  buf[0] = '-';
+  return 1 + formatUint(buf + 1, 0ULL - (unsigned long long)v);
+}
+
+/**
+ * Format with a fixed number of decimals, rounded half away from zero
+ * @param buf At least NUM_FORMAT_MAX bytes (not NUL-terminated)
+ * @param decimals 0-6
+ * @return Characters written, 0 for NaN, infinity or |v| >= 1e12
+ */
+inline size_t formatFixed(char* buf, double v, uint8_t decimals) {
+  static const uint32_t scales[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+  if (decimals > 6) decimals = 6;
+  if (isnan(v) || fabs(v) >= 1e12) return 0;
+
+  uint32_t scale = scales[decimals];
+  unsigned long long n = (unsigned long long)(fabs(v) * scale + 0.5);
+  size_t len = 0;
+  if (v < 0 && n > 0) buf[len++] = '-';
+  len += formatUint(buf + len, n / scale);
+  if (decimals == 0) return len;
+
+  uint32_t frac = n % scale;
+  buf[len++] = '.';
+  for (int i = decimals - 1; i >= 0; i--) {
+    buf[len + i] = '0' + frac % 10;
+    frac /= 10;
+  }
+  return len + decimals;
+}
+
+#endif // CORE_NUM_FORMAT_H
@@ -0,0 +1,103 @@
+#ifndef CORE_RENDER_PARAMS_H
+#define CORE_RENDER_PARAMS_H
+
+/**
+ * @file render_params.h
+ * @brief Display settings handed to the LED task as one snapshot (seqlock)
+ *
+ * The settings globals (currentEffect, effectSpeed, ...) are owned by
+ * core 1: web handlers, NVS and changeState() write them. After each
+ * change the writer publishes a RenderParams snapshot. The LED task copies
+ * the snapshot once per frame (readRenderParams() into `render`), and
+ * effects only ever look at that copy. A frame can never see a new effect
+ * with the old speed, or a rotation change halfway through.
+ *
+ * Seqlock: the writer makes seq odd, stores, then makes it even again. The
+ * reader retries if seq was odd or changed while it copied. Writers are
+ * rare and serialised by renderMux. The reader (every frame) takes no lock.
+ *
+ * The fade colors (currentR/G/B, targetR/G/B) are not in here: since the
+ * event bus they're only written by the LED task itself.
+ */
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// ===========================================
+// SNAPSHOT
+// ===========================================
+
+struct RenderParams {
+  uint8_t effect = 0;
+  uint8_t brightness = 0;
+  uint8_t rotation = 0;
+  uint8_t speed = 0;
+  bool internetOK = false;
+};
+
+struct RenderParamsSlot {
+  volatile uint32_t seq = 0;    // Odd while a write is in progress
+  RenderParams params;
+};
+
+// Writer-side settings (defined in the main .ino)
+extern volatile int currentEffect;
+extern volatile uint8_t currentBrightness;
+extern volatile uint8_t currentRotation;
+extern volatile uint8_t effectSpeed;
+extern volatile bool isInternetOK;
+
+extern portMUX_TYPE renderMux;
+
+static RenderParamsSlot renderSlot;
+
+// LED task's copy for the current frame (effects read this)
+static RenderParams render;
+
+// Reads that had to retry because a write was in flight
+static uint32_t renderRetries = 0;
+
+// ===========================================
+// WRITER (core 1)
+// ===========================================
+
+/**
+ * Publish the current settings to the LED task
+ * Call after changing any of the settings globals.
+ */
+inline void publishRenderParams() {
+  portENTER_CRITICAL(&renderMux);
+  renderSlot.seq++;               // Odd: write in progress
+  __sync_synchronize();
+  renderSlot.params.effect = currentEffect;
+  renderSlot.params.brightness = currentBrightness;
+  renderSlot.params.rotation = currentRotation;
+  renderSlot.params.speed = effectSpeed;
+  renderSlot.params.internetOK = isInternetOK;
+  __sync_synchronize();
+  renderSlot.seq++;               // Even: consistent again
+  portEXIT_CRITICAL(&renderMux);
+}
+
+// ===========================================
+// READER (LED task, lock-free)
+// ===========================================
+
+/**
+ * Copy a consistent snapshot
+ * @param out Destination (normally `render`)
+ */
+inline void readRenderParams(RenderParams& out) {
+  uint32_t before, after;
+  while (true) {
+    before = renderSlot.seq;
+    __sync_synchronize();
+    out = renderSlot.params;
+    __sync_synchronize();
+    after = renderSlot.seq;
+    if (before == after && (before & 1) == 0) return;
+    renderRetries++;
+  }
+}
+
+#endif // CORE_RENDER_PARAMS_H
@@ -7,13 +7,17 @@
  * 
  * Manages the device state machine (booting, connecting, online, etc.)
  * and associated LED colors. Uses volatile variables and mutex for
- * thread-safe cross-core access.
+ * thread-safe cross-core access. State changes are announced on the
+ * event bus (events.h); the LED task and MQTT react to those.
  */
 
 #include <Arduino.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include "types.h"
+#include "clock.h"
+#include "events.h"
+#include "render_params.h"
 #include "../config.h"
 
 // ===========================================
@@ -23,6 +27,9 @@
 // From effects_base.h
 extern void setTargetColor(uint8_t r, uint8_t g, uint8_t b);
 
+// From storage/outage_log.h
+inline void outageLogStateChange(int newState);
+
 // ===========================================
 // GLOBAL STATE (volatile for cross-core access)
 // ===========================================
@@ -59,6 +66,8 @@ extern TaskHandle_t networkTaskHandle;
 // Global instances
 extern SystemStats stats;
 extern PerformanceMetrics perf;
+extern QualityMetrics quality;
+extern SegmentStatus segment;
 extern AuthState auth;
 
 // Timing
@@ -72,9 +81,21 @@ extern unsigned long lastPortalActivity;
 // STATE MANAGEMENT FUNCTIONS
 // ===========================================
 
+/**
+ * Check whether a state counts towards downtime
+ * @param state State to test
+ * @return true for INTERNET_DOWN, ROUTER_UNREACHABLE and DNS_FAILING
+ */
+inline bool isOutageState(int state) {
+  return state == STATE_INTERNET_DOWN ||
+         state == STATE_ROUTER_UNREACHABLE ||
+         state == STATE_DNS_FAILING;
+}
+
 /**
  * Change the system state with thread-safe mutex protection
- * Updates LED colors, tracks downtime, and logs state transitions
+ * Tracks downtime, logs the transition and publishes EVENT_STATE
+ * (the LED task fades to the new color when it picks the event up)
  * 
  * @param newState The new state to transition to
  * 
@@ -84,38 +105,127 @@ extern unsigned long lastPortalActivity;
  * - STATE_CONFIG_PORTAL: AP mode for configuration (purple)
  * - STATE_WIFI_LOST: WiFi connection lost (red)
  * - STATE_INTERNET_OK: Internet working (green)
- * - STATE_INTERNET_DEGRADED: Partial failures (yellow)
+ * - STATE_INTERNET_DEGRADED: Partial failures or poor link quality (yellow)
  * - STATE_INTERNET_DOWN: Internet down (red/orange)
+ * - STATE_ROUTER_UNREACHABLE: Gateway stopped answering (crimson)
+ * - STATE_DNS_FAILING: Resolver not answering, WAN reachable (magenta)
  */
 inline void changeState(State newState) {
   if (currentState == newState) return;
   
+  // Read the clock before taking the lock; inside it only plain stores,
+  // no I/O (logging happens later, see serviceStateLog())
+  uint64_t now = clockMonoMs();
+  unsigned long nowMs = millis();
+  
   // Use mutex for thread-safe state changes
   portENTER_CRITICAL(&stateMux);
+  uint32_t lockStart = ESP.getCycleCount();
+  int oldState = currentState;
   
-  Serial.print("[State] ");
-  Serial.print(currentState);
-  Serial.print(" -> ");
-  Serial.println(newState);
-  
-  // Track downtime
-  if (newState == STATE_INTERNET_DOWN && !stats.wasDown) {
-    stats.downtimeStart = millis();
+  // Track downtime (monotonic clock, converted to UTC on output)
+  if (isOutageState(newState) && !stats.wasDown) {
+    stats.downtimeStart = now;
     stats.wasDown = true;
   } else if (newState == STATE_INTERNET_OK && stats.wasDown) {
-    stats.totalDowntimeMs += millis() - stats.downtimeStart;
-    stats.lastDowntime = millis() - stats.downtimeStart;
+    stats.totalDowntimeMs += now - stats.downtimeStart;
+    stats.lastDowntime = now - stats.downtimeStart;
     stats.wasDown = false;
   }
   
   currentState = newState;
-  stateChangeTime = millis();
+  stateChangeTime = nowMs;
+  stats.lastChangeMono = now;
   isInternetOK = (newState == STATE_INTERNET_OK);
 
+  uint32_t lockCycles = ESP.getCycleCount() - lockStart;
   portEXIT_CRITICAL(&stateMux);
 
-  // Set colors based on state (using config.h constants)
-  switch (newState) {
+  perf.stateLockCycles = lockCycles;
+  if (lockCycles > perf.stateLockMaxCycles) perf.stateLockMaxCycles = lockCycles;
+
+  // Effects read the online flag from the render snapshot
+  publishRenderParams();
+
+  // Journal finished outages to flash (queued, written later)
+  outageLogStateChange(newState);
+
+  // Tell the LED task, MQTT, the web layer and the log
+  publishEvent(EVENT_STATE, oldState, newState);
+}
+
+/**
+ * Count one finished check (network task)
+ * All counters move together under stateMux, so a snapshot never sees
+ * totalChecks ahead of successfulChecks + failedChecks.
+ * @param passed Probe quorum reached
+ */
+inline void recordCheckResult(bool passed) {
+  portENTER_CRITICAL(&stateMux);
+  stats.totalChecks++;
+  if (passed) {
+    stats.successfulChecks++;
+    stats.consecutiveFailures = 0;
+    stats.consecutiveSuccesses++;
+  } else {
+    stats.failedChecks++;
+    stats.consecutiveFailures++;
+    stats.consecutiveSuccesses = 0;
+  }
+  portEXIT_CRITICAL(&stateMux);
+}
+
+/**
+ * Copy the stats for a report (web handlers, MQTT payloads)
+ * 64-bit fields aren't single stores on the ESP32, so readers on other
+ * tasks must go through this instead of reading `stats` directly.
+ * @param out Destination
+ * @return Current state, taken in the same critical section
+ */
+inline State statsSnapshot(SystemStats& out) {
+  portENTER_CRITICAL(&stateMux);
+  out = stats;
+  State state = (State)currentState;
+  portEXIT_CRITICAL(&stateMux);
+  return state;
+}
+
+/**
+ * Success rate in percent (100 before the first check)
+ */
+inline float statsSuccessRate(const SystemStats& s) {
+  return s.totalChecks > 0 ? (float)(100.0 * s.successfulChecks / s.totalChecks) : 100.0f;
+}
+
+/**
+ * Critical section length in nanoseconds
+ * @param cycles CPU cycles (ESP.getCycleCount() delta)
+ */
+inline uint32_t lockCyclesToNs(uint32_t cycles) {
+  return (uint32_t)((uint64_t)cycles * 1000 / ESP.getCpuFreqMHz());
+}
+
+/**
+ * Print queued state transitions (call from loop())
+ * Keeps UART writes out of changeState()'s critical section.
+ */
+inline void serviceStateLog() {
+  Event ev;
+  while (pollEvent(EVENT_SUB_LOG, ev)) {
+    if (ev.type != EVENT_STATE) continue;
+    Serial.printf("[State] %u -> %u (%lu ms ago, lock %lu ns, max %lu ns)\n",
+      ev.a, ev.b, (unsigned long)(millis() - ev.ms),
+      (unsigned long)lockCyclesToNs(perf.stateLockCycles),
+      (unsigned long)lockCyclesToNs(perf.stateLockMaxCycles));
+  }
+}
+
+/**
+ * Fade the matrix to a state's color (LED task, on EVENT_STATE)
+ * @param state State whose color to show
+ */
+inline void setStateColor(int state) {
+  switch (state) {
     case STATE_BOOTING:
       setTargetColor(COLOR_BOOTING_R, COLOR_BOOTING_G, COLOR_BOOTING_B);
       break;
@@ -137,25 +247,93 @@ inline void changeState(State newState) {
     case STATE_INTERNET_DOWN:
       setTargetColor(COLOR_DOWN_R, COLOR_DOWN_G, COLOR_DOWN_B);
       break;
+    case STATE_ROUTER_UNREACHABLE:
+      setTargetColor(COLOR_ROUTER_R, COLOR_ROUTER_G, COLOR_ROUTER_B);
+      break;
+    case STATE_DNS_FAILING:
+      setTargetColor(COLOR_DNS_R, COLOR_DNS_G, COLOR_DNS_B);
+      break;
+  }
+}
+
+// ===========================================
+// CONNECTIVITY STATE DECISION
+// ===========================================
+
+/**
+ * Update the degraded flag from a new quality score
+ * Enters degraded below QUALITY_DEGRADED_BELOW and only leaves it at
+ * QUALITY_RECOVER_AT, so a score hovering at the threshold doesn't flap.
+ *
+ * @param score Latest burst score (0-100)
+ */
+inline void updateQualityState(uint8_t score) {
+  quality.score = score;
+  if (quality.degraded) {
+    quality.degraded = (score < QUALITY_RECOVER_AT);
+  } else {
+    quality.degraded = (score < QUALITY_DEGRADED_BELOW);
+  }
+}
+
+/**
+ * Pick the state for the latest connectivity check
+ * Uses the segment probes to name the failing hop once failures reach
+ * FAILURES_BEFORE_RED:
+ * - Gateway answered before but no longer does -> ROUTER_UNREACHABLE
+ * - Resolver silent but the WAN IP answers     -> DNS_FAILING
+ * - Otherwise                                  -> INTERNET_DOWN
+ * A passing check with a silent resolver is only DEGRADED: the targets
+ * still answer (cached names), so it isn't downtime.
+ *
+ * @param checkPassed Probe quorum reached
+ * @return State for the current check
+ */
+inline State connectivityState(bool checkPassed) {
+  bool dnsFailing = segment.dnsFailures >= FAILURES_BEFORE_RED;
+
+  if (checkPassed) {
+    // Cached names still work, new lookups won't
+    return quality.degraded || dnsFailing ? STATE_INTERNET_DEGRADED : STATE_INTERNET_OK;
+  }
+  if (stats.consecutiveFailures < FAILURES_BEFORE_RED) {
+    return STATE_INTERNET_DEGRADED;
   }
+  if (segment.gatewaySeen && segment.gatewayFailures >= FAILURES_BEFORE_RED) {
+    return STATE_ROUTER_UNREACHABLE;
+  }
+  if (dnsFailing && segment.wanIpOk) {
+    return STATE_DNS_FAILING;
+  }
+  return STATE_INTERNET_DOWN;
 }
 
 // ===========================================
 // HELPER FUNCTIONS
 // ===========================================
 
-inline String formatUptime(unsigned long ms) {
-  unsigned long seconds = ms / 1000;
+/**
+ * Format a duration as "1d 2h 3m 4s" (zero parts skipped) into a buffer
+ * @return buf
+ */
+inline const char* formatUptime(char* buf, size_t len, uint64_t ms) {
+  unsigned long seconds = (unsigned long)(ms / 1000);
   unsigned long minutes = seconds / 60;
   unsigned long hours = minutes / 60;
   unsigned long days = hours / 24;
-  
-  String result = "";
-  if (days > 0) result += String(days) + "d ";
-  if (hours % 24 > 0) result += String(hours % 24) + "h ";
-  if (minutes % 60 > 0) result += String(minutes % 60) + "m ";
-  result += String(seconds % 60) + "s";
-  return result;
+
+  size_t n = 0;
+  buf[0] = '\0';
+  if (days > 0) n += snprintf(buf + n, len - n, "%lud ", days);
+  if (hours % 24 > 0 && n < len) n += snprintf(buf + n, len - n, "%luh ", hours % 24);
+  if (minutes % 60 > 0 && n < len) n += snprintf(buf + n, len - n, "%lum ", minutes % 60);
+  if (n < len) snprintf(buf + n, len - n, "%lus", seconds % 60);
+  return buf;
+}
+
+inline String formatUptime(uint64_t ms) {
+  char buf[32];
+  return String(formatUptime(buf, sizeof(buf), ms));
 }
 
 inline float getChipTemp() {
@@ -22,7 +22,9 @@ enum State {
   STATE_WIFI_LOST = 3,
   STATE_INTERNET_OK = 4,
   STATE_INTERNET_DEGRADED = 5,
-  STATE_INTERNET_DOWN = 6
+  STATE_INTERNET_DOWN = 6,
+  STATE_ROUTER_UNREACHABLE = 7,
+  STATE_DNS_FAILING = 8
 };
 
 enum Effect {
@@ -69,19 +71,52 @@ enum APIError {
 // SYSTEM STATISTICS
 // ===========================================
 
+// Written under stateMux (recordCheckResult(), changeState()); other
+// tasks read a consistent copy via statsSnapshot()
 struct SystemStats {
-  unsigned long totalChecks = 0;
-  unsigned long successfulChecks = 0;
-  unsigned long failedChecks = 0;
+  uint64_t totalChecks = 0;           // Always successfulChecks + failedChecks
+  uint64_t successfulChecks = 0;
+  uint64_t failedChecks = 0;
   int consecutiveFailures = 0;
   int consecutiveSuccesses = 0;
-  unsigned long lastDowntime = 0;
-  unsigned long totalDowntimeMs = 0;
-  unsigned long downtimeStart = 0;
+  uint64_t lastDowntime = 0;          // ms
+  uint64_t totalDowntimeMs = 0;
+  uint64_t downtimeStart = 0;         // clockMonoMs()
+  uint64_t lastChangeMono = 0;        // clockMonoMs() of the last state change
   bool wasDown = false;
   unsigned long bootTime = 0;
 };
 
+// ===========================================
+// SEGMENT STATUS (gateway / DNS / WAN IP)
+// ===========================================
+
+struct SegmentStatus {
+  bool gatewayOk = false;
+  bool gatewaySeen = false;       // Gateway has answered since WiFi connected
+  int gatewayFailures = 0;        // Consecutive checks without a reply
+  uint32_t gatewayRttMs = 0;
+  bool wanIpOk = false;           // SEGMENT_WAN_IP answered (no DNS involved)
+  bool dnsOk = false;
+  int dnsFailures = 0;            // Consecutive checks without an answer
+};
+
+// ===========================================
+// LINK QUALITY (probe bursts)
+// ===========================================
+
+struct QualityMetrics {
+  uint16_t sent = 0;              // Probes in the last burst
+  uint16_t received = 0;          // Replies in the last burst
+  float lossPct = 0.0f;           // Last burst loss
+  float rttMs = 0.0f;             // Last burst mean RTT
+  float jitterMs = 0.0f;          // RFC 3550 interarrival jitter estimate
+  uint8_t score = 100;            // 0-100, see computeQualityScore()
+  bool degraded = false;          // Score below threshold (with hysteresis)
+  unsigned long bursts = 0;
+  unsigned long lastBurstTime = 0;
+};
+
 // ===========================================
 // PERFORMANCE METRICS
 // ===========================================
@@ -93,9 +128,20 @@ struct PerformanceMetrics {
   unsigned long ledFrameTimeUs = 0;
   unsigned long ledMaxFrameTimeUs = 0;
   unsigned long ledStackHighWater = 0;
+  uint32_t ledJitterUs = 0;         // Mean |frame period - 16 ms|, last report
+  
+  // LED jitter accumulators (benchmark diffs these)
+  uint32_t ledJitterSumUs = 0;
+  uint32_t ledJitterFrames = 0;
+  uint32_t ledJitterPeakUs = 0;     // Since the last reset request
+  volatile bool ledJitterPeakReset = false;
   
   // Network task metrics
   unsigned long netStackHighWater = 0;
+  
+  // changeState() critical section length (CPU cycles)
+  uint32_t stateLockCycles = 0;
+  uint32_t stateLockMaxCycles = 0;
 };
 
 // ===========================================
@@ -113,8 +159,20 @@ struct DisplaySettings {
 // AUTH STATE
 // ===========================================
 
+// Session constants
+constexpr int TOKEN_LENGTH = 32;
+constexpr int MAX_SESSIONS = 4;                              // Logged-in browsers at once
+constexpr uint64_t SESSION_IDLE_TIMEOUT = 7ULL * 86400000;   // 7 days unused
+constexpr uint64_t SESSION_MAX_AGE = 30ULL * 86400000;       // 30 days since login
+
+struct Session {
+  char token[TOKEN_LENGTH + 1] = "";  // "" = free slot
+  uint64_t createdMs = 0;             // Monotonic (clockMonoMs())
+  uint64_t lastSeenMs = 0;
+};
+
 struct AuthState {
-  String sessionToken = "";
+  Session sessions[MAX_SESSIONS];
   int loginAttempts = 0;
   unsigned long lockoutUntil = 0;
 };
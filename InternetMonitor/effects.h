@@ -56,10 +56,10 @@
 /**
  * Apply the currently selected LED effect
  * Called from LED task at 60fps
- * Uses currentEffect global to determine which effect to run
+ * Uses the frame's render.effect to determine which effect to run
  */
 void applyEffect() {
-  switch (currentEffect) {
+  switch (render.effect) {
     // Basic effects
     case EFFECT_OFF:         effectOff(); break;
     case EFFECT_SOLID:       effectSolid(); break;
@@ -59,7 +59,7 @@ void effectInterference() {
       
       uint8_t r, g, b;
       
-      if (isInternetOK) {
+      if (render.internetOK) {
         // Color shifts based on interference type
         if (brightness > 0.5f) {
           // Constructive - cyan to white
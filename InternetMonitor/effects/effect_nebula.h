@@ -49,7 +49,7 @@ void effectNebula() {
       
       uint8_t r, g, b;
       
-      if (isInternetOK) {
+      if (render.internetOK) {
         // Shift between purple, blue, and pink
         r = NEBULA_BASE_R + (uint8_t)(v * NEBULA_RANGE_R * (0.5f + colorWave * 0.5f));
         g = NEBULA_BASE_G + (uint8_t)(v * NEBULA_RANGE_G);
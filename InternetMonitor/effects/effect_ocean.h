@@ -40,7 +40,7 @@ void effectOcean() {
       
       uint8_t r, g, b;
       
-      if (isInternetOK) {
+      if (render.internetOK) {
         // Deep blue to light blue gradient
         // Low v = deep water, high v = wave crest
         r = OCEAN_BASE_R + (uint8_t)(v * OCEAN_RANGE_R);
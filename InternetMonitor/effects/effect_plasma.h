@@ -30,7 +30,7 @@ void effectPlasma() {
       
       uint8_t r, g, b;
       
-      if (isInternetOK) {
+      if (render.internetOK) {
         // Full color plasma - cycle through hue
         hsvToRgb(v * 360.0f, PLASMA_SATURATION, PLASMA_VALUE, &r, &g, &b);
       } else {
@@ -6,7 +6,7 @@
 // Effect 3: Rainbow - Flowing rainbow (full color when online, tinted when offline)
 void effectRainbow() {
   static unsigned long offset = 0;
-  offset += 256 * (effectSpeed / 50.0);
+  offset += 256 * (render.speed / 50.0);
   
   for (int row = 0; row < 8; row++) {
     for (int col = 0; col < 8; col++) {
@@ -18,7 +18,7 @@ void effectRainbow() {
       uint8_t g = (color >> 8) & 0xFF;
       uint8_t b = color & 0xFF;
       
-      if (!isInternetOK) {
+      if (!render.internetOK) {
         // Tint with current state color
         r = (r + currentR * 2) / 3;
         g = (g + currentG * 2) / 3;
@@ -61,7 +61,7 @@ void effectRipplePool() {
       
       uint8_t r, g, b;
       
-      if (isInternetOK) {
+      if (render.internetOK) {
         // Water - pure blue/cyan, no red to avoid purple
         r = 0;
         g = POOL_BASE_GREEN + (uint8_t)(v * POOL_GREEN_RANGE);
@@ -3,6 +3,7 @@
 
 #include <Adafruit_NeoPixel.h>
 #include "../config.h"
+#include "../core/render_params.h"
 
 // ===========================================
 // EFFECT CONFIGURATION DATA
@@ -47,10 +48,9 @@ extern volatile uint8_t currentR, currentG, currentB;
 extern volatile uint8_t targetR, targetG, targetB;
 extern uint8_t fadeStartR, fadeStartG, fadeStartB;
 extern unsigned long fadeStartTime;
-extern volatile uint8_t currentRotation;
-extern volatile uint8_t effectSpeed;
-extern volatile int currentEffect;
-extern volatile bool isInternetOK;
+
+// Effect, speed, rotation and online flag come from `render`
+// (render_params.h), the LED task's per-frame snapshot
 
 // ===========================================
 // SIN/COS LOOKUP TABLE
@@ -130,7 +130,7 @@ inline float fastDist(float dx, float dy) {
 // Coordinate system: row 0 = top, col 0 = left (before rotation)
 inline int getPixelIndex(int row, int col) {
   int r = row, c = col;
-  switch (currentRotation) {
+  switch (render.rotation) {
     case ROTATION_90:   // 90° CW
       r = col;
       c = 7 - row;
@@ -258,7 +258,7 @@ inline float mapFloat(float x, float inMin, float inMax, float outMin, float out
 
 // Get animation time factor based on effect speed
 inline float getTimeScale() {
-  return effectSpeed / ANIM_SPEED_DIVISOR;
+  return render.speed / ANIM_SPEED_DIVISOR;
 }
 
 // Get current time in seconds, scaled by effect speed
@@ -41,6 +41,7 @@ struct MQTTConfig {
   bool connected = false;
   unsigned long lastPublishTime = 0;
   unsigned long lastConnectAttempt = 0;
+  unsigned long reconnectDelayMs = 0;   // Wait after lastConnectAttempt (backoff + jitter)
   int connectionFailures = 0;
   
   // Helper to check if configured
@@ -58,6 +59,13 @@ struct MQTTConfig {
     return topic;
   }
   
+  // Same, into a caller buffer (no allocation)
+  const char* getTopic(const char* suffix, char* buf, size_t len) const {
+    if (suffix && suffix[0]) snprintf(buf, len, "%s/%s", baseTopic, suffix);
+    else strlcpy(buf, baseTopic, len);
+    return buf;
+  }
+  
   // Get state topic
   String getStateTopic() const {
     return getTopic("state");
@@ -143,20 +151,28 @@ inline void saveMQTTConfigToNVS() {
   Serial.println("[MQTT] Config saved to NVS");
 }
 
-inline String getMQTTStatusText() {
+/**
+ * MQTT status line for the dashboard, written into a buffer
+ * @return buf
+ */
+inline const char* getMQTTStatusText(char* buf, size_t len) {
   if (!mqttConfig.enabled) {
-    return "Disabled";
-  }
-  if (strlen(mqttConfig.broker) == 0) {
-    return "Not Configured";
+    strlcpy(buf, "Disabled", len);
+  } else if (strlen(mqttConfig.broker) == 0) {
+    strlcpy(buf, "Not Configured", len);
+  } else if (mqttConfig.connected) {
+    strlcpy(buf, "Connected", len);
+  } else if (mqttConfig.connectionFailures > 0) {
+    snprintf(buf, len, "Disconnected (%d failures)", mqttConfig.connectionFailures);
+  } else {
+    strlcpy(buf, "Connecting...", len);
   }
-  if (mqttConfig.connected) {
-    return "Connected";
-  }
-  if (mqttConfig.connectionFailures > 0) {
-    return "Disconnected (" + String(mqttConfig.connectionFailures) + " failures)";
-  }
-  return "Connecting...";
+  return buf;
+}
+
+inline String getMQTTStatusText() {
+  char buf[40];
+  return String(getMQTTStatusText(buf, sizeof(buf)));
 }
 
 #endif // MQTT_CONFIG_H
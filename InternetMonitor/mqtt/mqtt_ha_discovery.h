@@ -5,10 +5,14 @@
  * @file mqtt_ha_discovery.h
  * @brief Home Assistant MQTT auto-discovery message builders
  * 
- * Creates discovery payloads for 8 entities:
+ * Creates discovery payloads for 16 entities:
  * - Status (text sensor)
  * - Connectivity (binary sensor)
  * - Uptime, Success Rate, RSSI, Temperature, Failed Checks, Downtime (sensors)
+ * - Link Quality, Packet Loss, Jitter (sensors, from probe bursts)
+ * - Download, Upload (sensors, from the throughput test)
+ * - Last State Change (timestamp sensor, once the clock has synced)
+ * - CPU Core 0, CPU Core 1 (diagnostic sensors, rolling load average)
  */
 
 #include <Arduino.h>
@@ -220,4 +224,91 @@ inline String buildHADiscoveryDowntime() {
   );
 }
 
+inline String buildHADiscoveryLinkQuality() {
+  return buildHADiscovery(
+    "Link Quality",
+    buildUniqueId("link_quality").c_str(),
+    "{{ value_json.link_quality }}",
+    "mdi:gauge"
+  );
+}
+
+inline String buildHADiscoveryPacketLoss() {
+  return buildHADiscovery(
+    "Packet Loss",
+    buildUniqueId("packet_loss").c_str(),
+    "{{ value_json.packet_loss }}",
+    "mdi:lan-disconnect",
+    "%"
+  );
+}
+
+inline String buildHADiscoveryJitter() {
+  return buildHADiscovery(
+    "Jitter",
+    buildUniqueId("jitter").c_str(),
+    "{{ value_json.jitter_ms }}",
+    "mdi:sine-wave",
+    "ms",
+    "duration"
+  );
+}
+
+inline String buildHADiscoveryDownload() {
+  return buildHADiscovery(
+    "Download Speed",
+    buildUniqueId("download").c_str(),
+    "{{ value_json.download_mbps }}",
+    "mdi:download-network",
+    "Mbit/s",
+    "data_rate"
+  );
+}
+
+inline String buildHADiscoveryUpload() {
+  return buildHADiscovery(
+    "Upload Speed",
+    buildUniqueId("upload").c_str(),
+    "{{ value_json.upload_mbps }}",
+    "mdi:upload-network",
+    "Mbit/s",
+    "data_rate"
+  );
+}
+
+inline String buildHADiscoveryLastChange() {
+  return buildHADiscovery(
+    "Last State Change",
+    buildUniqueId("last_change").c_str(),
+    "{{ value_json.state_since | default('None') }}",
+    "mdi:clock-outline",
+    nullptr,
+    "timestamp"
+  );
+}
+
+inline String buildHADiscoveryCpuCore0() {
+  return buildHADiscovery(
+    "CPU Core 0",
+    buildUniqueId("cpu_core0").c_str(),
+    "{{ value_json.cpu_core0 | default(0) }}",
+    "mdi:cpu-32-bit",
+    "%",
+    nullptr,
+    "diagnostic"
+  );
+}
+
+inline String buildHADiscoveryCpuCore1() {
+  return buildHADiscovery(
+    "CPU Core 1",
+    buildUniqueId("cpu_core1").c_str(),
+    "{{ value_json.cpu_core1 | default(0) }}",
+    "mdi:cpu-32-bit",
+    "%",
+    nullptr,
+    "diagnostic"
+  );
+}
+
 #endif // MQTT_HA_DISCOVERY_H
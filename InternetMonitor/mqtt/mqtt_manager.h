@@ -7,9 +7,10 @@
  * 
  * Features:
  * - Runs in dedicated FreeRTOS task (won't block network checks)
- * - Automatic reconnection with rate limiting
+ * - Automatic reconnection with jittered exponential backoff
  * - Home Assistant auto-discovery
- * - State publishing with configurable interval
+ * - State publishing with configurable interval, and at once on state
+ *   changes (woken by the event bus instead of polling)
  * - Last Will Testament for offline detection
  */
 
@@ -19,9 +20,12 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include "../config.h"
+#include "../core/jitter.h"
+#include "../core/events.h"
 #include "mqtt_config.h"
 #include "mqtt_payloads.h"
 #include "mqtt_ha_discovery.h"
+#include "../system/task_layout.h"
 
 // ===========================================
 // EXTERNAL DECLARATIONS
@@ -40,18 +44,20 @@ PubSubClient mqttClient(mqttWifiClient);
 // Task handle for MQTT task
 TaskHandle_t mqttTaskHandle = NULL;
 
-// Track state changes for immediate publishing
-static volatile int lastPublishedState = -1;
+// Move to activeLayout.mqttCore (set by applyTaskLayout())
+static volatile bool mqttTaskRelocate = false;
+
 static volatile bool haDiscoveryPublished = false;
 
+// Reconnect jitter (MQTT task only), seeded per device
+static uint32_t mqttJitter = 0;
+static bool mqttStartSpread = false;  // Boot spread applied once
+
 // ===========================================
 // MQTT TASK SETTINGS
 // ===========================================
 
-#define MQTT_TASK_STACK_SIZE  4096
-#define MQTT_TASK_PRIORITY    1       // Same as network task
-#define MQTT_TASK_CORE        1       // Run on Core 1
-#define MQTT_LOOP_DELAY_MS    100     // Check every 100ms
+#define MQTT_TASK_STACK_SIZE  4096      // Core/priority: activeLayout
 #define MQTT_SOCKET_TIMEOUT   2       // 2 second socket timeout (short!)
 
 // ===========================================
@@ -64,13 +70,33 @@ void mqttCallback(char* topic, byte* payload, unsigned int length) {
   Serial.println(topic);
 }
 
+// ===========================================
+// RECONNECT BACKOFF
+// ===========================================
+
+/**
+ * Delay before the next attempt after `failures` failed ones
+ * Doubles from MQTT_RECONNECT_INTERVAL_MS up to MQTT_RECONNECT_MAX_MS,
+ * then picks a random point in the upper half so units that lost the
+ * broker together don't retry together.
+ */
+inline unsigned long mqttBackoffMs(int failures) {
+  unsigned long base = MQTT_RECONNECT_INTERVAL_MS;
+  for (int i = 1; i < failures && base < MQTT_RECONNECT_MAX_MS; i++) {
+    base *= 2;
+  }
+  if (base > MQTT_RECONNECT_MAX_MS) base = MQTT_RECONNECT_MAX_MS;
+  return base / 2 + jitterBelow(mqttJitter, base / 2);
+}
+
 // ===========================================
 // MQTT CONNECTION (called from MQTT task only)
 // ===========================================
 
 /**
  * Connect to MQTT broker
- * Rate-limited to prevent hammering broker on failures.
+ * Rate-limited by mqttConfig.reconnectDelayMs to prevent hammering
+ * the broker on failures.
  * May block for up to MQTT_SOCKET_TIMEOUT seconds.
  * 
  * @return true if connected successfully
@@ -86,7 +112,7 @@ inline bool mqttConnect() {
   
   // Rate limit reconnection attempts
   unsigned long now = millis();
-  if (now - mqttConfig.lastConnectAttempt < MQTT_RECONNECT_INTERVAL_MS) {
+  if (now - mqttConfig.lastConnectAttempt < mqttConfig.reconnectDelayMs) {
     return false;
   }
   mqttConfig.lastConnectAttempt = now;
@@ -123,6 +149,7 @@ inline bool mqttConnect() {
     Serial.println("connected!");
     mqttConfig.connected = true;
     mqttConfig.connectionFailures = 0;
+    mqttConfig.reconnectDelayMs = 0;
     
     // Publish online status
     mqttClient.publish(availTopic.c_str(), "online", true);
@@ -132,9 +159,11 @@ inline bool mqttConnect() {
     
     return true;
   } else {
-    Serial.printf("failed (rc=%d)\n", mqttClient.state());
     mqttConfig.connected = false;
     mqttConfig.connectionFailures++;
+    mqttConfig.reconnectDelayMs = mqttBackoffMs(mqttConfig.connectionFailures);
+    Serial.printf("failed (rc=%d), retry in %lu s\n", mqttClient.state(),
+      mqttConfig.reconnectDelayMs / 1000);
     return false;
   }
 }
@@ -205,47 +234,154 @@ inline void mqttPublishHADiscovery() {
   ok = mqttClient.publish(topic.c_str(), payload.c_str(), true);
   Serial.printf("[MQTT] -> %s (%d bytes) %s\n", topic.c_str(), payload.length(), ok?"OK":"FAIL");
   
+  // Link quality sensor
+  topic = mqttConfig.getHADiscoveryTopic("sensor", "link_quality");
+  payload = buildHADiscoveryLinkQuality();
+  ok = mqttClient.publish(topic.c_str(), payload.c_str(), true);
+  Serial.printf("[MQTT] -> %s (%d bytes) %s\n", topic.c_str(), payload.length(), ok?"OK":"FAIL");
+  
+  // Packet loss sensor
+  topic = mqttConfig.getHADiscoveryTopic("sensor", "packet_loss");
+  payload = buildHADiscoveryPacketLoss();
+  ok = mqttClient.publish(topic.c_str(), payload.c_str(), true);
+  Serial.printf("[MQTT] -> %s (%d bytes) %s\n", topic.c_str(), payload.length(), ok?"OK":"FAIL");
+  
+  // Jitter sensor
+  topic = mqttConfig.getHADiscoveryTopic("sensor", "jitter");
+  payload = buildHADiscoveryJitter();
+  ok = mqttClient.publish(topic.c_str(), payload.c_str(), true);
+  Serial.printf("[MQTT] -> %s (%d bytes) %s\n", topic.c_str(), payload.length(), ok?"OK":"FAIL");
+  
+  // Download speed sensor
+  topic = mqttConfig.getHADiscoveryTopic("sensor", "download");
+  payload = buildHADiscoveryDownload();
+  ok = mqttClient.publish(topic.c_str(), payload.c_str(), true);
+  Serial.printf("[MQTT] -> %s (%d bytes) %s\n", topic.c_str(), payload.length(), ok?"OK":"FAIL");
+  
+  // Upload speed sensor
+  topic = mqttConfig.getHADiscoveryTopic("sensor", "upload");
+  payload = buildHADiscoveryUpload();
+  ok = mqttClient.publish(topic.c_str(), payload.c_str(), true);
+  Serial.printf("[MQTT] -> %s (%d bytes) %s\n", topic.c_str(), payload.length(), ok?"OK":"FAIL");
+  
+  // Last state change sensor
+  topic = mqttConfig.getHADiscoveryTopic("sensor", "last_change");
+  payload = buildHADiscoveryLastChange();
+  ok = mqttClient.publish(topic.c_str(), payload.c_str(), true);
+  Serial.printf("[MQTT] -> %s (%d bytes) %s\n", topic.c_str(), payload.length(), ok?"OK":"FAIL");
+  
+  // CPU load sensors
+  topic = mqttConfig.getHADiscoveryTopic("sensor", "cpu_core0");
+  payload = buildHADiscoveryCpuCore0();
+  ok = mqttClient.publish(topic.c_str(), payload.c_str(), true);
+  Serial.printf("[MQTT] -> %s (%d bytes) %s\n", topic.c_str(), payload.length(), ok?"OK":"FAIL");
+  
+  topic = mqttConfig.getHADiscoveryTopic("sensor", "cpu_core1");
+  payload = buildHADiscoveryCpuCore1();
+  ok = mqttClient.publish(topic.c_str(), payload.c_str(), true);
+  Serial.printf("[MQTT] -> %s (%d bytes) %s\n", topic.c_str(), payload.length(), ok?"OK":"FAIL");
+  
   haDiscoveryPublished = true;
-  Serial.println("[MQTT] HA discovery published (8 entities)");
+  Serial.println("[MQTT] HA discovery published (16 entities)");
 }
 
 // ===========================================
 // STATUS PUBLISHING
 // ===========================================
 
-inline void mqttPublishStatus() {
+/**
+ * Publish the status payload
+ * @return true if the broker accepted it
+ */
+inline bool mqttPublishStatus() {
   if (!mqttClient.connected()) {
-    return;
+    return false;
   }
   
-  String topic = mqttConfig.getStateTopic();
-  String payload = buildMQTTPayload();
+  // Static: the MQTT task is the only publisher, and the payload is
+  // too big for its stack
+  static char payload[MQTT_PAYLOAD_MAX];
+  size_t length = buildMQTTPayload(payload, sizeof(payload));
+  if (length == 0) {
+    Serial.println("[MQTT] Payload too large, not published");
+    return false;
+  }
   
-  if (mqttClient.publish(topic.c_str(), payload.c_str(), true)) {
+  char topic[sizeof(mqttConfig.baseTopic) + 8];
+  mqttConfig.getTopic("state", topic, sizeof(topic));
+  if (mqttClient.publish(topic, (const uint8_t*)payload, length, true)) {
     mqttConfig.lastPublishTime = millis();
-    lastPublishedState = currentState;
-    Serial.printf("[MQTT] Published to %s\n", topic.c_str());
-  } else {
-    Serial.println("[MQTT] Publish failed!");
+    Serial.printf("[MQTT] Published to %s (%u bytes)\n", topic, (unsigned)length);
+    return true;
   }
+  Serial.println("[MQTT] Publish failed!");
+  return false;
 }
 
 // ===========================================
 // MQTT TASK (runs independently, can block)
 // ===========================================
 
+inline void startMqttTask();
+inline void mqttDisconnect();
+
+/**
+ * MQTT task: sleeps on its task notification and wakes for bus events,
+ * for the next interval publish, or every MQTT_IDLE_WAKE_MS to service
+ * the connection (keepalive, reconnect timing).
+ * On a core change it disconnects and starts its replacement itself.
+ */
 void mqttTask(void* parameter) {
   Serial.printf("[MQTT Task] Started on Core %d\n", xPortGetCoreID());
+  eventBindTask(EVENT_SUB_MQTT, xTaskGetCurrentTaskHandle());
+  bool publishPending = false;  // Event seen, publish as soon as connected
   
-  // Initial delay to let WiFi stabilize
-  vTaskDelay(pdMS_TO_TICKS(2000));
+  // Initial delay to let WiFi stabilize, plus a per-device spread after
+  // boot so a fleet coming back from a power cut doesn't hit the broker
+  // at once (not on restarts for config changes)
+  jitterSeed(mqttJitter, 2);
+  uint32_t startDelay = 2000;
+  if (!mqttStartSpread) {
+    mqttStartSpread = true;
+    startDelay += jitterBelow(mqttJitter, MQTT_STARTUP_SPREAD_MS);
+  }
+  vTaskDelay(pdMS_TO_TICKS(startDelay));
   
   while (true) {
+    // Between passes, nothing in flight on the client: hand over to a
+    // task on the new core (never deleted from outside mid-connect)
+    if (mqttTaskRelocate) {
+      eventBindTask(EVENT_SUB_MQTT, NULL);  // Replacement binds itself
+      mqttDisconnect();
+      mqttTaskHandle = NULL;
+      mqttTaskRelocate = false;
+      startMqttTask();
+      vTaskDelete(NULL);
+    }
+    
+    // Drain the bus (even while disconnected, so the ring doesn't overflow)
+    Event ev;
+    while (pollEvent(EVENT_SUB_MQTT, ev)) {
+      if (ev.type == EVENT_STATE && mqttConfig.publishOnStateChange) {
+        publishPending = true;
+        Serial.println("[MQTT] State changed, publishing immediately");
+      } else if (ev.type == EVENT_THROUGHPUT) {
+        publishPending = true;  // Fresh speed results
+      }
+    }
+    
     // Only run if MQTT is enabled and WiFi is connected
     if (mqttConfig.enabled && WiFi.status() == WL_CONNECTED) {
       
       // Ensure connected (may block for MQTT_SOCKET_TIMEOUT seconds)
       if (!mqttClient.connected()) {
+        if (mqttConfig.connected) {
+          // Just dropped. A broker restart drops every unit at the same
+          // moment, so spread the first retry too.
+          mqttConfig.lastConnectAttempt = millis();
+          mqttConfig.reconnectDelayMs = jitterBelow(mqttJitter, MQTT_RECONNECT_INTERVAL_MS);
+          Serial.printf("[MQTT] Connection lost, retry in %lu ms\n", mqttConfig.reconnectDelayMs);
+        }
         mqttConfig.connected = false;
         mqttConnect();
       }
@@ -262,23 +398,10 @@ void mqttTask(void* parameter) {
           mqttPublishHADiscovery();
         }
         
-        // Check if we should publish status
+        // Publish on interval or after a state change
         unsigned long now = millis();
-        bool shouldPublish = false;
-        
-        // Publish on interval
-        if (now - mqttConfig.lastPublishTime >= mqttConfig.publishIntervalMs) {
-          shouldPublish = true;
-        }
-        
-        // Publish on state change
-        if (mqttConfig.publishOnStateChange && currentState != lastPublishedState) {
-          shouldPublish = true;
-          Serial.println("[MQTT] State changed, publishing immediately");
-        }
-        
-        if (shouldPublish) {
-          mqttPublishStatus();
+        if (publishPending || now - mqttConfig.lastPublishTime >= mqttConfig.publishIntervalMs) {
+          if (mqttPublishStatus()) publishPending = false;
         }
       }
     } else {
@@ -288,8 +411,15 @@ void mqttTask(void* parameter) {
       }
     }
     
-    // Short delay - FreeRTOS will schedule other tasks
-    vTaskDelay(pdMS_TO_TICKS(MQTT_LOOP_DELAY_MS));
+    // Sleep until an event, the next interval publish or the idle wakeup
+    unsigned long waitMs = MQTT_IDLE_WAKE_MS;
+    if (mqttConfig.connected) {
+      unsigned long sincePublish = millis() - mqttConfig.lastPublishTime;
+      unsigned long untilPublish = sincePublish < mqttConfig.publishIntervalMs
+        ? mqttConfig.publishIntervalMs - sincePublish : MQTT_IDLE_WAKE_MS;  // Overdue = last publish failed
+      if (untilPublish < waitMs) waitMs = untilPublish;
+    }
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
   }
 }
 
@@ -307,12 +437,12 @@ inline void startMqttTask() {
     "MQTT",
     MQTT_TASK_STACK_SIZE,
     NULL,
-    MQTT_TASK_PRIORITY,
+    activeLayout.mqttPriority,
     &mqttTaskHandle,
-    MQTT_TASK_CORE
+    activeLayout.mqttCore
   );
   
-  Serial.println("[MQTT] Task created on Core 1");
+  Serial.printf("[MQTT] Task created on Core %u\n", activeLayout.mqttCore);
 }
 
 // ===========================================
@@ -348,6 +478,7 @@ inline bool mqttTestConnection() {
   
   // Force immediate connection attempt
   mqttConfig.lastConnectAttempt = 0;
+  mqttConfig.reconnectDelayMs = 0;
   bool result = mqttConnect();
   
   // Restore enabled state
@@ -371,6 +502,7 @@ inline void mqttResetHADiscovery() {
 
 inline void stopMqttTask() {
   if (mqttTaskHandle != NULL) {
+    eventBindTask(EVENT_SUB_MQTT, NULL);  // Stop notifying before it goes
     mqttDisconnect();
     vTaskDelete(mqttTaskHandle);
     mqttTaskHandle = NULL;
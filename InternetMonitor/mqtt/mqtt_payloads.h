@@ -3,15 +3,15 @@
 
 /**
  * @file mqtt_payloads.h
- * @brief MQTT JSON payload builders using ArduinoJson
+ * @brief MQTT payload builders
  */
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <ArduinoJson.h>
 #include "../config.h"
 #include "../core/types.h"
 #include "../core/state.h"
+#include "../system/metrics.h"
 #include "mqtt_config.h"
 
 // ===========================================
@@ -20,93 +20,28 @@
 
 extern volatile int currentState;
 extern SystemStats stats;
-extern PerformanceMetrics perf;
-
-// ===========================================
-// STATE TEXT HELPERS
-// ===========================================
-
-/**
- * Get machine-readable state text
- */
-inline const char* getStateText(int state) {
-  switch (state) {
-    case STATE_INTERNET_OK: return "online";
-    case STATE_INTERNET_DEGRADED: return "degraded";
-    case STATE_INTERNET_DOWN: return "offline";
-    case STATE_WIFI_LOST: return "no_wifi";
-    case STATE_CONFIG_PORTAL: return "setup";
-    case STATE_CONNECTING_WIFI: return "connecting";
-    case STATE_BOOTING: return "booting";
-    default: return "unknown";
-  }
-}
-
-/**
- * Get human-friendly state text
- */
-inline const char* getStateFriendly(int state) {
-  switch (state) {
-    case STATE_INTERNET_OK: return "Online";
-    case STATE_INTERNET_DEGRADED: return "Degraded";
-    case STATE_INTERNET_DOWN: return "Offline";
-    case STATE_WIFI_LOST: return "No WiFi";
-    case STATE_CONFIG_PORTAL: return "Setup Mode";
-    case STATE_CONNECTING_WIFI: return "Connecting";
-    case STATE_BOOTING: return "Booting";
-    default: return "Unknown";
-  }
-}
 
 // ===========================================
 // JSON PAYLOAD BUILDER
 // ===========================================
 
 /**
- * Build complete MQTT status payload
- * Uses ArduinoJson for clean serialization
- * @return JSON string with all status fields
+ * Build the MQTT status payload (the MQTT side of the metrics schema)
+ * Written into the caller's buffer; nothing is allocated.
+ * @param buf Destination, NUL-terminated
+ * @param len Size of buf
+ * @return Payload length, 0 if it didn't fit
  */
-inline String buildMQTTPayload() {
-  JsonDocument doc;
-  
-  float successRate = stats.totalChecks > 0 
-    ? (100.0f * stats.successfulChecks / stats.totalChecks) 
-    : 100.0f;
-  
-  unsigned long uptimeSeconds = (millis() - stats.bootTime) / 1000;
-  
-  // Status info
-  doc["status"] = getStateText(currentState);
-  doc["state"] = currentState;
-  doc["state_text"] = getStateFriendly(currentState);
-  
-  // Uptime and checks
-  doc["uptime_seconds"] = uptimeSeconds;
-  doc["total_checks"] = stats.totalChecks;
-  doc["successful_checks"] = stats.successfulChecks;
-  doc["failed_checks"] = stats.failedChecks;
-  doc["success_rate"] = serialized(String(successRate, 1));
-  doc["consecutive_failures"] = stats.consecutiveFailures;
-  
-  // Downtime tracking
-  doc["last_outage_seconds"] = stats.lastDowntime / 1000;
-  doc["total_downtime_seconds"] = stats.totalDowntimeMs / 1000;
-  
-  // Network info
-  doc["wifi_rssi"] = WiFi.RSSI();
-  doc["wifi_ssid"] = WiFi.SSID();
-  doc["ip_address"] = WiFi.localIP().toString();
-  
-  // System info
-  doc["free_heap"] = ESP.getFreeHeap();
-  doc["temperature"] = serialized(String(temperatureRead(), 1));
-  doc["led_fps"] = serialized(String(perf.ledActualFPS, 1));
-  doc["firmware"] = FW_VERSION;
-  
-  String output;
-  serializeJson(doc, output);
-  return output;
+inline size_t buildMQTTPayload(char* buf, size_t len) {
+  MetricsSnapshot m;
+  captureMetrics(m);
+
+  JsonWriter out(buf, len);
+  out.beginObject();
+  writeMetricFields(out, m, METRICS_MQTT);
+  out.endObject();
+  out.finish();
+  return out.overflow() ? 0 : out.length();
 }
 
 // ===========================================
@@ -118,14 +53,13 @@ inline String buildStatusValue() {
 }
 
 inline String buildUptimeValue() {
-  return String((millis() - stats.bootTime) / 1000);
+  return String((unsigned long)((clockMonoMs() - stats.bootTime) / 1000));
 }
 
 inline String buildSuccessRateValue() {
-  float rate = stats.totalChecks > 0 
-    ? (100.0f * stats.successfulChecks / stats.totalChecks) 
-    : 100.0f;
-  return String(rate, 1);
+  SystemStats snap;
+  statsSnapshot(snap);
+  return String(statsSuccessRate(snap), 1);
 }
 
 inline String buildRSSIValue() {
@@ -0,0 +1,175 @@
+#ifndef NETWORK_CONNECTION_POOL_H
+#define NETWORK_CONNECTION_POOL_H
+
+/**
+ * @file connection_pool.h
+ * @brief Keep-alive connection pool for HTTP probe targets
+ *
+ * A single shared HTTPClient reconnects whenever the host changes, and
+ * round-robin probing changes host on almost every check, so every probe
+ * used to pay a TCP handshake. The pool keeps one WiFiClient/HTTPClient
+ * pair per host:port (LRU, PROBE_POOL_SIZE slots) open between checks.
+ *
+ * Stale sockets: slots idle longer than PROBE_POOL_IDLE_MS are closed
+ * before use (servers drop idle keep-alives), and a reused socket that
+ * fails anyway is retried once on a fresh connection.
+ *
+ * Probes only need the status, but a socket is only reusable once the
+ * whole body is off it: up to PROBE_POOL_DRAIN_MAX Content-Length bytes
+ * are read and dropped, anything larger or without a length is closed.
+ *
+ * Only the network task touches the pool; web handlers read poolStats.
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include "../config.h"
+#include "url.h"
+
+// ===========================================
+// POOL STRUCTS
+// ===========================================
+
+struct PooledConnection {
+  WiFiClient client;
+  HTTPClient http;
+  char host[64] = "";
+  uint16_t port = 0;
+  unsigned long lastUsed = 0;
+};
+
+struct ConnectionPoolStats {
+  unsigned long reused = 0;     // Requests that skipped the TCP handshake
+  unsigned long opened = 0;     // Requests on a fresh connection
+  unsigned long stale = 0;      // Reused sockets the server had already closed
+  unsigned long evicted = 0;    // Closed for idle age or to free a slot
+};
+
+static PooledConnection connectionPool[PROBE_POOL_SIZE];
+static ConnectionPoolStats poolStats;
+
+// ===========================================
+// SLOT MANAGEMENT
+// ===========================================
+
+/**
+ * Find the slot for host:port, or take over the least recently used one
+ * @param host Host name
+ * @param port TCP port
+ * @return Slot (connected or not)
+ */
+inline PooledConnection& acquireConnection(const char* host, uint16_t port) {
+  int lru = 0;
+  for (int i = 0; i < PROBE_POOL_SIZE; i++) {
+    PooledConnection& c = connectionPool[i];
+    if (c.port == port && strcmp(c.host, host) == 0) {
+      // Server has likely timed out the keep-alive, don't gamble on it
+      if (c.client.connected() && millis() - c.lastUsed > PROBE_POOL_IDLE_MS) {
+        c.client.stop();
+        poolStats.evicted++;
+      }
+      return c;
+    }
+    if (connectionPool[i].lastUsed < connectionPool[lru].lastUsed) lru = i;
+  }
+
+  PooledConnection& c = connectionPool[lru];
+  if (c.client.connected()) {
+    c.client.stop();
+    poolStats.evicted++;
+  }
+  strlcpy(c.host, host, sizeof(c.host));
+  c.port = port;
+  c.lastUsed = 0;
+  return c;
+}
+
+/**
+ * Close every pooled connection (WiFi lost, probe list replaced)
+ */
+inline void resetConnectionPool() {
+  for (int i = 0; i < PROBE_POOL_SIZE; i++) {
+    connectionPool[i].client.stop();
+    connectionPool[i].host[0] = '\0';
+    connectionPool[i].port = 0;
+    connectionPool[i].lastUsed = 0;
+  }
+}
+
+// ===========================================
+// POOLED REQUEST
+// ===========================================
+
+/**
+ * Read and drop the response body so the socket can carry the next request
+ * @param c Slot after GET()
+ * @param timeoutMs Give up (and close) after this long
+ * @return true if the whole body was read
+ */
+inline bool drainBody(PooledConnection& c, uint16_t timeoutMs) {
+  int remaining = c.http.getSize();
+  if (remaining == 0) return true;
+  if (remaining < 0 || remaining > PROBE_POOL_DRAIN_MAX) return false;
+
+  uint8_t discard[128];
+  unsigned long start = millis();
+  while (remaining > 0 && millis() - start < timeoutMs) {
+    if (!c.client.available()) {
+      if (!c.client.connected()) return false;
+      delay(1);
+      continue;
+    }
+    int n = c.client.read(discard, min((int)sizeof(discard), remaining));
+    if (n <= 0) return false;
+    remaining -= n;
+  }
+  return remaining == 0;
+}
+
+/**
+ * HTTP GET over a pooled keep-alive connection
+ * @param url http:// URL
+ * @param timeoutMs Connect and response timeout
+ * @return HTTP status code, or a negative HTTPClient error
+ */
+inline int pooledGet(const char* url, uint16_t timeoutMs) {
+  char host[64];
+  uint16_t port;
+  const char* path;
+  if (!parseHttpUrl(url, host, sizeof(host), port, path)) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+
+  PooledConnection& c = acquireConnection(host, port);
+  int code = HTTPC_ERROR_CONNECTION_REFUSED;
+
+  for (int attempt = 0; attempt < 2; attempt++) {
+    bool reusing = c.client.connected();
+
+    c.http.setReuse(true);
+    c.http.setConnectTimeout(timeoutMs);
+    c.http.setTimeout(timeoutMs);
+    if (!c.http.begin(c.client, url)) {
+      return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+
+    code = c.http.GET();
+    bool drained = code > 0 && drainBody(c, timeoutMs);
+    c.http.end();  // Leaves the socket open if the server allows keep-alive
+    if (code > 0 && !drained) c.client.stop();  // Body left on it: not reusable
+    c.lastUsed = millis();
+
+    if (code > 0 || !reusing) {
+      if (reusing) poolStats.reused++; else poolStats.opened++;
+      return code;
+    }
+
+    // Socket looked alive but the server had closed it - retry fresh
+    poolStats.stale++;
+    c.client.stop();
+  }
+  return code;
+}
+
+#endif // NETWORK_CONNECTION_POOL_H
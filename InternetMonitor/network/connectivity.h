@@ -3,73 +3,184 @@
 
 /**
  * @file connectivity.h
- * @brief Internet connectivity checking via HTTP requests
- * 
- * Uses multiple fallback URLs (Google, Cloudflare) for reliability.
- * Implements connection reuse for performance.
- * Returns early on first successful check.
+ * @brief Internet connectivity checking against the probe target list
+ *
+ * Targets come from ProbeConfig (NVS, editable via /probes).
+ * Each check picks targets by smooth weighted round-robin and stops
+ * as soon as quorum is reached or can no longer be reached.
+ * HTTP targets go through the keep-alive pool (connection_pool.h) so
+ * repeat checks skip the TCP handshake. Every probe spends a token from
+ * the rate limiter (probe_schedule.h).
  */
 
 #include <Arduino.h>
+#include <WiFi.h>
 #include <HTTPClient.h>
 #include <esp_task_wdt.h>
 #include "../config.h"
+#include "../core/histogram.h"
+#include "probe_config.h"
+#include "connection_pool.h"
+#include "probe_schedule.h"
 
 // ===========================================
-// REUSABLE HTTP CLIENT
+// PER-TARGET RUNTIME STATUS (not persisted)
 // ===========================================
 
-extern HTTPClient httpClient;
-extern bool httpClientInitialized;
+struct ProbeTargetStatus {
+  unsigned long successes = 0;
+  unsigned long failures = 0;
+  uint32_t lastRttMs = 0;
+  bool lastOk = false;
+  int32_t wrrCurrent = 0;   // Smooth weighted round-robin score
+};
+
+// Only written by the network task; web handlers read it for display
+static ProbeTargetStatus probeStatus[MAX_PROBE_TARGETS];
+static uint32_t probeStatusRevision = 0;
+
+/**
+ * Reset runtime status if the target list changed since the last check
+ * Called by the network task before each check.
+ * @param revision Revision of the check's snapshot (from probeConfigSnapshot()),
+ *   so the status always matches the targets actually probed
+ */
+inline void syncProbeStatus(uint32_t revision) {
+  if (probeStatusRevision == revision) return;
+  probeStatusRevision = revision;
+  resetConnectionPool();  // Drop sockets to hosts that may no longer be targets
+  for (int i = 0; i < MAX_PROBE_TARGETS; i++) {
+    probeStatus[i] = ProbeTargetStatus();
+  }
+}
+
+// ===========================================
+// SINGLE TARGET CHECKS
+// ===========================================
+
+/**
+ * Check a single HTTP target
+ * @param target Target with URL, expected status and timeout
+ * @return true if the response status matched
+ */
+inline bool checkHttpTarget(const ProbeTarget& target) {
+  int code = pooledGet(target.url, target.timeoutMs);
+
+  if (target.expectStatus == 0) {
+    return (code == 204 || code == 200);
+  }
+  return code == target.expectStatus;
+}
+
+/**
+ * Check a single TCP target (connect only, no payload)
+ * Deliberately not pooled: the handshake is the thing being tested.
+ * @param target Target with "host:port" and timeout
+ * @return true if the connection was accepted
+ */
+inline bool checkTcpTarget(const ProbeTarget& target) {
+  char host[PROBE_URL_MAX_LEN];
+  strlcpy(host, target.url, sizeof(host));
+
+  char* colon = strrchr(host, ':');
+  if (!colon) return false;
+  *colon = '\0';
+  int port = atoi(colon + 1);
+  if (port <= 0 || port > 65535) return false;
+
+  WiFiClient client;
+  bool ok = client.connect(host, port, target.timeoutMs);
+  client.stop();
+  return ok;
+}
+
+/**
+ * Check one target and record its result
+ * @param index Index into cfg.targets
+ * @param cfg Config snapshot for this check
+ * @return true if the target passed
+ */
+inline bool checkTarget(int index, const ProbeConfig& cfg) {
+  const ProbeTarget& target = cfg.targets[index];
+  unsigned long start = millis();
+
+  bool ok = (target.type == PROBE_TCP) ? checkTcpTarget(target) : checkHttpTarget(target);
+
+  ProbeTargetStatus& st = probeStatus[index];
+  st.lastRttMs = millis() - start;
+  st.lastOk = ok;
+  if (ok) histObserve(probeRttHist, st.lastRttMs);
+  if (ok) st.successes++; else st.failures++;
+  return ok;
+}
 
 // ===========================================
-// CONNECTIVITY CHECK FUNCTIONS
+// TARGET SELECTION
 // ===========================================
 
 /**
- * Check connectivity to a single URL
- * @param url URL to check (expects 200 or 204 response)
- * @return true if URL responded successfully
+ * Pick the next target using smooth weighted round-robin
+ * Every candidate gains its weight, the highest score wins and pays
+ * back the total. Heavier targets are probed proportionally more often
+ * but picks stay interleaved rather than bunched.
+ *
+ * @param cfg Config snapshot
+ * @param triedMask Bitmask of targets already tried in this check
+ * @return Target index, or -1 if none left
  */
-inline bool checkSingleUrl(const char* url) {
-  // Reuse the global HTTP client for connection pooling
-  httpClient.setConnectTimeout(2000);
-  httpClient.setTimeout(3000);
-  httpClient.setReuse(true);  // Enable connection reuse
-  
-  if (!httpClient.begin(url)) {
-    return false;
+inline int pickNextTarget(const ProbeConfig& cfg, uint32_t triedMask) {
+  int best = -1;
+  int32_t total = 0;
+
+  for (int i = 0; i < cfg.count; i++) {
+    if (triedMask & (1UL << i)) continue;
+    probeStatus[i].wrrCurrent += cfg.targets[i].weight;
+    total += cfg.targets[i].weight;
+    if (best < 0 || probeStatus[i].wrrCurrent > probeStatus[best].wrrCurrent) {
+      best = i;
+    }
   }
-  
-  int code = httpClient.GET();
-  httpClient.end();
-  return (code == 204 || code == 200);
+
+  if (best >= 0) {
+    probeStatus[best].wrrCurrent -= total;
+  }
+  return best;
 }
 
+// ===========================================
+// CONNECTIVITY CHECK
+// ===========================================
+
 /**
- * Check internet connectivity by trying multiple URLs
- * Returns early on first success for performance.
+ * Check internet connectivity against the configured targets
+ * Tries up to cfg.maxAttempts targets, returning early once cfg.quorum
+ * have passed or once the remaining attempts can no longer reach it.
  * Resets watchdog between checks to prevent timeout.
- * 
- * @return Number of successful checks (0 = all failed, 1+ = connected)
+ *
+ * @param cfg Config snapshot (see probeConfigSnapshot())
+ * @return Number of successful targets (pass if >= cfg.quorum)
  */
-inline int checkInternet() {
+inline int checkInternet(const ProbeConfig& cfg) {
   int successes = 0;
-  
-  // Try up to 2 URLs, return early on first success
-  int maxChecks = min(2, numCheckUrls);
-  for (int i = 0; i < maxChecks; i++) {
+  uint32_t tried = 0;
+
+  for (int attempt = 0; attempt < cfg.maxAttempts; attempt++) {
+    // Quorum unreachable with the attempts left
+    if (successes + (cfg.maxAttempts - attempt) < cfg.quorum) break;
+
+    int index = pickNextTarget(cfg, tried);
+    if (index < 0) break;
+    if (!takeProbeToken()) break;  // Only if the caller skipped probeTokensReady()
+    tried |= (1UL << index);
+
     esp_task_wdt_reset();
-    
-    if (checkSingleUrl(checkUrls[i])) {
+    if (checkTarget(index, cfg)) {
       successes++;
-      esp_task_wdt_reset();
-      return successes;  // Early return on success
+      if (successes >= cfg.quorum) break;  // Early return on quorum
     }
-    
     esp_task_wdt_reset();
   }
-  
+
   return successes;
 }
 
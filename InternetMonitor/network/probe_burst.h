@@ -0,0 +1,169 @@
+#ifndef NETWORK_PROBE_BURST_H
+#define NETWORK_PROBE_BURST_H
+
+/**
+ * @file probe_burst.h
+ * @brief Packet loss and jitter measurement via ICMP probe bursts
+ *
+ * A single HTTP/TCP check only says "up" or "down". A burst sends
+ * cfg.burstCount small ICMP echoes at cfg.burstIntervalMs spacing
+ * (esp_ping, runs in its own short-lived task) and derives loss %,
+ * mean RTT and RFC 3550 interarrival jitter. These fold into a 0-100
+ * quality score which the state machine uses for STATE_INTERNET_DEGRADED.
+ *
+ * esp_ping waits for each reply (or BURST_TIMEOUT_MS) before sending the
+ * next echo, so spacing is max(interval, RTT).
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <esp_task_wdt.h>
+#include <ping/ping_sock.h>
+#include "../config.h"
+#include "../core/types.h"
+#include "probe_config.h"
+
+// ===========================================
+// BURST ACCUMULATOR (written from esp_ping callbacks)
+// ===========================================
+
+struct BurstAccumulator {
+  uint16_t received = 0;
+  uint32_t rttSumMs = 0;
+  uint32_t lastRttMs = 0;
+  bool haveLast = false;
+};
+
+static BurstAccumulator burstAcc;
+static SemaphoreHandle_t burstDone = NULL;
+
+// RFC 3550 estimator state. Kept across bursts (it's a running estimate
+// with 1/16 gain; restarting from zero every 50 samples would under-read).
+static float burstJitterMs = 0.0f;
+
+static void onBurstReply(esp_ping_handle_t hdl, void* args) {
+  uint32_t rtt = 0;
+  esp_ping_get_profile(hdl, ESP_PING_PROF_TIMEGAP, &rtt, sizeof(rtt));
+
+  // J += (|D(i-1,i)| - J) / 16, with D taken from consecutive RTTs
+  if (burstAcc.haveLast) {
+    float d = fabsf((float)rtt - (float)burstAcc.lastRttMs);
+    burstJitterMs += (d - burstJitterMs) / 16.0f;
+  }
+  burstAcc.lastRttMs = rtt;
+  burstAcc.haveLast = true;
+  burstAcc.rttSumMs += rtt;
+  burstAcc.received++;
+}
+
+static void onBurstTimeout(esp_ping_handle_t hdl, void* args) {
+  // Counted as lost (sent - received) when the session ends
+}
+
+static void onBurstEnd(esp_ping_handle_t hdl, void* args) {
+  xSemaphoreGive(burstDone);
+}
+
+// ===========================================
+// QUALITY SCORE
+// ===========================================
+
+/**
+ * Fold burst results into a 0-100 score
+ * Loss dominates: with the defaults 1 lost echo in 50 (2%) scores 84,
+ * 2 lost (4%) scores 68 and trips DEGRADED.
+ *
+ * @param lossPct Lost probes (%)
+ * @param rttMs Mean RTT of replies (ms)
+ * @param jitterMs Jitter estimate (ms)
+ * @return Score, 100 = perfect
+ */
+inline uint8_t computeQualityScore(float lossPct, float rttMs, float jitterMs) {
+  float score = 100.0f;
+  score -= lossPct * QUALITY_LOSS_PENALTY;
+  if (jitterMs > QUALITY_JITTER_FREE_MS) {
+    score -= (jitterMs - QUALITY_JITTER_FREE_MS) * QUALITY_JITTER_PENALTY;
+  }
+  if (rttMs > QUALITY_RTT_FREE_MS) {
+    score -= (rttMs - QUALITY_RTT_FREE_MS) / QUALITY_RTT_PENALTY_MS;
+  }
+  if (score < 0) score = 0;
+  return (uint8_t)(score + 0.5f);
+}
+
+// ===========================================
+// RUN A BURST
+// ===========================================
+
+/**
+ * Send one burst and update the quality metrics
+ * Blocks the calling task for roughly count * interval ms.
+ * Resets watchdog while waiting.
+ *
+ * @param cfg Config snapshot (burst host, count, interval)
+ * @param out Metrics to update (score/degraded are left to the caller)
+ * @return false if the host didn't resolve or the session failed to start
+ */
+inline bool runProbeBurst(const ProbeConfig& cfg, QualityMetrics& out) {
+  IPAddress ip;
+  if (!WiFi.hostByName(cfg.burstHost, ip)) {
+    Serial.printf("[Burst] Can't resolve %s\n", cfg.burstHost);
+    return false;
+  }
+
+  if (burstDone == NULL) {
+    burstDone = xSemaphoreCreateBinary();
+  }
+  xSemaphoreTake(burstDone, 0);  // Clear any stale signal
+  burstAcc = BurstAccumulator();
+
+  esp_ping_config_t pingConfig = ESP_PING_DEFAULT_CONFIG();
+  IP_ADDR4(&pingConfig.target_addr, ip[0], ip[1], ip[2], ip[3]);
+  pingConfig.count = cfg.burstCount;
+  pingConfig.interval_ms = cfg.burstIntervalMs;
+  pingConfig.timeout_ms = BURST_TIMEOUT_MS;
+  pingConfig.data_size = BURST_PAYLOAD_SIZE;
+
+  esp_ping_callbacks_t cbs = {};
+  cbs.on_ping_success = onBurstReply;
+  cbs.on_ping_timeout = onBurstTimeout;
+  cbs.on_ping_end = onBurstEnd;
+
+  esp_ping_handle_t session;
+  if (esp_ping_new_session(&pingConfig, &cbs, &session) != ESP_OK) {
+    Serial.println("[Burst] Failed to start ping session");
+    return false;
+  }
+  esp_ping_start(session);
+
+  // Worst case every probe times out
+  unsigned long start = millis();
+  unsigned long limit = (unsigned long)cfg.burstCount * (cfg.burstIntervalMs + BURST_TIMEOUT_MS) + 1000;
+  while (xSemaphoreTake(burstDone, pdMS_TO_TICKS(500)) != pdTRUE) {
+    esp_task_wdt_reset();
+    if (millis() - start > limit) {
+      esp_ping_stop(session);
+      xSemaphoreTake(burstDone, pdMS_TO_TICKS(BURST_TIMEOUT_MS + 100));
+      break;
+    }
+  }
+
+  uint32_t sent = 0;
+  esp_ping_get_profile(session, ESP_PING_PROF_REQUEST, &sent, sizeof(sent));
+  esp_ping_delete_session(session);
+
+  if (sent == 0) return false;
+
+  out.sent = sent;
+  out.received = burstAcc.received;
+  out.lossPct = 100.0f * (sent - burstAcc.received) / sent;
+  out.rttMs = burstAcc.received > 0 ? (float)burstAcc.rttSumMs / burstAcc.received : 0.0f;
+  out.jitterMs = burstJitterMs;
+  out.bursts++;
+  out.lastBurstTime = millis();
+  return true;
+}
+
+#endif // NETWORK_PROBE_BURST_H
@@ -0,0 +1,178 @@
+#ifndef NETWORK_PROBE_CONFIG_H
+#define NETWORK_PROBE_CONFIG_H
+
+/**
+ * @file probe_config.h
+ * @brief Runtime probe target list and NVS persistence
+ *
+ * Defines the ProbeConfig struct (targets, quorum, attempts per check,
+ * loss/jitter burst settings) and functions for loading/saving it to non-volatile storage.
+ * The list is seeded from checkUrls[] in config.h on first boot.
+ */
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "../config.h"
+
+// ===========================================
+// PROBE TYPES
+// ===========================================
+
+enum ProbeType : uint8_t {
+  PROBE_HTTP = 0,   // HTTP GET, checks response status
+  PROBE_TCP = 1     // TCP connect to host:port
+};
+
+// Bump when the ProbeConfig layout changes (stale blobs fall back to defaults)
+#define PROBE_CONFIG_VERSION  2
+
+// ===========================================
+// PROBE CONFIGURATION STRUCTS
+// ===========================================
+
+struct ProbeTarget {
+  char url[PROBE_URL_MAX_LEN] = "";   // http://host/path or host:port
+  uint8_t type = PROBE_HTTP;
+  uint8_t weight = PROBE_DEFAULT_WEIGHT;
+  uint16_t expectStatus = 0;          // 0 = accept 200 or 204
+  uint16_t timeoutMs = PROBE_DEFAULT_TIMEOUT;
+};
+
+struct ProbeConfig {
+  uint8_t version = PROBE_CONFIG_VERSION;
+  uint8_t count = 0;
+  uint8_t quorum = PROBE_DEFAULT_QUORUM;        // Successes needed to pass
+  uint8_t maxAttempts = PROBE_DEFAULT_ATTEMPTS; // Targets tried per check
+  ProbeTarget targets[MAX_PROBE_TARGETS];
+
+  // Loss/jitter bursts (see probe_burst.h)
+  bool burstEnabled = BURST_DEFAULT_ENABLED;
+  uint8_t burstCount = BURST_DEFAULT_COUNT;
+  uint8_t burstEvery = BURST_DEFAULT_EVERY;     // Burst after every Nth passing check
+  uint16_t burstIntervalMs = BURST_DEFAULT_INTERVAL;
+  char burstHost[BURST_HOST_MAX_LEN] = BURST_DEFAULT_HOST;
+};
+
+// ===========================================
+// GLOBAL PROBE CONFIG INSTANCE
+// ===========================================
+
+extern ProbeConfig probeConfig;
+extern portMUX_TYPE probeMux;
+extern Preferences preferences;
+
+// Bumped on every apply so the network task can reset per-target stats
+static volatile uint32_t probeConfigRevision = 0;
+
+// ===========================================
+// HELPERS
+// ===========================================
+
+inline const char* probeTypeName(uint8_t type) {
+  return type == PROBE_TCP ? "tcp" : "http";
+}
+
+inline int probeTypeFromName(const char* name) {
+  if (strcmp(name, "http") == 0) return PROBE_HTTP;
+  if (strcmp(name, "tcp") == 0) return PROBE_TCP;
+  return -1;
+}
+
+/**
+ * Clamp quorum and attempts so a check can always reach quorum,
+ * and burst settings to usable values
+ * @param cfg Config to normalize in place
+ */
+inline void normalizeProbeConfig(ProbeConfig& cfg) {
+  if (cfg.count > MAX_PROBE_TARGETS) cfg.count = MAX_PROBE_TARGETS;
+  if (cfg.maxAttempts < 1) cfg.maxAttempts = 1;
+  if (cfg.maxAttempts > cfg.count) cfg.maxAttempts = cfg.count;
+  if (cfg.quorum < 1) cfg.quorum = 1;
+  if (cfg.quorum > cfg.maxAttempts) cfg.quorum = cfg.maxAttempts;
+  if (cfg.burstCount < 2) cfg.burstCount = 2;   // Jitter needs two replies
+  if (cfg.burstEvery < 1) cfg.burstEvery = 1;
+  cfg.burstHost[sizeof(cfg.burstHost) - 1] = '\0';
+}
+
+/**
+ * Fill config with the compile-time defaults from checkUrls[]
+ * @param cfg Config to overwrite
+ */
+inline void setDefaultProbeConfig(ProbeConfig& cfg) {
+  cfg = ProbeConfig();
+  int n = min(numCheckUrls, MAX_PROBE_TARGETS);
+  for (int i = 0; i < n; i++) {
+    strlcpy(cfg.targets[i].url, checkUrls[i], sizeof(cfg.targets[i].url));
+  }
+  cfg.count = n;
+  normalizeProbeConfig(cfg);
+}
+
+// ===========================================
+// THREAD-SAFE ACCESS
+// ===========================================
+
+/**
+ * Copy the live config (network task takes one snapshot per check)
+ * @param out Destination copy
+ * @return Revision of the copy (see syncProbeStatus())
+ */
+inline uint32_t probeConfigSnapshot(ProbeConfig& out) {
+  portENTER_CRITICAL(&probeMux);
+  out = probeConfig;
+  uint32_t revision = probeConfigRevision;
+  portEXIT_CRITICAL(&probeMux);
+  return revision;
+}
+
+/**
+ * Replace the live config (takes effect on the next check)
+ * @param cfg New config, already validated
+ */
+inline void probeConfigApply(const ProbeConfig& cfg) {
+  portENTER_CRITICAL(&probeMux);
+  probeConfig = cfg;
+  probeConfigRevision++;
+  portEXIT_CRITICAL(&probeMux);
+}
+
+// ===========================================
+// NVS PERSISTENCE FUNCTIONS
+// ===========================================
+
+inline void loadProbeConfigFromNVS() {
+  ProbeConfig cfg;
+  bool loaded = false;
+
+  preferences.begin(NVS_NAMESPACE, true);  // read-only
+  if (preferences.getBytesLength(NVS_KEY_PROBES) == sizeof(ProbeConfig)) {
+    preferences.getBytes(NVS_KEY_PROBES, &cfg, sizeof(ProbeConfig));
+    loaded = (cfg.version == PROBE_CONFIG_VERSION && cfg.count > 0);
+  }
+  preferences.end();
+
+  if (!loaded) {
+    setDefaultProbeConfig(cfg);
+  }
+  normalizeProbeConfig(cfg);
+  probeConfigApply(cfg);
+
+  Serial.printf("[Probe] %s %d targets (quorum %d of %d)\n",
+    loaded ? "Loaded" : "Default", cfg.count, cfg.quorum, cfg.maxAttempts);
+}
+
+inline void saveProbeConfigToNVS(const ProbeConfig& cfg) {
+  preferences.begin(NVS_NAMESPACE, false);  // read-write
+  preferences.putBytes(NVS_KEY_PROBES, &cfg, sizeof(ProbeConfig));
+  preferences.end();
+
+  Serial.println("[Probe] Config saved to NVS");
+}
+
+inline void clearProbeConfigFromNVS() {
+  preferences.begin(NVS_NAMESPACE, false);
+  preferences.remove(NVS_KEY_PROBES);
+  preferences.end();
+}
+
+#endif // NETWORK_PROBE_CONFIG_H
@@ -0,0 +1,101 @@
+#ifndef NETWORK_PROBE_SCHEDULE_H
+#define NETWORK_PROBE_SCHEDULE_H
+
+/**
+ * @file probe_schedule.h
+ * @brief Check timing (per-device phase and jitter) and probe rate limit
+ *
+ * Units on the same network that boot together would all probe the same
+ * targets at the same instant every CHECK_INTERVAL. Instead each unit
+ * starts at a MAC-derived phase within the first interval and jitters
+ * every following interval by ±CHECK_JITTER_PCT, so a fleet spreads out
+ * and stays spread out.
+ *
+ * A token bucket caps target probes (HTTP/TCP) at PROBE_RATE_PER_MIN.
+ * A check only starts once a whole check's worth of tokens is there,
+ * so a check is delayed, never cut short and misread as a failure.
+ * This matters during outages, when every check uses all its attempts.
+ *
+ * Only the network task writes this; web handlers read it for display.
+ */
+
+#include <Arduino.h>
+#include "../config.h"
+#include "../core/jitter.h"
+
+// ===========================================
+// SCHEDULE STATE
+// ===========================================
+
+struct ProbeSchedule {
+  uint32_t jitter = 0;          // Jitter state (see jitter.h)
+  uint32_t phaseMs = 0;         // Offset of the first check after boot
+  uint32_t delayMs = 0;         // Wait before the next check
+  float tokens = PROBE_BUCKET_SIZE;
+  unsigned long lastRefill = 0;
+  bool waiting = false;         // Check due but held for tokens
+  unsigned long deferred = 0;   // Checks held back by the rate limit
+};
+
+static ProbeSchedule probeSchedule;
+
+/**
+ * Pick this device's phase (call once when the network task starts)
+ * @param lastCheck Set to now, so the first check runs phaseMs from here
+ */
+inline void initProbeSchedule(unsigned long& lastCheck) {
+  jitterSeed(probeSchedule.jitter, 1);
+  probeSchedule.phaseMs = jitterBelow(probeSchedule.jitter, CHECK_INTERVAL);
+  probeSchedule.delayMs = probeSchedule.phaseMs;
+  probeSchedule.lastRefill = millis();
+  lastCheck = millis();
+  Serial.printf("[Schedule] First check in %lu ms, then every %d ms ±%d%%, max %d probes/min\n",
+    (unsigned long)probeSchedule.phaseMs, CHECK_INTERVAL, CHECK_JITTER_PCT, PROBE_RATE_PER_MIN);
+}
+
+/**
+ * Draw the wait before the next check (CHECK_INTERVAL ± jitter)
+ */
+inline void scheduleNextCheck() {
+  probeSchedule.delayMs = jitterAround(probeSchedule.jitter, CHECK_INTERVAL, CHECK_JITTER_PCT);
+}
+
+// ===========================================
+// TOKEN BUCKET
+// ===========================================
+
+inline void refillProbeTokens() {
+  unsigned long now = millis();
+  probeSchedule.tokens += (now - probeSchedule.lastRefill) * (PROBE_RATE_PER_MIN / 60000.0f);
+  if (probeSchedule.tokens > PROBE_BUCKET_SIZE) probeSchedule.tokens = PROBE_BUCKET_SIZE;
+  probeSchedule.lastRefill = now;
+}
+
+/**
+ * Check whether a whole check fits in the bucket
+ * @param attempts Most probes the check may use (cfg.maxAttempts)
+ * @return true to run the check now, false to hold it
+ */
+inline bool probeTokensReady(int attempts) {
+  refillProbeTokens();
+  bool ready = probeSchedule.tokens >= min(attempts, PROBE_BUCKET_SIZE);
+  if (!ready && !probeSchedule.waiting) {
+    probeSchedule.deferred++;
+    Serial.printf("[Schedule] Rate limit, check held (%.1f tokens)\n", probeSchedule.tokens);
+  }
+  probeSchedule.waiting = !ready;
+  return ready;
+}
+
+/**
+ * Spend one token before probing a target
+ * @return false if the bucket is empty (stop probing)
+ */
+inline bool takeProbeToken() {
+  refillProbeTokens();
+  if (probeSchedule.tokens < 1.0f) return false;
+  probeSchedule.tokens -= 1.0f;
+  return true;
+}
+
+#endif // NETWORK_PROBE_SCHEDULE_H
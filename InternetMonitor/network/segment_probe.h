@@ -0,0 +1,269 @@
+#ifndef NETWORK_SEGMENT_PROBE_H
+#define NETWORK_SEGMENT_PROBE_H
+
+/**
+ * @file segment_probe.h
+ * @brief LAN vs WAN fault isolation (gateway, DNS resolver, WAN IP)
+ *
+ * Started just before the WAN checks and collected just after, so they
+ * run in parallel and add little to check time:
+ * - Gateway: ICMP echoes to WiFi.gatewayIP() (esp_ping task)
+ * - WAN IP:  ICMP echoes to SEGMENT_WAN_IP, an IP literal that needs no DNS
+ * - DNS:     a raw UDP A query sent straight to the DHCP-provided resolvers,
+ *            bypassing the lwIP DNS cache
+ *
+ * The results let the state machine report ROUTER_UNREACHABLE or
+ * DNS_FAILING instead of a generic INTERNET_DOWN.
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <ping/ping_sock.h>
+#include "../config.h"
+#include "../core/types.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern SegmentStatus segment;
+
+// ===========================================
+// ASYNC PING (one esp_ping session, polled later)
+// ===========================================
+
+struct AsyncPing {
+  esp_ping_handle_t session = NULL;
+  SemaphoreHandle_t done = NULL;
+  volatile uint16_t replies = 0;
+  volatile uint32_t rttSumMs = 0;
+};
+
+static void onAsyncPingReply(esp_ping_handle_t hdl, void* args) {
+  AsyncPing* p = (AsyncPing*)args;
+  uint32_t rtt = 0;
+  esp_ping_get_profile(hdl, ESP_PING_PROF_TIMEGAP, &rtt, sizeof(rtt));
+  p->rttSumMs += rtt;
+  p->replies++;
+}
+
+static void onAsyncPingEnd(esp_ping_handle_t hdl, void* args) {
+  xSemaphoreGive(((AsyncPing*)args)->done);
+}
+
+/**
+ * Start pinging in the background
+ * @param p Ping state (must stay alive until asyncPingCollect())
+ * @param ip Target address
+ * @param count Echoes to send
+ * @return true if the session started
+ */
+inline bool asyncPingStart(AsyncPing& p, IPAddress ip, uint8_t count) {
+  if (p.done == NULL) {
+    p.done = xSemaphoreCreateBinary();
+  }
+  xSemaphoreTake(p.done, 0);
+  p.replies = 0;
+  p.rttSumMs = 0;
+  p.session = NULL;
+
+  esp_ping_config_t pingConfig = ESP_PING_DEFAULT_CONFIG();
+  IP_ADDR4(&pingConfig.target_addr, ip[0], ip[1], ip[2], ip[3]);
+  pingConfig.count = count;
+  pingConfig.interval_ms = GATEWAY_PING_INTERVAL;
+  pingConfig.timeout_ms = GATEWAY_PING_TIMEOUT;
+  pingConfig.data_size = 8;
+
+  esp_ping_callbacks_t cbs = {};
+  cbs.cb_args = &p;
+  cbs.on_ping_success = onAsyncPingReply;
+  cbs.on_ping_end = onAsyncPingEnd;
+
+  if (esp_ping_new_session(&pingConfig, &cbs, &p.session) != ESP_OK) {
+    p.session = NULL;
+    return false;
+  }
+  esp_ping_start(p.session);
+  return true;
+}
+
+/**
+ * Wait for a background ping to finish and free the session
+ * @param p Ping state from asyncPingStart()
+ * @param maxWaitMs Longest to wait if it's still running
+ * @return Number of replies, or -1 if it never started
+ */
+inline int asyncPingCollect(AsyncPing& p, uint32_t maxWaitMs) {
+  if (p.session == NULL) return -1;
+
+  if (xSemaphoreTake(p.done, pdMS_TO_TICKS(maxWaitMs)) != pdTRUE) {
+    esp_ping_stop(p.session);
+    xSemaphoreTake(p.done, pdMS_TO_TICKS(GATEWAY_PING_TIMEOUT + 100));
+  }
+  esp_ping_delete_session(p.session);
+  p.session = NULL;
+  return p.replies;
+}
+
+// ===========================================
+// RAW DNS QUERY (bypasses the lwIP cache)
+// ===========================================
+
+static WiFiUDP dnsProbeUdp;
+static uint16_t dnsProbeId = 0;
+static unsigned long dnsProbeSentAt = 0;
+static bool dnsProbeSent = false;
+
+/**
+ * Build a minimal recursive A query for host
+ * @param buf Output buffer
+ * @param size Buffer size
+ * @param id Transaction ID
+ * @param host Name to query
+ * @return Packet length, or 0 if the name doesn't fit
+ */
+inline size_t buildDnsQuery(uint8_t* buf, size_t size, uint16_t id, const char* host) {
+  size_t hostLen = strlen(host);
+  if (size < 12 + hostLen + 2 + 4) return 0;
+
+  memset(buf, 0, 12);
+  buf[0] = id >> 8;
+  buf[1] = id & 0xFF;
+  buf[2] = 0x01;  // RD (recursion desired)
+  buf[5] = 0x01;  // QDCOUNT = 1
+
+  // QNAME as length-prefixed labels
+  size_t pos = 12;
+  const char* label = host;
+  while (*label) {
+    const char* dot = strchr(label, '.');
+    size_t len = dot ? (size_t)(dot - label) : strlen(label);
+    if (len == 0 || len > 63) return 0;
+    buf[pos++] = len;
+    memcpy(buf + pos, label, len);
+    pos += len;
+    label += len;
+    if (*label == '.') label++;
+  }
+  buf[pos++] = 0;
+
+  buf[pos++] = 0x00; buf[pos++] = 0x01;  // QTYPE A
+  buf[pos++] = 0x00; buf[pos++] = 0x01;  // QCLASS IN
+  return pos;
+}
+
+/**
+ * Send the DNS query to every configured resolver
+ * Uses a random source port and ID per check.
+ */
+inline void dnsProbeStart() {
+  uint8_t query[12 + sizeof(DNS_PROBE_HOST) + 1 + 4];
+  dnsProbeId = esp_random() & 0xFFFF;
+  size_t len = buildDnsQuery(query, sizeof(query), dnsProbeId, DNS_PROBE_HOST);
+
+  dnsProbeSent = false;
+  dnsProbeUdp.stop();
+  if (len == 0 || !dnsProbeUdp.begin(49152 + (esp_random() % 16384))) return;
+
+  for (int i = 0; i < 2; i++) {
+    IPAddress resolver = WiFi.dnsIP(i);
+    if ((uint32_t)resolver == 0) continue;
+    dnsProbeUdp.beginPacket(resolver, 53);
+    dnsProbeUdp.write(query, len);
+    if (dnsProbeUdp.endPacket()) dnsProbeSent = true;
+  }
+  dnsProbeSentAt = millis();
+}
+
+/**
+ * Wait for a matching answer (any resolver)
+ * @return true if a resolver returned NOERROR with at least one answer
+ */
+inline bool dnsProbeCollect() {
+  if (!dnsProbeSent) {
+    dnsProbeUdp.stop();
+    return false;
+  }
+
+  bool ok = false;
+  uint8_t reply[64];  // Header is all we need
+  while (millis() - dnsProbeSentAt < DNS_PROBE_TIMEOUT_MS) {
+    if (dnsProbeUdp.parsePacket() >= 12) {
+      int n = dnsProbeUdp.read(reply, sizeof(reply));
+      if (n >= 12) {
+        uint16_t id = (reply[0] << 8) | reply[1];
+        bool isResponse = reply[2] & 0x80;
+        uint8_t rcode = reply[3] & 0x0F;
+        uint16_t answers = (reply[6] << 8) | reply[7];
+        if (id == dnsProbeId && isResponse && rcode == 0 && answers > 0) {
+          ok = true;
+          break;
+        }
+      }
+    }
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+
+  dnsProbeUdp.stop();
+  return ok;
+}
+
+// ===========================================
+// SEGMENT PROBES (run around each WAN check)
+// ===========================================
+
+static AsyncPing gatewayPing;
+static AsyncPing wanIpPing;
+
+/**
+ * Kick off gateway, WAN IP and DNS probes (returns immediately)
+ * Call right before checkInternet().
+ */
+inline void startSegmentProbes() {
+  IPAddress gateway = WiFi.gatewayIP();
+  if ((uint32_t)gateway != 0) {
+    asyncPingStart(gatewayPing, gateway, GATEWAY_PING_COUNT);
+  }
+
+  IPAddress wanIp;
+  if (wanIp.fromString(SEGMENT_WAN_IP)) {
+    asyncPingStart(wanIpPing, wanIp, GATEWAY_PING_COUNT);
+  }
+
+  dnsProbeStart();
+}
+
+/**
+ * Collect probe results into segment
+ * Call right after checkInternet(); waits only for whatever is still
+ * outstanding.
+ */
+inline void finishSegmentProbes() {
+  const uint32_t maxWait = GATEWAY_PING_COUNT * (GATEWAY_PING_INTERVAL + GATEWAY_PING_TIMEOUT);
+
+  int gwReplies = asyncPingCollect(gatewayPing, maxWait);
+  if (gwReplies > 0) {
+    segment.gatewayOk = true;
+    segment.gatewaySeen = true;
+    segment.gatewayFailures = 0;
+    segment.gatewayRttMs = gatewayPing.rttSumMs / gwReplies;
+  } else {
+    // A gateway that never answered ICMP may simply filter it
+    segment.gatewayOk = false;
+    if (segment.gatewaySeen) segment.gatewayFailures++;
+  }
+
+  segment.wanIpOk = asyncPingCollect(wanIpPing, maxWait) > 0;
+
+  segment.dnsOk = dnsProbeCollect();
+  if (segment.dnsOk) {
+    segment.dnsFailures = 0;
+  } else {
+    segment.dnsFailures++;
+  }
+}
+
+#endif // NETWORK_SEGMENT_PROBE_H
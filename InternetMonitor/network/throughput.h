@@ -0,0 +1,294 @@
+#ifndef NETWORK_THROUGHPUT_H
+#define NETWORK_THROUGHPUT_H
+
+/**
+ * @file throughput.h
+ * @brief Download/upload bandwidth test in a low-priority task
+ *
+ * Streams up to cfg.sizeBytes from an HTTP endpoint (and optionally
+ * POSTs the same amount back) and reports sustained Mbps. All payload
+ * goes through one static scratch buffer: no per-chunk allocation, and
+ * the only copy is lwIP -> scratch. The task runs at idle priority on
+ * Core 1, so the LED task on Core 0 and the network/MQTT tasks are
+ * never held up by it.
+ *
+ * Runs on demand (POST /throughput/run) or every cfg.intervalMin minutes
+ * when scheduled.
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "../config.h"
+#include "../core/events.h"
+#include "throughput_config.h"
+#include "url.h"
+
+// ===========================================
+// THROUGHPUT TASK SETTINGS
+// ===========================================
+
+#define THROUGHPUT_TASK_STACK_SIZE  6144
+#define THROUGHPUT_TASK_PRIORITY    0       // Idle priority: only uses spare Core 1 time
+#define THROUGHPUT_TASK_CORE        1
+#define THROUGHPUT_POLL_MS          60000   // Schedule check interval
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern bool configPortalActive;
+
+// Task handle for throughput task
+TaskHandle_t throughputTaskHandle = NULL;
+
+// Fixed scratch buffer shared by download and upload
+static uint8_t throughputScratch[THROUGHPUT_BUFFER_SIZE];
+
+// ===========================================
+// HELPERS
+// ===========================================
+
+inline float toMbps(uint32_t bytes, uint32_t us) {
+  return us > 0 ? (bytes * 8.0f) / us : 0.0f;  // bits per microsecond == Mbit/s
+}
+
+// ===========================================
+// DOWNLOAD
+// ===========================================
+
+/**
+ * Stream the download URL into the scratch buffer
+ * Timing starts once headers are in, so it excludes DNS and connect.
+ * @param cfg Config snapshot
+ * @param r Result to fill (downMbps, downBytes, downMs)
+ * @return false on HTTP error or stall
+ */
+inline bool runDownloadTest(const ThroughputConfig& cfg, ThroughputResult& r) {
+  HTTPClient http;
+  http.setConnectTimeout(THROUGHPUT_IDLE_TIMEOUT_MS);
+  http.setTimeout(THROUGHPUT_IDLE_TIMEOUT_MS);
+
+  if (!http.begin(cfg.downloadUrl)) {
+    r.lastError = "bad download url";
+    return false;
+  }
+
+  int code = http.GET();
+  if (code != 200) {
+    r.lastError = "download http error";
+    http.end();
+    return false;
+  }
+
+  uint32_t target = cfg.sizeBytes;
+  int length = http.getSize();  // -1 if unknown (chunked)
+  if (length > 0 && (uint32_t)length < target) target = length;
+
+  WiFiClient* stream = http.getStreamPtr();
+  uint32_t total = 0;
+  unsigned long startUs = micros();
+  unsigned long lastData = millis();
+
+  while (total < target) {
+    int avail = stream->available();
+    if (avail > 0) {
+      size_t want = min((size_t)avail, sizeof(throughputScratch));
+      want = min(want, (size_t)(target - total));
+      int n = stream->read(throughputScratch, want);
+      if (n > 0) {
+        total += n;
+        lastData = millis();
+      }
+    } else if (!stream->connected()) {
+      break;
+    } else if (millis() - lastData > THROUGHPUT_IDLE_TIMEOUT_MS) {
+      r.lastError = "download stalled";
+      break;
+    } else {
+      vTaskDelay(1);
+    }
+  }
+
+  uint32_t elapsedUs = micros() - startUs;
+  http.end();
+
+  r.downBytes = total;
+  r.downMs = elapsedUs / 1000;
+  r.downMbps = toMbps(total, elapsedUs);
+
+  if (total == 0 && r.lastError[0] == '\0') r.lastError = "download empty";
+  return r.lastError[0] == '\0';
+}
+
+// ===========================================
+// UPLOAD
+// ===========================================
+
+/**
+ * POST cfg.sizeBytes from the scratch buffer to the upload URL
+ * Timing stops when the server's status line arrives (all bytes received).
+ * @param cfg Config snapshot
+ * @param r Result to fill (upMbps, upBytes, upMs)
+ * @return false on connect/write error or non-2xx status
+ */
+inline bool runUploadTest(const ThroughputConfig& cfg, ThroughputResult& r) {
+  char host[64];
+  uint16_t port;
+  const char* path;
+  if (!parseHttpUrl(cfg.uploadUrl, host, sizeof(host), port, path)) {
+    r.lastError = "bad upload url";
+    return false;
+  }
+
+  WiFiClient client;
+  if (!client.connect(host, port, THROUGHPUT_IDLE_TIMEOUT_MS)) {
+    r.lastError = "upload connect failed";
+    return false;
+  }
+
+  client.printf("POST %s HTTP/1.1\r\nHost: %s\r\nContent-Type: application/octet-stream\r\n"
+                "Content-Length: %lu\r\nConnection: close\r\n\r\n",
+                path, host, (unsigned long)cfg.sizeBytes);
+
+  memset(throughputScratch, 0xA5, sizeof(throughputScratch));
+
+  uint32_t sent = 0;
+  unsigned long startUs = micros();
+  unsigned long lastData = millis();
+
+  while (sent < cfg.sizeBytes) {
+    size_t chunk = min((size_t)(cfg.sizeBytes - sent), sizeof(throughputScratch));
+    size_t n = client.write(throughputScratch, chunk);
+    if (n > 0) {
+      sent += n;
+      lastData = millis();
+    } else if (!client.connected() || millis() - lastData > THROUGHPUT_IDLE_TIMEOUT_MS) {
+      break;
+    } else {
+      vTaskDelay(1);
+    }
+  }
+
+  // "HTTP/1.1 200 ..." once the server has the whole body
+  char status[16] = "";
+  client.setTimeout(THROUGHPUT_IDLE_TIMEOUT_MS);
+  client.readBytesUntil('\n', status, sizeof(status) - 1);
+  uint32_t elapsedUs = micros() - startUs;
+  client.stop();
+
+  r.upBytes = sent;
+  r.upMs = elapsedUs / 1000;
+  r.upMbps = toMbps(sent, elapsedUs);
+
+  if (sent < cfg.sizeBytes) {
+    r.lastError = "upload stalled";
+    return false;
+  }
+  if (strncmp(status, "HTTP/1.", 7) != 0 || status[9] != '2') {
+    r.lastError = "upload http error";
+    return false;
+  }
+  return true;
+}
+
+// ===========================================
+// RUN A TEST
+// ===========================================
+
+/**
+ * Run download (and upload if enabled) and update throughputResult
+ * @param cfg Config snapshot
+ */
+inline void runThroughputTest(const ThroughputConfig& cfg) {
+  ThroughputResult& r = throughputResult;
+  r.running = true;
+  r.lastError = "";
+  r.upMbps = 0;
+  r.upBytes = 0;
+  r.upMs = 0;
+
+  Serial.printf("[Throughput] Download %lu bytes from %s\n", (unsigned long)cfg.sizeBytes, cfg.downloadUrl);
+  bool ok = runDownloadTest(cfg, r);
+  Serial.printf("[Throughput] Down: %.2f Mbps (%lu bytes in %lu ms)\n",
+    r.downMbps, (unsigned long)r.downBytes, (unsigned long)r.downMs);
+
+  if (ok && cfg.uploadEnabled) {
+    ok = runUploadTest(cfg, r);
+    Serial.printf("[Throughput] Up: %.2f Mbps (%lu bytes in %lu ms)\n",
+      r.upMbps, (unsigned long)r.upBytes, (unsigned long)r.upMs);
+  }
+
+  if (!ok) {
+    r.failures++;
+    Serial.printf("[Throughput] Failed: %s\n", r.lastError);
+  }
+  r.runs++;
+  r.lastRun = millis();
+  r.running = false;
+  publishEvent(EVENT_THROUGHPUT, ok, 0, (uint32_t)(r.downMbps * 1000));
+}
+
+// ===========================================
+// THROUGHPUT TASK
+// ===========================================
+
+void throughputTask(void* parameter) {
+  Serial.printf("[Throughput Task] Started on Core %d\n", xPortGetCoreID());
+
+  // First scheduled run one interval after boot
+  unsigned long lastScheduled = millis();
+
+  while (true) {
+    bool requested = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(THROUGHPUT_POLL_MS)) > 0;
+
+    ThroughputConfig cfg;
+    throughputConfigSnapshot(cfg);
+
+    bool due = cfg.scheduled && (millis() - lastScheduled >= cfg.intervalMin * 60000UL);
+    if (!requested && !due) continue;
+    if (due) lastScheduled = millis();
+
+    if (configPortalActive || WiFi.status() != WL_CONNECTED) continue;
+
+    runThroughputTest(cfg);
+  }
+}
+
+/**
+ * Create and start the throughput task on Core 1
+ * Must be called after WiFi is connected
+ */
+inline void startThroughputTask() {
+  if (throughputTaskHandle != NULL) {
+    return;  // Already running
+  }
+
+  xTaskCreatePinnedToCore(
+    throughputTask,
+    "Throughput",
+    THROUGHPUT_TASK_STACK_SIZE,
+    NULL,
+    THROUGHPUT_TASK_PRIORITY,
+    &throughputTaskHandle,
+    THROUGHPUT_TASK_CORE
+  );
+
+  Serial.println("[Throughput] Task created on Core 1");
+}
+
+/**
+ * Ask the task to run a test now
+ * @return false if the task isn't running or a test is already in progress
+ */
+inline bool requestThroughputTest() {
+  if (throughputTaskHandle == NULL || throughputResult.running) {
+    return false;
+  }
+  xTaskNotifyGive(throughputTaskHandle);
+  return true;
+}
+
+#endif // NETWORK_THROUGHPUT_H
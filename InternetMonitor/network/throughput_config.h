@@ -0,0 +1,114 @@
+#ifndef NETWORK_THROUGHPUT_CONFIG_H
+#define NETWORK_THROUGHPUT_CONFIG_H
+
+/**
+ * @file throughput_config.h
+ * @brief Throughput test settings, results and NVS persistence
+ *
+ * Defines the ThroughputConfig struct (URLs, size, schedule) and the
+ * ThroughputResult struct written by the throughput task.
+ */
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "../config.h"
+
+// Bump when the ThroughputConfig layout changes (stale blobs fall back to defaults)
+#define THROUGHPUT_CONFIG_VERSION  1
+
+// ===========================================
+// THROUGHPUT STRUCTS
+// ===========================================
+
+struct ThroughputConfig {
+  uint8_t version = THROUGHPUT_CONFIG_VERSION;
+  bool scheduled = false;                             // Run every intervalMin
+  bool uploadEnabled = false;
+  uint16_t intervalMin = THROUGHPUT_DEFAULT_INTERVAL;
+  uint32_t sizeBytes = THROUGHPUT_DEFAULT_SIZE;       // Cap per direction
+  char downloadUrl[THROUGHPUT_URL_MAX_LEN] = THROUGHPUT_DEFAULT_DOWN_URL;
+  char uploadUrl[THROUGHPUT_URL_MAX_LEN] = THROUGHPUT_DEFAULT_UP_URL;
+};
+
+struct ThroughputResult {
+  float downMbps = 0.0f;
+  float upMbps = 0.0f;
+  uint32_t downBytes = 0;
+  uint32_t upBytes = 0;
+  uint32_t downMs = 0;
+  uint32_t upMs = 0;
+  unsigned long lastRun = 0;        // millis() when the last run finished
+  unsigned long runs = 0;
+  unsigned long failures = 0;
+  const char* lastError = "";       // Static string, "" if the last run passed
+  volatile bool running = false;
+};
+
+// ===========================================
+// GLOBAL INSTANCES
+// ===========================================
+
+extern ThroughputConfig throughputConfig;
+extern ThroughputResult throughputResult;
+extern portMUX_TYPE throughputMux;
+extern Preferences preferences;
+
+// ===========================================
+// THREAD-SAFE ACCESS
+// ===========================================
+
+/**
+ * Copy the live config (the task takes one snapshot per run)
+ * @param out Destination copy
+ */
+inline void throughputConfigSnapshot(ThroughputConfig& out) {
+  portENTER_CRITICAL(&throughputMux);
+  out = throughputConfig;
+  portEXIT_CRITICAL(&throughputMux);
+}
+
+/**
+ * Replace the live config (takes effect on the next run)
+ * @param cfg New config, already validated
+ */
+inline void throughputConfigApply(const ThroughputConfig& cfg) {
+  portENTER_CRITICAL(&throughputMux);
+  throughputConfig = cfg;
+  portEXIT_CRITICAL(&throughputMux);
+}
+
+// ===========================================
+// NVS PERSISTENCE FUNCTIONS
+// ===========================================
+
+inline void loadThroughputConfigFromNVS() {
+  ThroughputConfig cfg;
+  bool loaded = false;
+
+  preferences.begin(NVS_NAMESPACE, true);  // read-only
+  if (preferences.getBytesLength(NVS_KEY_THROUGHPUT) == sizeof(ThroughputConfig)) {
+    preferences.getBytes(NVS_KEY_THROUGHPUT, &cfg, sizeof(ThroughputConfig));
+    loaded = (cfg.version == THROUGHPUT_CONFIG_VERSION);
+  }
+  preferences.end();
+
+  if (!loaded) {
+    cfg = ThroughputConfig();
+  }
+  cfg.downloadUrl[sizeof(cfg.downloadUrl) - 1] = '\0';
+  cfg.uploadUrl[sizeof(cfg.uploadUrl) - 1] = '\0';
+  throughputConfigApply(cfg);
+
+  Serial.printf("[Throughput] %s config (%s, every %u min)\n",
+    loaded ? "Loaded" : "Default", cfg.scheduled ? "scheduled" : "manual", cfg.intervalMin);
+}
+
+inline void saveThroughputConfigToNVS(const ThroughputConfig& cfg) {
+  preferences.begin(NVS_NAMESPACE, false);  // read-write
+  preferences.putBytes(NVS_KEY_THROUGHPUT, &cfg, sizeof(ThroughputConfig));
+  preferences.end();
+
+  Serial.println("[Throughput] Config saved to NVS");
+}
+
+#endif // NETWORK_THROUGHPUT_CONFIG_H
@@ -0,0 +1,37 @@
+#ifndef NETWORK_URL_H
+#define NETWORK_URL_H
+
+/**
+ * @file url.h
+ * @brief Minimal http:// URL parsing (no allocation)
+ */
+
+#include <Arduino.h>
+
+/**
+ * Split an http:// URL into host, port and path
+ * @param url Full URL
+ * @param host Output host buffer
+ * @param hostSize Size of host buffer
+ * @param port Output port (80 if absent)
+ * @param path Output pointer into url ("/" if absent)
+ * @return false if the URL isn't plain http:// or the host doesn't fit
+ */
+inline bool parseHttpUrl(const char* url, char* host, size_t hostSize, uint16_t& port, const char*& path) {
+  if (strncmp(url, "http://", 7) != 0) return false;
+  const char* start = url + 7;
+  const char* slash = strchr(start, '/');
+  const char* end = slash ? slash : start + strlen(start);
+  path = slash ? slash : "/";
+
+  const char* colon = (const char*)memchr(start, ':', end - start);
+  port = colon ? atoi(colon + 1) : 80;
+  size_t hostLen = (colon ? colon : end) - start;
+  if (hostLen == 0 || hostLen >= hostSize || port == 0) return false;
+
+  memcpy(host, start, hostLen);
+  host[hostLen] = '\0';
+  return true;
+}
+
+#endif // NETWORK_URL_H
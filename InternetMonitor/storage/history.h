@@ -0,0 +1,313 @@
+#ifndef STORAGE_HISTORY_H
+#define STORAGE_HISTORY_H
+
+/**
+ * @file history.h
+ * @brief Tiered in-RAM time series of check results
+ *
+ * Four fixed-size rings, oldest entries overwritten:
+ * - raw:    one 4-byte sample per check (time delta, pass/fail, check time)
+ * - minute: 1-minute buckets (checks, failures, mean/max check time)
+ * - hour:   1-hour buckets
+ * - day:    1-day buckets
+ *
+ * Each check is written to the raw ring and added to the current bucket
+ * of every coarser tier at the same time, so downsampling needs no
+ * background pass. Timestamps are seconds since boot (clockUptimeSec(),
+ * does not wrap like millis()); /history adds the current UTC so clients
+ * can convert.
+ *
+ * Written by the network task, read by the /history handler, both
+ * under historyMutex. A query walks up to 1440 buckets, too long for a
+ * spinlock (interrupts off); neither side runs in an ISR, so a mutex
+ * only makes the network task wait out a query in progress.
+ */
+
+#include <Arduino.h>
+#include "../config.h"
+#include "../core/clock.h"
+
+// ===========================================
+// HISTORY STRUCTS
+// ===========================================
+
+enum HistoryTierId {
+  HISTORY_RAW = 0,
+  HISTORY_MINUTE,
+  HISTORY_HOUR,
+  HISTORY_DAY,
+  HISTORY_TIER_COUNT
+};
+
+#define HISTORY_OK_BIT    0x8000
+#define HISTORY_RTT_MASK  0x7FFF
+
+struct HistorySample {
+  uint16_t dtSec;       // Seconds since the previous sample (0 for the oldest)
+  uint16_t rttOk;       // Bit 15: check passed, bits 0-14: check time (ms)
+};
+
+struct HistoryBucket {
+  uint16_t checks;
+  uint16_t failures;
+  uint16_t avgRttMs;    // Mean check time of passing checks
+  uint16_t maxRttMs;
+};
+
+struct HistoryTier {
+  HistoryBucket* slots;
+  uint16_t size;
+  uint32_t periodSec;
+  uint32_t newest;      // Bucket number (seconds / periodSec) of the newest slot
+  uint16_t count;       // Valid slots ending at newest
+};
+
+// One point of a query result (merged buckets: a 45-day point of 10 s
+// checks holds ~389k, so the counts are 32-bit)
+struct HistoryPoint {
+  uint32_t t;           // Start, seconds since boot
+  uint32_t checks;
+  uint32_t failures;
+  uint16_t avgRttMs;
+  uint16_t maxRttMs;
+};
+
+// ===========================================
+// STORAGE
+// ===========================================
+
+static SemaphoreHandle_t historyMutex = NULL;
+
+static HistorySample historyRaw[HISTORY_RAW_SLOTS];
+static uint16_t historyRawHead = 0;       // Next write index
+static uint16_t historyRawCount = 0;
+static uint32_t historyRawLastSec = 0;    // Time of the newest raw sample
+
+static HistoryBucket historyMinute[HISTORY_MINUTE_SLOTS];
+static HistoryBucket historyHour[HISTORY_HOUR_SLOTS];
+static HistoryBucket historyDay[HISTORY_DAY_SLOTS];
+
+// Raw period is nominal (CHECK_INTERVAL), used for tier selection only
+static HistoryTier historyTiers[HISTORY_TIER_COUNT] = {
+  { nullptr,       HISTORY_RAW_SLOTS,    CHECK_INTERVAL / 1000, 0, 0 },
+  { historyMinute, HISTORY_MINUTE_SLOTS, 60,                    0, 0 },
+  { historyHour,   HISTORY_HOUR_SLOTS,   3600,                  0, 0 },
+  { historyDay,    HISTORY_DAY_SLOTS,    86400,                 0, 0 }
+};
+
+static const char* const historyTierNames[HISTORY_TIER_COUNT] = {
+  "raw", "minute", "hour", "day"
+};
+
+/**
+ * Create the history lock (setup(), before the network task starts)
+ */
+inline void initHistory() {
+  if (historyMutex == NULL) historyMutex = xSemaphoreCreateMutex();
+}
+
+// ===========================================
+// RECORDING
+// ===========================================
+
+inline void addToBucket(HistoryBucket& b, bool ok, uint16_t rttMs) {
+  if (b.checks == 0xFFFF) return;
+  b.checks++;
+  if (!ok) {
+    b.failures++;
+    return;
+  }
+  int32_t passes = b.checks - b.failures;
+  b.avgRttMs += ((int32_t)rttMs - (int32_t)b.avgRttMs) / passes;
+  if (rttMs > b.maxRttMs) b.maxRttMs = rttMs;
+}
+
+inline void addToTier(HistoryTier& tier, uint32_t nowSec, bool ok, uint16_t rttMs) {
+  uint32_t bucket = nowSec / tier.periodSec;
+
+  if (tier.count == 0) {
+    tier.newest = bucket;
+    tier.count = 1;
+    tier.slots[bucket % tier.size] = HistoryBucket();
+  } else if (bucket > tier.newest) {
+    // Rotate in the new bucket, clearing any skipped ones on the way
+    uint32_t gap = bucket - tier.newest;
+    for (uint32_t i = 1; i <= gap && i <= tier.size; i++) {
+      tier.slots[(tier.newest + i) % tier.size] = HistoryBucket();
+    }
+    tier.newest = bucket;
+    tier.count = (tier.count + gap >= tier.size) ? tier.size : tier.count + gap;
+  }
+
+  addToBucket(tier.slots[bucket % tier.size], ok, rttMs);
+}
+
+/**
+ * Record one check result in every tier
+ * Called by the network task after each check.
+ * @param ok Check passed
+ * @param checkMs Check duration (ms)
+ */
+inline void historyRecord(bool ok, uint32_t checkMs) {
+  uint32_t nowSec = clockUptimeSec();
+  uint16_t rtt = checkMs > HISTORY_RTT_MASK ? HISTORY_RTT_MASK : checkMs;
+
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+  uint32_t dt = historyRawCount > 0 ? nowSec - historyRawLastSec : 0;
+  if (dt > 0xFFFF) {
+    // Gap too long for a delta (~18 h without checks): start a new run.
+    // A clipped delta would shift every older timestamp; those samples
+    // are past the raw tier's retention anyway and stay in the others.
+    historyRawCount = 0;
+    dt = 0;
+  }
+  HistorySample& s = historyRaw[historyRawHead];
+  s.dtSec = dt;
+  s.rttOk = rtt | (ok ? HISTORY_OK_BIT : 0);
+  historyRawHead = (historyRawHead + 1) % HISTORY_RAW_SLOTS;
+  if (historyRawCount < HISTORY_RAW_SLOTS) historyRawCount++;
+  historyRawLastSec = nowSec;
+
+  for (int i = HISTORY_MINUTE; i < HISTORY_TIER_COUNT; i++) {
+    addToTier(historyTiers[i], nowSec, ok, rtt);
+  }
+  xSemaphoreGive(historyMutex);
+}
+
+// ===========================================
+// QUERY
+// ===========================================
+
+/**
+ * Fold one point into another (weighted mean over passing checks)
+ */
+inline void mergeHistoryPoint(HistoryPoint& into, const HistoryPoint& p) {
+  uint32_t passesA = into.checks - into.failures;
+  uint32_t passesB = p.checks - p.failures;
+  if (passesA + passesB > 0) {
+    into.avgRttMs = ((uint64_t)into.avgRttMs * passesA + (uint64_t)p.avgRttMs * passesB) / (passesA + passesB);
+  }
+  into.checks += p.checks;
+  into.failures += p.failures;
+  if (p.maxRttMs > into.maxRttMs) into.maxRttMs = p.maxRttMs;
+}
+
+/**
+ * Append source point k of a query, merging every `step` points into one
+ */
+inline void emitHistoryPoint(const HistoryPoint& p, uint32_t k, uint32_t step,
+                             HistoryPoint* out, int& n) {
+  if (k % step == 0) {
+    out[n++] = p;
+  } else {
+    mergeHistoryPoint(out[n - 1], p);
+  }
+}
+
+inline HistoryPoint rawToPoint(const HistorySample& s, uint32_t t) {
+  HistoryPoint p;
+  bool ok = s.rttOk & HISTORY_OK_BIT;
+  p.t = t;
+  p.checks = 1;
+  p.failures = ok ? 0 : 1;
+  p.avgRttMs = ok ? (s.rttOk & HISTORY_RTT_MASK) : 0;
+  p.maxRttMs = p.avgRttMs;
+  return p;
+}
+
+/**
+ * Copy [fromSec, toSec] out of one tier, oldest first
+ * Adjacent samples/buckets are merged so the result fits in maxOut.
+ * Runs under historyMutex; cost is bounded by the tier size (<= 1440).
+ *
+ * @param tier Tier to read
+ * @param fromSec Range start (seconds since boot)
+ * @param toSec Range end (seconds since boot)
+ * @param out Destination, at least maxOut points
+ * @param maxOut Max points to return
+ * @param stepSec Set to the (nominal) seconds covered by each point
+ * @return Number of points written
+ */
+inline int historyQuery(HistoryTierId tier, uint32_t fromSec, uint32_t toSec,
+                        HistoryPoint* out, int maxOut, uint32_t& stepSec) {
+  int n = 0;
+  stepSec = historyTiers[tier].periodSec;
+  if (maxOut <= 0 || fromSec > toSec) return 0;
+
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+
+  if (tier == HISTORY_RAW) {
+    if (historyRawCount > 0) {
+      uint16_t oldest = (historyRawHead + HISTORY_RAW_SLOTS - historyRawCount) % HISTORY_RAW_SLOTS;
+
+      // Deltas run forward, so find the oldest timestamp first
+      uint32_t t0 = historyRawLastSec;
+      for (uint16_t i = historyRawCount - 1; i > 0; i--) {
+        t0 -= historyRaw[(oldest + i) % HISTORY_RAW_SLOTS].dtSec;
+      }
+
+      uint32_t inRange = 0;
+      uint32_t t = t0;
+      for (uint16_t i = 0; i < historyRawCount; i++) {
+        if (i > 0) t += historyRaw[(oldest + i) % HISTORY_RAW_SLOTS].dtSec;
+        if (t >= fromSec && t <= toSec) inRange++;
+      }
+
+      uint32_t step = (inRange + maxOut - 1) / maxOut;
+      uint32_t k = 0;
+      t = t0;
+      for (uint16_t i = 0; i < historyRawCount && step > 0; i++) {
+        const HistorySample& s = historyRaw[(oldest + i) % HISTORY_RAW_SLOTS];
+        if (i > 0) t += s.dtSec;
+        if (t < fromSec || t > toSec) continue;
+        emitHistoryPoint(rawToPoint(s, t), k++, step, out, n);
+      }
+      if (step > 0) stepSec *= step;
+    }
+  } else {
+    const HistoryTier& ht = historyTiers[tier];
+    if (ht.count > 0) {
+      uint32_t first = ht.newest - ht.count + 1;
+      uint32_t lo = max(first, fromSec / ht.periodSec);
+      uint32_t hi = min(ht.newest, toSec / ht.periodSec);
+
+      if (lo <= hi) {
+        uint32_t step = (hi - lo + maxOut) / maxOut;  // ceil((hi - lo + 1) / maxOut)
+        for (uint32_t b = lo; b <= hi; b++) {
+          const HistoryBucket& slot = ht.slots[b % ht.size];
+          HistoryPoint p = { b * ht.periodSec, slot.checks, slot.failures, slot.avgRttMs, slot.maxRttMs };
+          emitHistoryPoint(p, b - lo, step, out, n);
+        }
+        stepSec *= step;
+      }
+    }
+  }
+
+  xSemaphoreGive(historyMutex);
+  return n;
+}
+
+/**
+ * Finest tier whose retention covers rangeSec
+ */
+inline HistoryTierId historyPickTier(uint32_t rangeSec) {
+  for (int i = 0; i < HISTORY_TIER_COUNT; i++) {
+    if (rangeSec <= (uint32_t)historyTiers[i].size * historyTiers[i].periodSec) {
+      return (HistoryTierId)i;
+    }
+  }
+  return HISTORY_DAY;
+}
+
+/**
+ * Tier from its name ("raw", "minute", "hour", "day")
+ * @return Tier, or -1 if unknown
+ */
+inline int historyTierFromName(const char* name) {
+  for (int i = 0; i < HISTORY_TIER_COUNT; i++) {
+    if (strcmp(name, historyTierNames[i]) == 0) return i;
+  }
+  return -1;
+}
+
+#endif // STORAGE_HISTORY_H
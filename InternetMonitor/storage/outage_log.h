@@ -0,0 +1,402 @@
+#ifndef STORAGE_OUTAGE_LOG_H
+#define STORAGE_OUTAGE_LOG_H
+
+/**
+ * @file outage_log.h
+ * @brief Append-only outage journal on LittleFS
+ *
+ * One fixed-size, CRC-protected record per finished outage (start, end,
+ * cause, failed checks, fastest check). Records are queued in RAM and
+ * written in batches (OUTAGE_LOG_BATCH records or OUTAGE_LOG_FLUSH_MS,
+ * whichever comes first) to keep flash writes rare.
+ *
+ * Size is bounded by two segment files of OUTAGE_LOG_SEGMENT_RECORDS
+ * each: when the active one fills up, the older one is deleted and
+ * becomes the new active segment, so the log always holds the last
+ * 1-2 segments' worth of outages.
+ *
+ * Times are taken on the monotonic clock and converted to UTC when the
+ * outage closes, if SNTP has synced by then (OUTAGE_FLAG_UTC).
+ *
+ * Records with a bad CRC (torn write at power loss) are skipped on read.
+ * An outage still in progress at power loss is not recorded.
+ */
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <esp_rom_crc.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "../config.h"
+#include "../core/types.h"
+#include "../core/state.h"
+#include "../core/clock.h"
+
+// ===========================================
+// RECORD FORMAT
+// ===========================================
+
+struct OutageRecord {
+  uint32_t seq;           // Monotonic across reboots
+  uint16_t boot;          // Boot number (records with equal boot share a time base)
+  uint8_t cause;          // State that started the outage
+  uint8_t flags;          // OUTAGE_FLAG_*
+  uint32_t startSec;      // Unix time if OUTAGE_FLAG_UTC, else seconds since boot
+  uint32_t endSec;
+  uint16_t minRttMs;      // Fastest passing check until recovery (0 = none)
+  uint16_t failedChecks;
+  uint32_t crc;           // CRC32 of all fields above
+};
+
+#define OUTAGE_FLAG_UTC  0x01   // start/end are Unix time (clock was synced at close)
+
+static const char* const outageSegmentPaths[2] = { "/outages0.bin", "/outages1.bin" };
+
+// ===========================================
+// STATE
+// ===========================================
+
+extern portMUX_TYPE outageMux;
+
+// Guards the files (network task flushes, web handler reads)
+static SemaphoreHandle_t outageFileMutex = NULL;
+static bool outageFsReady = false;
+static uint8_t outageActiveSeg = 0;
+static uint16_t outageActiveCount = 0;    // Records in the active segment
+static uint32_t outageNextSeq = 1;
+static uint16_t outageBootId = 1;
+
+// Finished outages waiting to be written (outageMux)
+static OutageRecord outagePending[OUTAGE_LOG_BATCH];
+static uint8_t outagePendingCount = 0;
+static unsigned long outageOldestPending = 0;
+
+// Outage in progress (outageMux)
+static bool outageOpen = false;
+static OutageRecord outageCurrent;
+
+inline uint32_t outageRecordCrc(const OutageRecord& r) {
+  return esp_rom_crc32_le(0, (const uint8_t*)&r, offsetof(OutageRecord, crc));
+}
+
+inline bool outageRecordValid(const OutageRecord& r) {
+  return r.seq != 0 && r.crc == outageRecordCrc(r);
+}
+
+/**
+ * Short cause name (matches the MQTT status text)
+ */
+inline const char* outageCauseText(uint8_t cause) {
+  switch (cause) {
+    case STATE_INTERNET_DOWN: return "offline";
+    case STATE_ROUTER_UNREACHABLE: return "router_unreachable";
+    case STATE_DNS_FAILING: return "dns_failing";
+    default: return "unknown";
+  }
+}
+
+// ===========================================
+// MOUNT
+// ===========================================
+
+/**
+ * Read the newest valid record of a segment
+ * @return false if the segment is empty or has no valid record
+ */
+inline bool readLastValidRecord(File& f, uint16_t count, OutageRecord& out) {
+  for (int i = count - 1; i >= 0; i--) {
+    f.seek(i * sizeof(OutageRecord));
+    if (f.read((uint8_t*)&out, sizeof(out)) == sizeof(out) && outageRecordValid(out)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Drop a partial trailing record (torn write at power loss)
+ * Copies the whole records to a temporary file and renames it over the
+ * segment; the other segment is never touched.
+ * @return false if the segment couldn't be rewritten
+ */
+inline bool trimOutageSegment(int seg, uint16_t count) {
+  static const char* const tmpPath = "/outages.tmp";
+  File in = LittleFS.open(outageSegmentPaths[seg], FILE_READ);
+  File out = LittleFS.open(tmpPath, FILE_WRITE);
+  bool ok = in && out;
+
+  OutageRecord r;
+  for (uint16_t i = 0; ok && i < count; i++) {
+    ok = in.read((uint8_t*)&r, sizeof(r)) == sizeof(r) && out.write((const uint8_t*)&r, sizeof(r)) == sizeof(r);
+  }
+  if (in) in.close();
+  if (out) out.close();
+
+  ok = ok && LittleFS.remove(outageSegmentPaths[seg]) && LittleFS.rename(tmpPath, outageSegmentPaths[seg]);
+  if (!ok) LittleFS.remove(tmpPath);
+  return ok;
+}
+
+/**
+ * Mount LittleFS and find the active segment and next sequence number
+ * Formats the partition if it can't be mounted.
+ */
+inline void initOutageLog() {
+  outageFileMutex = xSemaphoreCreateMutex();
+
+  if (!LittleFS.begin(true)) {
+    Serial.println("[Outages] LittleFS mount failed, log kept in RAM only");
+    return;
+  }
+  outageFsReady = true;
+
+  uint32_t lastSeq[2] = {0, 0};
+  uint16_t counts[2] = {0, 0};
+  bool aligned[2] = {true, true};
+  OutageRecord newest;
+  newest.seq = 0;
+  newest.boot = 0;
+
+  for (int s = 0; s < 2; s++) {
+    if (!LittleFS.exists(outageSegmentPaths[s])) continue;
+    File f = LittleFS.open(outageSegmentPaths[s], FILE_READ);
+    if (!f) continue;
+    counts[s] = f.size() / sizeof(OutageRecord);
+    aligned[s] = (f.size() % sizeof(OutageRecord)) == 0;
+    OutageRecord r;
+    if (readLastValidRecord(f, counts[s], r)) {
+      lastSeq[s] = r.seq;
+      if (r.seq > newest.seq) newest = r;
+    }
+    f.close();
+  }
+
+  outageActiveSeg = lastSeq[1] > lastSeq[0] ? 1 : 0;
+  outageActiveCount = counts[outageActiveSeg];
+  outageNextSeq = newest.seq + 1;
+  outageBootId = newest.boot + 1;
+
+  // A partial trailing record would misalign every later append; cut it
+  // off and keep appending after the last whole one
+  if (!aligned[outageActiveSeg] && !trimOutageSegment(outageActiveSeg, outageActiveCount)) {
+    Serial.println("[Outages] Can't repair a torn segment, log kept in RAM only");
+    outageFsReady = false;
+  }
+
+  Serial.printf("[Outages] %u records, next #%lu, boot %u (%u/%u KB used)\n",
+    counts[0] + counts[1], (unsigned long)outageNextSeq, outageBootId,
+    (unsigned)(LittleFS.usedBytes() / 1024), (unsigned)(LittleFS.totalBytes() / 1024));
+}
+
+// ===========================================
+// RECORDING
+// ===========================================
+
+/**
+ * Queue a finished outage (caller holds outageMux)
+ */
+inline void queueOutageRecord(OutageRecord& r) {
+  r.crc = outageRecordCrc(r);
+  if (outagePendingCount == 0) outageOldestPending = millis();
+  if (outagePendingCount == OUTAGE_LOG_BATCH) {
+    // Flash unavailable and queue full: drop the oldest
+    memmove(&outagePending[0], &outagePending[1], sizeof(OutageRecord) * (OUTAGE_LOG_BATCH - 1));
+    outagePendingCount--;
+  }
+  outagePending[outagePendingCount++] = r;
+}
+
+/**
+ * Open/close outages on state changes
+ * Called by changeState() outside stateMux; same rules as the downtime
+ * stats (starts on the first outage state, ends on INTERNET_OK).
+ * A closed record is copied out and converted to UTC outside outageMux
+ * (clockUtcAt() takes clockMux), then queued.
+ */
+inline void outageLogStateChange(int newState) {
+  OutageRecord closed;
+  bool close = false;
+
+  portENTER_CRITICAL(&outageMux);
+  if (isOutageState(newState) && !outageOpen) {
+    outageOpen = true;
+    memset(&outageCurrent, 0, sizeof(outageCurrent));
+    outageCurrent.boot = outageBootId;
+    outageCurrent.cause = newState;
+    outageCurrent.startSec = clockUptimeSec();
+  } else if (newState == STATE_INTERNET_OK && outageOpen) {
+    outageOpen = false;
+    outageCurrent.seq = outageNextSeq++;
+    outageCurrent.endSec = clockUptimeSec();
+    closed = outageCurrent;
+    close = true;
+  }
+  portEXIT_CRITICAL(&outageMux);
+
+  if (!close) return;
+  if (clockSynced()) {
+    closed.startSec = clockUtcAt(closed.startSec * 1000ULL);
+    closed.endSec = clockUtcAt(closed.endSec * 1000ULL);
+    closed.flags |= OUTAGE_FLAG_UTC;
+  }
+
+  portENTER_CRITICAL(&outageMux);
+  queueOutageRecord(closed);
+  portEXIT_CRITICAL(&outageMux);
+}
+
+/**
+ * Count a check against the open outage, if any
+ * Called by the network task after each check, before the state change.
+ * @param ok Check passed
+ * @param checkMs Check duration (ms)
+ */
+inline void outageLogCheck(bool ok, uint32_t checkMs) {
+  portENTER_CRITICAL(&outageMux);
+  if (outageOpen) {
+    if (!ok) {
+      if (outageCurrent.failedChecks < 0xFFFF) outageCurrent.failedChecks++;
+    } else {
+      uint16_t rtt = checkMs > 0xFFFF ? 0xFFFF : checkMs;
+      if (outageCurrent.minRttMs == 0 || rtt < outageCurrent.minRttMs) outageCurrent.minRttMs = rtt;
+    }
+  }
+  portEXIT_CRITICAL(&outageMux);
+}
+
+// ===========================================
+// FLUSH
+// ===========================================
+
+/**
+ * Write all queued records to flash
+ * Rotates to the other segment when the active one is full.
+ */
+inline void flushOutageLog() {
+  if (!outageFsReady) return;
+
+  OutageRecord batch[OUTAGE_LOG_BATCH];
+  uint8_t n;
+  portENTER_CRITICAL(&outageMux);
+  n = outagePendingCount;
+  memcpy(batch, outagePending, sizeof(OutageRecord) * n);
+  portEXIT_CRITICAL(&outageMux);
+  if (n == 0) return;
+
+  xSemaphoreTake(outageFileMutex, portMAX_DELAY);
+  uint8_t written = 0;
+  while (written < n) {
+    if (outageActiveCount >= OUTAGE_LOG_SEGMENT_RECORDS) {
+      outageActiveSeg ^= 1;
+      LittleFS.remove(outageSegmentPaths[outageActiveSeg]);
+      outageActiveCount = 0;
+    }
+
+    File f = LittleFS.open(outageSegmentPaths[outageActiveSeg], FILE_APPEND);
+    if (!f) break;
+    uint8_t chunk = min((int)(n - written), (int)(OUTAGE_LOG_SEGMENT_RECORDS - outageActiveCount));
+    size_t bytes = f.write((const uint8_t*)&batch[written], sizeof(OutageRecord) * chunk);
+    f.close();
+    if (bytes != sizeof(OutageRecord) * chunk) break;
+
+    outageActiveCount += chunk;
+    written += chunk;
+  }
+  xSemaphoreGive(outageFileMutex);
+
+  // Drop what made it to flash; new records may have been queued meanwhile
+  portENTER_CRITICAL(&outageMux);
+  memmove(&outagePending[0], &outagePending[written], sizeof(OutageRecord) * (outagePendingCount - written));
+  outagePendingCount -= written;
+  if (outagePendingCount > 0) outageOldestPending = millis();
+  portEXIT_CRITICAL(&outageMux);
+
+  if (written < n) {
+    Serial.println("[Outages] Flash write failed, will retry");
+  } else {
+    Serial.printf("[Outages] Wrote %u record(s)\n", written);
+  }
+}
+
+/**
+ * Flush when the batch is full or the oldest record has waited long enough
+ * Called from the network task loop.
+ */
+inline void serviceOutageLog() {
+  bool due;
+  portENTER_CRITICAL(&outageMux);
+  due = outagePendingCount >= OUTAGE_LOG_BATCH ||
+        (outagePendingCount > 0 && millis() - outageOldestPending >= OUTAGE_LOG_FLUSH_MS);
+  portEXIT_CRITICAL(&outageMux);
+  if (due) flushOutageLog();
+}
+
+/**
+ * Delete the log (factory reset)
+ */
+inline void clearOutageLog() {
+  portENTER_CRITICAL(&outageMux);
+  outagePendingCount = 0;
+  outageOpen = false;
+  portEXIT_CRITICAL(&outageMux);
+
+  if (!outageFsReady) return;
+  xSemaphoreTake(outageFileMutex, portMAX_DELAY);
+  LittleFS.remove(outageSegmentPaths[0]);
+  LittleFS.remove(outageSegmentPaths[1]);
+  outageActiveSeg = 0;
+  outageActiveCount = 0;
+  xSemaphoreGive(outageFileMutex);
+  Serial.println("[Outages] Log cleared");
+}
+
+// ===========================================
+// READ (newest first, paginated)
+// ===========================================
+
+/**
+ * Read up to maxOut records with seq < beforeSeq, newest first
+ * Queued records come first, then the active segment, then the older one.
+ *
+ * @param beforeSeq Cursor (0 = from the newest)
+ * @param out Destination
+ * @param maxOut Max records to read
+ * @param total Set to the number of records stored (including queued)
+ * @return Number of records read
+ */
+inline int readOutages(uint32_t beforeSeq, OutageRecord* out, int maxOut, uint32_t& total) {
+  int n = 0;
+  if (beforeSeq == 0) beforeSeq = UINT32_MAX;
+
+  portENTER_CRITICAL(&outageMux);
+  total = outagePendingCount;
+  for (int i = outagePendingCount - 1; i >= 0 && n < maxOut; i--) {
+    if (outagePending[i].seq < beforeSeq) out[n++] = outagePending[i];
+  }
+  // A flush may land between here and the file read: don't list it twice
+  uint32_t fileBefore = beforeSeq;
+  if (outagePendingCount > 0 && outagePending[0].seq < fileBefore) fileBefore = outagePending[0].seq;
+  portEXIT_CRITICAL(&outageMux);
+
+  if (!outageFsReady) return n;
+
+  xSemaphoreTake(outageFileMutex, portMAX_DELAY);
+  for (int k = 0; k < 2; k++) {
+    uint8_t seg = outageActiveSeg ^ k;
+    File f = LittleFS.open(outageSegmentPaths[seg], FILE_READ);
+    if (!f) continue;
+    int count = f.size() / sizeof(OutageRecord);
+    total += count;
+    for (int i = count - 1; i >= 0 && n < maxOut; i--) {
+      OutageRecord r;
+      f.seek(i * sizeof(OutageRecord));
+      if (f.read((uint8_t*)&r, sizeof(r)) != sizeof(r) || !outageRecordValid(r)) continue;
+      if (r.seq < fileBefore) out[n++] = r;
+    }
+    f.close();
+  }
+  xSemaphoreGive(outageFileMutex);
+  return n;
+}
+
+#endif // STORAGE_OUTAGE_LOG_H
@@ -0,0 +1,234 @@
+#ifndef SYSTEM_CPU_STATS_H
+#define SYSTEM_CPU_STATS_H
+
+/**
+ * @file cpu_stats.h
+ * @brief Per-task and per-core CPU utilization (FreeRTOS runtime stats)
+ *
+ * Every CPU_SAMPLE_MS the sampler reads each task's run time counter
+ * (uxTaskGetSystemState()) and turns the deltas into percent of one core
+ * for that interval. The last CPU_WINDOW_SAMPLES intervals are kept per
+ * task and per core, giving a rolling average next to the latest value.
+ *
+ * A core's load is 100% minus its idle task's share, so it includes the
+ * WiFi/lwIP tasks and interrupts that aren't ours. Tasks without core
+ * affinity are listed with core -1. With more than CPU_MAX_TASKS tasks
+ * nothing can be sampled; that is logged once and /stats shows
+ * "overflow" until the count drops again.
+ *
+ * Sampled from the web task; the table is read by web handlers on the same task.
+ * The MQTT task only gets the CpuSummary copy (under cpuMux).
+ */
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "../config.h"
+
+#if configGENERATE_RUN_TIME_STATS && configUSE_TRACE_FACILITY && configTASKLIST_INCLUDE_COREID
+#define CPU_STATS_AVAILABLE 1
+#else
+#define CPU_STATS_AVAILABLE 0  // Core built without runtime stats
+#endif
+
+// ===========================================
+// CPU STATS STATE
+// ===========================================
+
+struct CpuTaskStat {
+  TaskHandle_t handle = NULL;       // NULL = free slot
+  char name[configMAX_TASK_NAME_LEN];
+  int8_t core = -1;                 // -1 = no affinity
+  uint8_t priority = 0;
+  bool seen = false;                // Present in the latest sample
+  uint32_t lastRunTime = 0;         // Run time counter at the previous sample
+  uint16_t pct[CPU_WINDOW_SAMPLES]; // Per interval, tenths of a percent of one core
+};
+
+// Headline numbers for MQTT (tenths of a percent)
+struct CpuSummary {
+  bool valid = false;               // At least one full interval sampled
+  uint16_t coreBusy[2] = {0, 0};    // Latest interval
+  uint16_t coreAvg[2] = {0, 0};     // Over the window
+  uint32_t idleMs[2] = {0, 0};      // Idle time over the window
+  uint16_t ledAvg = 0;              // LED task over the window
+  uint16_t wifiAvg = 0;             // WiFi driver task over the window
+};
+
+extern portMUX_TYPE cpuMux;
+extern TaskHandle_t ledTaskHandle;
+
+static CpuTaskStat cpuTasks[CPU_MAX_TASKS];
+static uint16_t cpuCoreBusy[2][CPU_WINDOW_SAMPLES];   // Tenths of a percent
+static uint32_t cpuCoreIdleMs[2][CPU_WINDOW_SAMPLES];
+static uint8_t cpuHead = 0;          // Slot the next sample writes
+static uint8_t cpuFilled = 0;        // Valid slots (up to CPU_WINDOW_SAMPLES)
+static uint32_t cpuLastTotal = 0;
+static uint32_t cpuLastIntervalMs = 0;
+static unsigned long cpuLastSample = 0;
+static bool cpuPrimed = false;
+static bool cpuOverflow = false;     // More tasks than CPU_MAX_TASKS
+static CpuSummary cpuSummary;
+
+// ===========================================
+// WINDOW HELPERS
+// ===========================================
+
+/**
+ * Index of the newest sample in the window rings
+ */
+inline uint8_t cpuLatestSlot() {
+  return (cpuHead + CPU_WINDOW_SAMPLES - 1) % CPU_WINDOW_SAMPLES;
+}
+
+/**
+ * Average of a ring over the filled part of the window
+ */
+inline uint16_t cpuWindowAvg(const uint16_t* ring) {
+  if (cpuFilled == 0) return 0;
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < cpuFilled; i++) {
+    sum += ring[(cpuHead + CPU_WINDOW_SAMPLES - 1 - i) % CPU_WINDOW_SAMPLES];
+  }
+  return sum / cpuFilled;
+}
+
+inline uint32_t cpuWindowIdleMs(uint8_t core) {
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < cpuFilled; i++) {
+    sum += cpuCoreIdleMs[core][(cpuHead + CPU_WINDOW_SAMPLES - 1 - i) % CPU_WINDOW_SAMPLES];
+  }
+  return sum;
+}
+
+/**
+ * Find a task's slot, or claim a free one
+ * @return Slot, or NULL when the table is full
+ */
+inline CpuTaskStat* cpuTaskSlot(TaskHandle_t handle, bool& isNew) {
+  CpuTaskStat* free = NULL;
+  for (int i = 0; i < CPU_MAX_TASKS; i++) {
+    if (cpuTasks[i].handle == handle) {
+      isNew = false;
+      return &cpuTasks[i];
+    }
+    if (!free && cpuTasks[i].handle == NULL) free = &cpuTasks[i];
+  }
+  if (free) {
+    memset(free->pct, 0, sizeof(free->pct));
+    free->handle = handle;
+  }
+  isNew = true;
+  return free;
+}
+
+// ===========================================
+// SAMPLING
+// ===========================================
+
+/**
+ * Take a sample if CPU_SAMPLE_MS has passed (call from the web task)
+ */
+inline void sampleCpuStats() {
+#if CPU_STATS_AVAILABLE
+  unsigned long now = millis();
+  if (cpuPrimed && now - cpuLastSample < CPU_SAMPLE_MS) return;
+  cpuLastSample = now;
+
+  static TaskStatus_t status[CPU_MAX_TASKS];
+  uint32_t total = 0;
+  UBaseType_t n = uxTaskGetSystemState(status, CPU_MAX_TASKS, &total);
+  if (n == 0) {
+    UBaseType_t tasks = uxTaskGetNumberOfTasks();
+    if (tasks > CPU_MAX_TASKS && !cpuOverflow) {
+      Serial.printf("[CPU] %u tasks exceed CPU_MAX_TASKS (%d), sampling paused\n",
+        (unsigned)tasks, CPU_MAX_TASKS);
+    }
+    cpuOverflow = tasks > CPU_MAX_TASKS;
+    return;
+  }
+  cpuOverflow = false;
+
+  // Run time counters are 32-bit microseconds; unsigned deltas survive the wrap
+  uint32_t elapsed = total - cpuLastTotal;
+  cpuLastTotal = total;
+  bool record = cpuPrimed && elapsed > 0;
+  cpuPrimed = true;
+
+  for (int i = 0; i < CPU_MAX_TASKS; i++) cpuTasks[i].seen = false;
+
+  uint16_t idle[2] = {0, 0};
+  uint32_t idleUs[2] = {0, 0};
+
+  for (UBaseType_t i = 0; i < n; i++) {
+    const TaskStatus_t& s = status[i];
+    bool isNew;
+    CpuTaskStat* t = cpuTaskSlot(s.xHandle, isNew);
+    if (!t) continue;
+
+    uint32_t delta = isNew ? 0 : s.ulRunTimeCounter - t->lastRunTime;
+    t->lastRunTime = s.ulRunTimeCounter;
+    t->seen = true;
+    strlcpy(t->name, s.pcTaskName, sizeof(t->name));
+    t->core = (s.xCoreID == tskNO_AFFINITY) ? -1 : (int8_t)s.xCoreID;
+    t->priority = s.uxCurrentPriority;
+
+    uint16_t pct = 0;
+    if (record) {
+      pct = (uint16_t)min((uint64_t)1000, (uint64_t)delta * 1000 / elapsed);
+      t->pct[cpuHead] = pct;
+    }
+
+    // One idle task per core ("IDLE" or "IDLE0"/"IDLE1", pinned)
+    if (strncmp(s.pcTaskName, "IDLE", 4) == 0 && t->core >= 0 && t->core < 2) {
+      idle[t->core] = pct;
+      idleUs[t->core] = delta;
+    }
+  }
+
+  // Drop tasks that were deleted since the last sample
+  for (int i = 0; i < CPU_MAX_TASKS; i++) {
+    if (cpuTasks[i].handle && !cpuTasks[i].seen) cpuTasks[i].handle = NULL;
+  }
+
+  if (!record) return;
+
+  for (int c = 0; c < 2; c++) {
+    cpuCoreBusy[c][cpuHead] = 1000 - idle[c];
+    cpuCoreIdleMs[c][cpuHead] = idleUs[c] / 1000;
+  }
+  cpuLastIntervalMs = elapsed / 1000;
+  cpuHead = (cpuHead + 1) % CPU_WINDOW_SAMPLES;
+  if (cpuFilled < CPU_WINDOW_SAMPLES) cpuFilled++;
+
+  CpuSummary summary;
+  summary.valid = true;
+  for (int c = 0; c < 2; c++) {
+    summary.coreBusy[c] = cpuCoreBusy[c][cpuLatestSlot()];
+    summary.coreAvg[c] = cpuWindowAvg(cpuCoreBusy[c]);
+    summary.idleMs[c] = cpuWindowIdleMs(c);
+  }
+  for (int i = 0; i < CPU_MAX_TASKS; i++) {
+    const CpuTaskStat& t = cpuTasks[i];
+    if (!t.handle) continue;
+    if (t.handle == ledTaskHandle) summary.ledAvg = cpuWindowAvg(t.pct);
+    else if (strcmp(t.name, "wifi") == 0) summary.wifiAvg = cpuWindowAvg(t.pct);
+  }
+
+  portENTER_CRITICAL(&cpuMux);
+  cpuSummary = summary;
+  portEXIT_CRITICAL(&cpuMux);
+#endif
+}
+
+/**
+ * Copy the headline numbers (any task)
+ */
+inline CpuSummary cpuSnapshot() {
+  portENTER_CRITICAL(&cpuMux);
+  CpuSummary s = cpuSummary;
+  portEXIT_CRITICAL(&cpuMux);
+  return s;
+}
+
+#endif // SYSTEM_CPU_STATS_H
@@ -14,6 +14,7 @@
 #include <esp_task_wdt.h>
 #include "../config.h"
 #include "../effects/effects_base.h"
+#include "../storage/outage_log.h"
 
 // ===========================================
 // EXTERNAL REFERENCES
@@ -118,6 +119,9 @@ inline void checkBootButtonFactoryReset() {
       preferences.clear();
       preferences.end();
       
+      // And the outage journal
+      clearOutageLog();
+      
       Serial.println("NVS cleared successfully!");
       
       // Success indication: green
@@ -0,0 +1,454 @@
+#ifndef SYSTEM_METRICS_H
+#define SYSTEM_METRICS_H
+
+/**
+ * @file metrics.h
+ * @brief One schema for /stats, the MQTT state payload and /metrics
+ *
+ * captureMetrics() takes one consistent copy of everything the outputs
+ * report. metricFields[] lists each value once, with its key on each
+ * path (nullptr = not on that path), so the dashboard, Home Assistant
+ * and Prometheus can't drift apart on what a value means or how it is
+ * rounded.
+ *
+ * writeMetricField() emits one entry through a JsonWriter; /metrics
+ * (web/metrics_handlers.h) walks the same table. Nothing here touches
+ * the heap. Absent values are left out rather than sent as null:
+ * a nullptr or empty string, a NaN float (CPU load before the first
+ * sample). Any task may capture; the snapshot lives on the caller's stack.
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_wifi.h>
+#include <stddef.h>
+#include "../config.h"
+#include "../core/types.h"
+#include "../core/state.h"
+#include "../core/clock.h"
+#include "../core/json_writer.h"
+#include "../network/throughput_config.h"
+#include "cpu_stats.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern PerformanceMetrics perf;
+extern QualityMetrics quality;
+extern SegmentStatus segment;
+extern ThroughputResult throughputResult;
+
+// ===========================================
+// STATE TEXT HELPERS
+// ===========================================
+
+/**
+ * Get machine-readable state text
+ */
+inline const char* getStateText(int state) {
+  switch (state) {
+    case STATE_INTERNET_OK: return "online";
+    case STATE_INTERNET_DEGRADED: return "degraded";
+    case STATE_INTERNET_DOWN: return "offline";
+    case STATE_ROUTER_UNREACHABLE: return "router_unreachable";
+    case STATE_DNS_FAILING: return "dns_failing";
+    case STATE_WIFI_LOST: return "no_wifi";
+    case STATE_CONFIG_PORTAL: return "setup";
+    case STATE_CONNECTING_WIFI: return "connecting";
+    case STATE_BOOTING: return "booting";
+    default: return "unknown";
+  }
+}
+
+/**
+ * Get human-friendly state text
+ */
+inline const char* getStateFriendly(int state) {
+  switch (state) {
+    case STATE_INTERNET_OK: return "Online";
+    case STATE_INTERNET_DEGRADED: return "Degraded";
+    case STATE_INTERNET_DOWN: return "Offline";
+    case STATE_ROUTER_UNREACHABLE: return "Router Unreachable";
+    case STATE_DNS_FAILING: return "DNS Failing";
+    case STATE_WIFI_LOST: return "No WiFi";
+    case STATE_CONFIG_PORTAL: return "Setup Mode";
+    case STATE_CONNECTING_WIFI: return "Connecting";
+    case STATE_BOOTING: return "Booting";
+    default: return "Unknown";
+  }
+}
+
+/**
+ * Get the dashboard's status label
+ */
+inline const char* getStateLabel(int state) {
+  switch (state) {
+    case STATE_INTERNET_OK: return "ONLINE";
+    case STATE_INTERNET_DEGRADED: return "DEGRADED";
+    case STATE_INTERNET_DOWN: return "OFFLINE";
+    case STATE_ROUTER_UNREACHABLE: return "ROUTER DOWN";
+    case STATE_DNS_FAILING: return "DNS FAILING";
+    case STATE_WIFI_LOST: return "NO WIFI";
+    default: return "STARTING";
+  }
+}
+
+// ===========================================
+// SNAPSHOT
+// ===========================================
+
+struct MetricsSnapshot {
+  // State
+  int32_t state;
+  const char* label;              // "ONLINE" (dashboard)
+  const char* status;             // "online"
+  const char* friendly;           // "Online"
+
+  // Uptime and checks
+  uint64_t uptimeMs;
+  uint64_t checks;
+  uint64_t successful;
+  uint64_t failed;
+  int32_t consecutiveFailures;
+  float successRate;
+  uint64_t downtimeMs;
+  uint64_t lastOutageMs;
+
+  // Wall clock (0 / empty until the first SNTP sync)
+  const char* clock;
+  uint64_t utc;
+  uint64_t since;                 // State change, Unix seconds
+  char utcIso[24];
+  char sinceIso[24];
+
+  // Segment probes and link quality
+  bool gatewayOk;
+  uint64_t gatewayRttMs;
+  bool dnsOk;
+  uint64_t quality;
+  float lossPct;
+  float jitterMs;
+  float burstRttMs;
+
+  // Throughput (last test)
+  float downMbps;
+  float upMbps;
+  bool tputRunning;
+
+  // Network
+  int32_t rssi;
+  char ssid[33];
+  char ip[16];
+
+  // System
+  uint64_t heap;
+  uint64_t minHeap;
+  float temp;
+  uint64_t cpuFreq;
+  const char* version;
+
+  // Performance
+  float ledFps;
+  uint64_t ledFrameUs;
+  uint64_t ledMaxFrameUs;
+  uint64_t ledStack;
+  uint64_t ledJitterUs;
+  uint64_t netStack;
+  uint64_t stateLockNs;
+  uint64_t stateLockMaxNs;
+
+  // CPU load, rolling window average (NaN until sampled)
+  float cpuCore0;
+  float cpuCore1;
+  float cpuLed;
+  float cpuWifi;
+
+  // Static
+  uint64_t effects;
+  bool dualCore;
+};
+
+/**
+ * Take a consistent copy of everything the schema reports
+ */
+inline void captureMetrics(MetricsSnapshot& m) {
+  // One copy of the counters, so e.g. failed never exceeds checks
+  SystemStats snap;
+  State state = statsSnapshot(snap);
+
+  m.state = state;
+  m.label = getStateLabel(state);
+  m.status = getStateText(state);
+  m.friendly = getStateFriendly(state);
+
+  m.uptimeMs = clockMonoMs() - snap.bootTime;
+  m.checks = snap.totalChecks;
+  m.successful = snap.successfulChecks;
+  m.failed = snap.failedChecks;
+  m.consecutiveFailures = snap.consecutiveFailures;
+  m.successRate = statsSuccessRate(snap);
+  m.downtimeMs = snap.totalDowntimeMs;
+  m.lastOutageMs = snap.lastDowntime;
+
+  m.clock = clockStateText();
+  m.utc = clockUtcSec();
+  m.since = clockUtcAt(snap.lastChangeMono);
+  m.utcIso[0] = '\0';
+  m.sinceIso[0] = '\0';
+  if (clockSynced()) {
+    clockFormatIso(m.utc, m.utcIso, sizeof(m.utcIso));
+    clockFormatIso(m.since, m.sinceIso, sizeof(m.sinceIso));
+  }
+
+  m.gatewayOk = segment.gatewayOk;
+  m.gatewayRttMs = segment.gatewayRttMs;
+  m.dnsOk = segment.dnsOk;
+  m.quality = quality.score;
+  m.lossPct = quality.lossPct;
+  m.jitterMs = quality.jitterMs;
+  m.burstRttMs = quality.rttMs;
+
+  m.downMbps = throughputResult.downMbps;
+  m.upMbps = throughputResult.upMbps;
+  m.tputRunning = throughputResult.running;
+
+  // RSSI and SSID from one driver call (WiFi.SSID() would return a String)
+  wifi_ap_record_t ap;
+  m.rssi = 0;
+  m.ssid[0] = '\0';
+  if (esp_wifi_sta_get_ap_info(&ap) == ESP_OK) {
+    m.rssi = ap.rssi;
+    strlcpy(m.ssid, (const char*)ap.ssid, sizeof(m.ssid));
+  }
+  IPAddress ip = WiFi.localIP();
+  snprintf(m.ip, sizeof(m.ip), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+
+  m.heap = ESP.getFreeHeap();
+  m.minHeap = ESP.getMinFreeHeap();
+  m.temp = getChipTemp();
+  m.cpuFreq = ESP.getCpuFreqMHz();
+  m.version = FW_VERSION;
+
+  m.ledFps = perf.ledActualFPS;
+  m.ledFrameUs = perf.ledFrameTimeUs;
+  m.ledMaxFrameUs = perf.ledMaxFrameTimeUs;
+  m.ledStack = perf.ledStackHighWater * 4;
+  m.ledJitterUs = perf.ledJitterUs;
+  m.netStack = perf.netStackHighWater * 4;
+  m.stateLockNs = lockCyclesToNs(perf.stateLockCycles);
+  m.stateLockMaxNs = lockCyclesToNs(perf.stateLockMaxCycles);
+
+  CpuSummary cpu = cpuSnapshot();
+  m.cpuCore0 = cpu.valid ? cpu.coreAvg[0] / 10.0f : NAN;
+  m.cpuCore1 = cpu.valid ? cpu.coreAvg[1] / 10.0f : NAN;
+  m.cpuLed = cpu.valid ? cpu.ledAvg / 10.0f : NAN;
+  m.cpuWifi = cpu.valid ? cpu.wifiAvg / 10.0f : NAN;
+
+  m.effects = NUM_EFFECTS;
+  m.dualCore = true;
+}
+
+// ===========================================
+// SCHEMA
+// ===========================================
+
+enum MetricType : uint8_t {
+  METRIC_UINT,      // uint64_t
+  METRIC_INT,       // int32_t
+  METRIC_FLOAT1,    // float, 1 decimal
+  METRIC_FLOAT2,    // float, 2 decimals
+  METRIC_BOOL,
+  METRIC_STR,       // const char*
+  METRIC_CHARS      // char[]
+};
+
+enum MetricFormat : uint8_t {
+  METRICS_WEB,      // /stats, /api/dashboard, /api/live
+  METRICS_MQTT      // State topic payload
+};
+
+// Flags
+#define METRIC_MQTT_SECONDS  0x01   // Milliseconds, whole seconds on MQTT
+#define METRIC_PROM_SECONDS  0x02   // Milliseconds, seconds on /metrics
+#define METRIC_COUNTER       0x04   // Only goes up (Prometheus counter, else gauge)
+
+struct MetricField {
+  const char* web;          // /stats key
+  const char* mqtt;         // MQTT payload key
+  const char* prom;         // /metrics name, after the "internet_monitor_" prefix
+  const char* help;         // /metrics HELP text
+  MetricType type;
+  uint8_t flags;
+  uint16_t offset;          // Into MetricsSnapshot
+};
+
+#define METRIC(web, mqtt, type, member, flags, prom, help) \
+  {web, mqtt, prom, help, type, flags, offsetof(MetricsSnapshot, member)}
+
+#define MS_S (METRIC_MQTT_SECONDS | METRIC_PROM_SECONDS)
+
+// Order is the order of the keys on every path
+static const MetricField metricFields[] = {
+  // State
+  METRIC("state", "state", METRIC_INT, state, 0,
+         "state", "Connectivity state (4 online, 5 degraded, 6 offline, 7 router down, 8 DNS failing)"),
+  METRIC("stateText", nullptr, METRIC_STR, label, 0, nullptr, nullptr),
+  METRIC(nullptr, "status", METRIC_STR, status, 0, nullptr, nullptr),
+  METRIC(nullptr, "state_text", METRIC_STR, friendly, 0, nullptr, nullptr),
+
+  // Uptime and checks
+  METRIC("uptime", "uptime_seconds", METRIC_UINT, uptimeMs, MS_S,
+         "uptime_seconds", "Time since boot"),
+  METRIC("checks", "total_checks", METRIC_UINT, checks, METRIC_COUNTER,
+         "checks_total", "Connectivity checks run"),
+  METRIC(nullptr, "successful_checks", METRIC_UINT, successful, 0, nullptr, nullptr),
+  METRIC("failed", "failed_checks", METRIC_UINT, failed, METRIC_COUNTER,
+         "checks_failed_total", "Connectivity checks that failed"),
+  METRIC("rate", "success_rate", METRIC_FLOAT1, successRate, 0, nullptr, nullptr),
+  METRIC(nullptr, "consecutive_failures", METRIC_INT, consecutiveFailures, 0,
+         "consecutive_failures", "Failed checks in a row"),
+  METRIC("downtime", "total_downtime_seconds", METRIC_UINT, downtimeMs, MS_S | METRIC_COUNTER,
+         "downtime_seconds_total", "Time offline since boot"),
+  METRIC("lastOutage", "last_outage_seconds", METRIC_UINT, lastOutageMs, MS_S,
+         "last_outage_seconds", "Length of the last finished outage"),
+
+  // Wall clock
+  METRIC("utc", nullptr, METRIC_UINT, utc, 0, nullptr, nullptr),
+  METRIC("clock", "clock", METRIC_STR, clock, 0, nullptr, nullptr),
+  METRIC("since", nullptr, METRIC_UINT, since, 0, nullptr, nullptr),
+  METRIC(nullptr, "time", METRIC_CHARS, utcIso, 0, nullptr, nullptr),
+  METRIC(nullptr, "state_since", METRIC_CHARS, sinceIso, 0, nullptr, nullptr),
+
+  // Throughput (last test)
+  METRIC("downMbps", "download_mbps", METRIC_FLOAT2, downMbps, 0,
+         "download_mbps", "Download rate, last throughput test"),
+  METRIC("upMbps", "upload_mbps", METRIC_FLOAT2, upMbps, 0,
+         "upload_mbps", "Upload rate, last throughput test"),
+  METRIC("tputRunning", nullptr, METRIC_BOOL, tputRunning, 0, nullptr, nullptr),
+
+  // Segment probes (which hop is failing)
+  METRIC("gateway", "gateway_ok", METRIC_BOOL, gatewayOk, 0,
+         "gateway_up", "Gateway answered the last probe"),
+  METRIC("gatewayRtt", nullptr, METRIC_UINT, gatewayRttMs, METRIC_PROM_SECONDS,
+         "gateway_rtt_seconds", "Gateway ping round trip"),
+  METRIC("dns", "dns_ok", METRIC_BOOL, dnsOk, 0,
+         "dns_up", "Resolver answered the last probe"),
+
+  // Link quality (last probe burst)
+  METRIC("quality", "link_quality", METRIC_UINT, quality, 0,
+         "link_quality", "Link quality score (0-100)"),
+  METRIC("loss", "packet_loss", METRIC_FLOAT1, lossPct, 0,
+         "packet_loss_percent", "Packet loss, last probe burst"),
+  METRIC("jitter", "jitter_ms", METRIC_FLOAT1, jitterMs, METRIC_PROM_SECONDS,
+         "jitter_seconds", "Interarrival jitter (RFC 3550), probe bursts"),
+  METRIC("burstRtt", "burst_rtt_ms", METRIC_FLOAT1, burstRttMs, METRIC_PROM_SECONDS,
+         "burst_rtt_seconds", "Mean round trip, last probe burst"),
+
+  // Network info
+  METRIC("rssi", "wifi_rssi", METRIC_INT, rssi, 0,
+         "wifi_rssi_dbm", "WiFi signal strength"),
+  METRIC(nullptr, "wifi_ssid", METRIC_CHARS, ssid, 0, nullptr, nullptr),
+  METRIC(nullptr, "ip_address", METRIC_CHARS, ip, 0, nullptr, nullptr),
+
+  // System info
+  METRIC("heap", "free_heap", METRIC_UINT, heap, 0,
+         "heap_free_bytes", "Free heap"),
+  METRIC("minHeap", nullptr, METRIC_UINT, minHeap, 0,
+         "heap_min_free_bytes", "Lowest free heap since boot"),
+  METRIC("temp", "temperature", METRIC_FLOAT1, temp, 0,
+         "temperature_celsius", "Chip temperature"),
+  METRIC("cpuFreq", nullptr, METRIC_UINT, cpuFreq, 0, nullptr, nullptr),
+
+  // Performance
+  METRIC("ledFps", "led_fps", METRIC_FLOAT1, ledFps, 0,
+         "led_fps", "LED frames per second"),
+  METRIC("ledFrameUs", nullptr, METRIC_UINT, ledFrameUs, 0, nullptr, nullptr),
+  METRIC("ledMaxFrameUs", nullptr, METRIC_UINT, ledMaxFrameUs, 0, nullptr, nullptr),
+  METRIC("ledStack", nullptr, METRIC_UINT, ledStack, 0,
+         "led_stack_free_bytes", "LED task stack never used"),
+  METRIC("ledJitterUs", nullptr, METRIC_UINT, ledJitterUs, 0, nullptr, nullptr),
+  METRIC("netStack", nullptr, METRIC_UINT, netStack, 0,
+         "net_stack_free_bytes", "Network task stack never used"),
+  METRIC("stateLockNs", nullptr, METRIC_UINT, stateLockNs, 0, nullptr, nullptr),
+  METRIC("stateLockMaxNs", nullptr, METRIC_UINT, stateLockMaxNs, 0, nullptr, nullptr),
+
+  // CPU load (the dashboard gets the full "cpu" object, /metrics per task)
+  METRIC(nullptr, "cpu_core0", METRIC_FLOAT1, cpuCore0, 0, nullptr, nullptr),
+  METRIC(nullptr, "cpu_core1", METRIC_FLOAT1, cpuCore1, 0, nullptr, nullptr),
+  METRIC(nullptr, "cpu_led", METRIC_FLOAT1, cpuLed, 0, nullptr, nullptr),
+  METRIC(nullptr, "cpu_wifi", METRIC_FLOAT1, cpuWifi, 0, nullptr, nullptr),
+
+  // Static info
+  METRIC("effects", nullptr, METRIC_UINT, effects, 0, nullptr, nullptr),
+  METRIC("dualCore", nullptr, METRIC_BOOL, dualCore, 0, nullptr, nullptr),
+  METRIC("version", "firmware", METRIC_STR, version, 0, nullptr, nullptr),
+};
+
+#undef METRIC
+#undef MS_S
+
+#define METRIC_FIELD_COUNT (sizeof(metricFields) / sizeof(metricFields[0]))
+
+// The field's value in the snapshot
+template <typename T>
+inline const T& metricValue(const MetricField& f, const MetricsSnapshot& m) {
+  return *(const T*)((const uint8_t*)&m + f.offset);
+}
+
+// ===========================================
+// OUTPUT
+// ===========================================
+
+/**
+ * Write one schema entry as a "key":value member of the open object
+ * Writes nothing if the field isn't on this path or has no value.
+ */
+inline void writeMetricField(JsonWriter& out, const MetricField& f,
+                             const MetricsSnapshot& m, MetricFormat format) {
+  const char* k = format == METRICS_MQTT ? f.mqtt : f.web;
+  if (!k) return;
+
+  switch (f.type) {
+    case METRIC_UINT: {
+      uint64_t v = metricValue<uint64_t>(f, m);
+      if (format == METRICS_MQTT && (f.flags & METRIC_MQTT_SECONDS)) v /= 1000;
+      out.field(k, (unsigned long long)v);
+      break;
+    }
+    case METRIC_INT:
+      out.field(k, (long)metricValue<int32_t>(f, m));
+      break;
+    case METRIC_FLOAT1:
+    case METRIC_FLOAT2: {
+      float v = metricValue<float>(f, m);
+      if (isnan(v)) return;
+      out.field(k, v, f.type == METRIC_FLOAT1 ? 1 : 2);
+      break;
+    }
+    case METRIC_BOOL:
+      out.field(k, metricValue<bool>(f, m));
+      break;
+    case METRIC_STR: {
+      const char* s = metricValue<const char*>(f, m);
+      if (s && s[0]) out.field(k, s);
+      break;
+    }
+    case METRIC_CHARS: {
+      const char* s = &metricValue<char>(f, m);
+      if (s[0]) out.field(k, s);
+      break;
+    }
+  }
+}
+
+/**
+ * Write every schema entry for one path into the open object
+ */
+inline void writeMetricFields(JsonWriter& out, const MetricsSnapshot& m, MetricFormat format) {
+  for (size_t i = 0; i < METRIC_FIELD_COUNT; i++) {
+    writeMetricField(out, metricFields[i], m, format);
+  }
+}
+
+#endif // SYSTEM_METRICS_H
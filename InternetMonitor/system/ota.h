@@ -14,6 +14,7 @@
 #include <Adafruit_NeoPixel.h>
 #include <esp_task_wdt.h>
 #include "../config.h"
+#include "../storage/outage_log.h"
 
 // ===========================================
 // EXTERNAL DECLARATIONS
@@ -47,6 +48,8 @@ inline void setupOTA() {
     vTaskDelay(pdMS_TO_TICKS(50));  // Wait for current frame
     // Disable watchdog during OTA to prevent resets
     esp_task_wdt_delete(NULL);
+    // Don't lose queued outage records to the reboot
+    flushOutageLog();
     fillMatrixImmediate(40, 0, 40);
   });
   
@@ -0,0 +1,321 @@
+#ifndef SYSTEM_TASK_BENCH_H
+#define SYSTEM_TASK_BENCH_H
+
+/**
+ * @file task_bench.h
+ * @brief Applying a task layout at runtime and the layout benchmark
+ *
+ * applyTaskLayout() changes priorities in place. The LED and network tasks
+ * move to a new core themselves (see tasks.h), and the MQTT task is
+ * restarted.
+ *
+ * The benchmark walks taskLayoutPresets[]. For each one it applies the
+ * layout, lets it settle, then starts a worker pinned where the network
+ * task would run (same core and priority). The worker runs the fixed
+ * workload:
+ * - BENCH_PROBES probes against the configured targets (probe latency)
+ * - BENCH_HTTP_REQUESTS GETs of "/" from the device's own web server
+ *   (HTTP response time; served by the web task at the web priority)
+ * Meanwhile the LED task's frame jitter and FPS are recorded. The network
+ * task is parked for the whole run so the worker is the only prober, and
+ * the saved layout is restored at the end.
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "../config.h"
+#include "../core/types.h"
+#include "../network/connectivity.h"
+#include "../network/probe_schedule.h"
+#include "../mqtt/mqtt_manager.h"
+#include "task_layout.h"
+#include "tasks.h"
+
+// ===========================================
+// BENCHMARK STATE
+// ===========================================
+
+struct BenchResult {
+  const char* layout = "";      // Preset name (static string)
+  uint32_t ledJitterUs = 0;     // Mean |frame period - 16 ms|
+  uint32_t ledJitterMaxUs = 0;
+  float ledFps = 0.0f;
+  uint32_t probeAvgMs = 0;
+  uint32_t probeMaxMs = 0;
+  uint8_t probeFailures = 0;
+  uint32_t httpAvgMs = 0;
+  uint32_t httpMaxMs = 0;
+  uint8_t httpFailures = 0;
+};
+
+struct BenchStatus {
+  bool running = false;
+  int8_t phase = -1;            // Preset being measured, -1 = idle
+  uint8_t completed = 0;        // Results filled in
+  unsigned long finishedAt = 0; // millis(), 0 = never ran
+  const char* error = "";       // Static string, "" if the last run passed
+  BenchResult results[TASK_LAYOUT_PRESET_COUNT];
+};
+
+extern portMUX_TYPE benchMux;
+extern PerformanceMetrics perf;
+
+static BenchStatus benchStatus;
+static TaskHandle_t benchTaskHandle = NULL;
+static BenchResult benchWork;   // Filled by the worker, copied by the bench task
+
+/**
+ * Copy the benchmark status (web handlers)
+ */
+inline void benchSnapshot(BenchStatus& out) {
+  portENTER_CRITICAL(&benchMux);
+  out = benchStatus;
+  portEXIT_CRITICAL(&benchMux);
+}
+
+// ===========================================
+// APPLYING A LAYOUT
+// ===========================================
+
+/**
+ * True while the LED, network or MQTT task is still moving to a new core
+ */
+inline bool taskRelocationPending() {
+  return ledTaskRelocate || netTaskRelocate || mqttTaskRelocate;
+}
+
+/**
+ * Run the tasks with a new layout
+ * Priorities change in place; core changes take effect once the LED task
+ * finishes its frame, the network task its check and the MQTT task its
+ * pass (a connect attempt may take MQTT_SOCKET_TIMEOUT).
+ * @param next Layout to apply (validated by the caller)
+ */
+inline void applyTaskLayout(const TaskLayout& next) {
+  TaskLayout prev = activeLayout;
+  activeLayout = next;
+
+  if (ledTaskHandle != NULL) {
+    if (next.ledCore != prev.ledCore) ledTaskRelocate = true;
+    else vTaskPrioritySet(ledTaskHandle, next.ledPriority);
+  }
+
+  if (networkTaskHandle != NULL) {
+    if (next.netCore != prev.netCore) {
+      netTaskRelocate = true;
+      xTaskNotifyGive(networkTaskHandle);  // Don't wait for the idle wakeup
+    } else {
+      vTaskPrioritySet(networkTaskHandle, next.netPriority);
+    }
+  }
+
+  if (mqttTaskHandle != NULL) {
+    if (next.mqttCore != prev.mqttCore) {
+      mqttTaskRelocate = true;
+      xTaskNotifyGive(mqttTaskHandle);  // Don't wait for the idle wakeup
+    } else {
+      vTaskPrioritySet(mqttTaskHandle, next.mqttPriority);
+    }
+  }
+
+  if (webTaskHandle != NULL) {
+    vTaskPrioritySet(webTaskHandle, next.webPriority);
+  }
+}
+
+/**
+ * Wait until pending relocations are done
+ * @return false on timeout
+ */
+inline bool waitTaskRelocation(uint32_t timeoutMs) {
+  unsigned long start = millis();
+  while (taskRelocationPending()) {
+    if (millis() - start >= timeoutMs) return false;
+    vTaskDelay(pdMS_TO_TICKS(20));
+  }
+  return true;
+}
+
+// ===========================================
+// BENCHMARK WORKLOAD
+// ===========================================
+
+/**
+ * Worker: fixed workload on the network task's core and priority
+ * Every step has its own timeout, so the worker always finishes.
+ * @param parameter Bench task handle to notify when done
+ */
+inline void benchWorker(void* parameter) {
+  TaskHandle_t owner = (TaskHandle_t)parameter;
+  BenchResult& r = benchWork;
+
+  // Probe latency (shares the probe rate limit with normal checks)
+  ProbeConfig cfg;
+  probeConfigSnapshot(cfg);
+  uint32_t probeTotal = 0;
+  int probes = 0;
+  for (int i = 0; i < BENCH_PROBES; i++) {
+    while (!probeTokensReady(1)) vTaskDelay(pdMS_TO_TICKS(100));
+    takeProbeToken();
+    int index = pickNextTarget(cfg, 0);
+    if (index < 0) break;
+
+    unsigned long start = millis();
+    bool ok = checkTarget(index, cfg);
+    uint32_t ms = millis() - start;
+    if (!ok) r.probeFailures++;
+    probeTotal += ms;
+    if (ms > r.probeMaxMs) r.probeMaxMs = ms;
+    probes++;
+  }
+  r.probeAvgMs = probes > 0 ? probeTotal / probes : 0;
+
+  // HTTP response time of our own web server (login page, no auth)
+  String url = "http://" + WiFi.localIP().toString() + "/";
+  uint32_t httpTotal = 0;
+  int requests = 0;
+  for (int i = 0; i < BENCH_HTTP_REQUESTS; i++) {
+    HTTPClient http;
+    http.setTimeout(BENCH_HTTP_TIMEOUT_MS);
+    http.setConnectTimeout(BENCH_HTTP_TIMEOUT_MS);
+    unsigned long start = millis();
+    bool ok = false;
+    if (http.begin(url)) {
+      ok = (http.GET() == 200) && http.getString().length() > 0;
+      http.end();
+    }
+    uint32_t ms = millis() - start;
+    if (!ok) r.httpFailures++;
+    httpTotal += ms;
+    if (ms > r.httpMaxMs) r.httpMaxMs = ms;
+    requests++;
+  }
+  r.httpAvgMs = requests > 0 ? httpTotal / requests : 0;
+
+  xTaskNotifyGive(owner);
+  vTaskDelete(NULL);
+}
+
+/**
+ * Measure one preset
+ * @return false if the layout couldn't be applied
+ */
+inline bool benchLayout(const TaskLayoutPreset& preset, BenchResult& out) {
+  applyTaskLayout(preset.layout);
+  if (!waitTaskRelocation(BENCH_HOLD_TIMEOUT_MS)) return false;
+  vTaskDelay(pdMS_TO_TICKS(BENCH_SETTLE_MS));
+
+  benchWork = BenchResult();
+  benchWork.layout = preset.name;
+
+  // LED counters before the workload
+  perf.ledJitterPeakReset = true;
+  uint32_t jitterSum = perf.ledJitterSumUs;
+  uint32_t jitterFrames = perf.ledJitterFrames;
+  unsigned long frames = perf.ledFrameCount;
+  unsigned long start = millis();
+
+  TaskHandle_t worker = NULL;
+  xTaskCreatePinnedToCore(benchWorker, "BenchWork", 6144, xTaskGetCurrentTaskHandle(),
+    preset.layout.netPriority, &worker, preset.layout.netCore);
+  if (worker == NULL) return false;
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+  unsigned long elapsed = millis() - start;
+  uint32_t dFrames = perf.ledJitterFrames - jitterFrames;
+  benchWork.ledJitterUs = dFrames > 0 ? (perf.ledJitterSumUs - jitterSum) / dFrames : 0;
+  benchWork.ledJitterMaxUs = perf.ledJitterPeakUs;
+  benchWork.ledFps = elapsed > 0 ? (float)(perf.ledFrameCount - frames) * 1000.0f / elapsed : 0.0f;
+
+  out = benchWork;
+  return true;
+}
+
+// ===========================================
+// BENCHMARK TASK
+// ===========================================
+
+inline void benchTask(void* parameter) {
+  Serial.println("[Bench] Started");
+
+  const char* error = "";
+
+  // Park the network task (it finishes a running check first)
+  netTaskHold = true;
+  if (networkTaskHandle != NULL) xTaskNotifyGive(networkTaskHandle);
+  unsigned long holdStart = millis();
+  while (!netTaskHeld && millis() - holdStart < BENCH_HOLD_TIMEOUT_MS) {
+    vTaskDelay(pdMS_TO_TICKS(50));
+  }
+  if (!netTaskHeld) error = "network task busy";
+
+  for (size_t i = 0; i < TASK_LAYOUT_PRESET_COUNT && error[0] == '\0'; i++) {
+    portENTER_CRITICAL(&benchMux);
+    benchStatus.phase = i;
+    portEXIT_CRITICAL(&benchMux);
+
+    BenchResult r;
+    if (!benchLayout(taskLayoutPresets[i], r)) {
+      error = "layout change failed";
+      break;
+    }
+
+    Serial.printf("[Bench] %-10s | LED jitter %lu us (max %lu) %.1f fps | probe %lu ms (max %lu, %u fail) | http %lu ms (max %lu, %u fail)\n",
+      r.layout, (unsigned long)r.ledJitterUs, (unsigned long)r.ledJitterMaxUs, r.ledFps,
+      (unsigned long)r.probeAvgMs, (unsigned long)r.probeMaxMs, r.probeFailures,
+      (unsigned long)r.httpAvgMs, (unsigned long)r.httpMaxMs, r.httpFailures);
+
+    portENTER_CRITICAL(&benchMux);
+    benchStatus.results[i] = r;
+    benchStatus.completed = i + 1;
+    portEXIT_CRITICAL(&benchMux);
+  }
+
+  // Back to the saved layout, then resume normal checks
+  applyTaskLayout(taskLayout);
+  waitTaskRelocation(BENCH_HOLD_TIMEOUT_MS);
+  netTaskHold = false;
+  if (networkTaskHandle != NULL) xTaskNotifyGive(networkTaskHandle);
+
+  portENTER_CRITICAL(&benchMux);
+  benchStatus.running = false;
+  benchStatus.phase = -1;
+  benchStatus.finishedAt = millis();
+  benchStatus.error = error;
+  portEXIT_CRITICAL(&benchMux);
+
+  Serial.printf("[Bench] Done%s%s\n", error[0] ? ": " : "", error);
+  benchTaskHandle = NULL;
+  vTaskDelete(NULL);
+}
+
+/**
+ * Start the layout benchmark (takes ~BENCH_SETTLE_MS + workload per preset)
+ * @return false if it's already running or a relocation is in progress
+ */
+inline bool startTaskBenchmark() {
+  if (benchTaskHandle != NULL || taskRelocationPending()) {
+    return false;
+  }
+
+  portENTER_CRITICAL(&benchMux);
+  benchStatus = BenchStatus();
+  benchStatus.running = true;
+  portEXIT_CRITICAL(&benchMux);
+
+  xTaskCreatePinnedToCore(
+    benchTask,
+    "Bench",
+    4096,
+    NULL,
+    1,
+    &benchTaskHandle,
+    1
+  );
+  return benchTaskHandle != NULL;
+}
+
+#endif // SYSTEM_TASK_BENCH_H
@@ -0,0 +1,143 @@
+#ifndef SYSTEM_TASK_LAYOUT_H
+#define SYSTEM_TASK_LAYOUT_H
+
+/**
+ * @file task_layout.h
+ * @brief Core affinity and priorities of the LED, network, MQTT and web tasks
+ *
+ * Defines the TaskLayout struct, the presets the benchmark walks through
+ * (see task_bench.h) and NVS persistence. The web server task stays on
+ * ARDUINO_RUNNING_CORE next to loop() (OTA), so only its priority is
+ * configurable.
+ */
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "../config.h"
+
+// Bump when the TaskLayout layout changes (stale blobs fall back to defaults)
+#define TASK_LAYOUT_VERSION  1
+
+// ===========================================
+// DEFAULT LAYOUT
+// ===========================================
+
+#define LED_CORE 0          // Core for LED effects (smooth animation)
+#define NETWORK_CORE 1      // Core for network operations
+#define MQTT_TASK_CORE 1    // MQTT next to the network task
+#define LED_TASK_PRIORITY 2 // Higher priority for smooth animation
+#define NET_TASK_PRIORITY 1 // Lower priority for network
+#define MQTT_TASK_PRIORITY 1 // Same as network task
+#define WEB_TASK_PRIORITY 1 // Web server task (same as loop())
+
+// ===========================================
+// TASK LAYOUT STRUCT
+// ===========================================
+
+struct TaskLayout {
+  uint8_t version = TASK_LAYOUT_VERSION;
+  uint8_t ledCore = LED_CORE;
+  uint8_t ledPriority = LED_TASK_PRIORITY;
+  uint8_t netCore = NETWORK_CORE;
+  uint8_t netPriority = NET_TASK_PRIORITY;
+  uint8_t mqttCore = MQTT_TASK_CORE;
+  uint8_t mqttPriority = MQTT_TASK_PRIORITY;
+  uint8_t webPriority = WEB_TASK_PRIORITY;
+};
+
+struct TaskLayoutPreset {
+  const char* name;
+  TaskLayout layout;
+};
+
+// Layouts the benchmark compares (core 0 also runs the WiFi/lwIP tasks)
+static const TaskLayoutPreset taskLayoutPresets[] = {
+  // name         version, LED core/prio, net core/prio, MQTT core/prio, web prio
+  {"default",     {TASK_LAYOUT_VERSION, 0, 2, 1, 1, 1, 1, 1}},
+  {"led-core1",   {TASK_LAYOUT_VERSION, 1, 2, 1, 1, 1, 1, 1}},  // Everything off the WiFi core
+  {"net-core0",   {TASK_LAYOUT_VERSION, 0, 2, 0, 1, 0, 1, 1}},  // Network next to lwIP
+  {"swapped",     {TASK_LAYOUT_VERSION, 1, 2, 0, 1, 0, 1, 1}},
+  {"net-first",   {TASK_LAYOUT_VERSION, 0, 1, 1, 2, 1, 2, 1}},  // Probes outrank the LEDs
+};
+#define TASK_LAYOUT_PRESET_COUNT (sizeof(taskLayoutPresets) / sizeof(taskLayoutPresets[0]))
+
+// ===========================================
+// GLOBAL INSTANCES
+// ===========================================
+
+extern TaskLayout taskLayout;  // Saved layout (applied at boot)
+extern Preferences preferences;
+
+// Layout the tasks were last started with (differs from taskLayout while
+// the benchmark runs)
+static TaskLayout activeLayout;
+
+// ===========================================
+// VALIDATION
+// ===========================================
+
+/**
+ * Check a layout before applying it
+ * @param l Layout to check
+ * @return Error message, or nullptr if valid
+ */
+inline const char* taskLayoutError(const TaskLayout& l) {
+  if (l.ledCore > 1 || l.netCore > 1 || l.mqttCore > 1) {
+    return "core must be 0 or 1";
+  }
+  if (l.ledPriority < 1 || l.ledPriority > TASK_PRIORITY_MAX ||
+      l.netPriority < 1 || l.netPriority > TASK_PRIORITY_MAX ||
+      l.mqttPriority < 1 || l.mqttPriority > TASK_PRIORITY_MAX ||
+      l.webPriority < 1 || l.webPriority > TASK_PRIORITY_MAX) {
+    return "priority must be 1-5";
+  }
+  return nullptr;
+}
+
+inline bool taskLayoutEqual(const TaskLayout& a, const TaskLayout& b) {
+  return memcmp(&a, &b, sizeof(TaskLayout)) == 0;
+}
+
+/**
+ * Name of the preset matching a layout
+ * @return Preset name, or "custom"
+ */
+inline const char* taskLayoutName(const TaskLayout& l) {
+  for (size_t i = 0; i < TASK_LAYOUT_PRESET_COUNT; i++) {
+    if (taskLayoutEqual(l, taskLayoutPresets[i].layout)) return taskLayoutPresets[i].name;
+  }
+  return "custom";
+}
+
+// ===========================================
+// NVS PERSISTENCE FUNCTIONS
+// ===========================================
+
+inline void loadTaskLayoutFromNVS() {
+  TaskLayout l;
+  bool loaded = false;
+
+  preferences.begin(NVS_NAMESPACE, true);  // read-only
+  if (preferences.getBytesLength(NVS_KEY_TASK_LAYOUT) == sizeof(TaskLayout)) {
+    preferences.getBytes(NVS_KEY_TASK_LAYOUT, &l, sizeof(TaskLayout));
+    loaded = (l.version == TASK_LAYOUT_VERSION) && taskLayoutError(l) == nullptr;
+  }
+  preferences.end();
+
+  taskLayout = loaded ? l : TaskLayout();
+  activeLayout = taskLayout;
+
+  Serial.printf("[Tasks] %s layout \"%s\" (LED core %u, network core %u, MQTT core %u)\n",
+    loaded ? "Loaded" : "Default", taskLayoutName(taskLayout),
+    taskLayout.ledCore, taskLayout.netCore, taskLayout.mqttCore);
+}
+
+inline void saveTaskLayoutToNVS(const TaskLayout& l) {
+  preferences.begin(NVS_NAMESPACE, false);  // read-write
+  preferences.putBytes(NVS_KEY_TASK_LAYOUT, &l, sizeof(TaskLayout));
+  preferences.end();
+
+  Serial.println("[Tasks] Layout saved to NVS");
+}
+
+#endif // SYSTEM_TASK_LAYOUT_H
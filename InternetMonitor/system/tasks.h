@@ -5,11 +5,16 @@
  * @file tasks.h
  * @brief FreeRTOS task management for dual-core operation
  * 
- * Architecture:
+ * Architecture (default layout, configurable via /tasks, see task_layout.h):
  * - Core 0: LED task (60fps, high priority, never blocks)
  * - Core 1: Network task (internet checks, lower priority)
  * - Core 1: MQTT task (runs separately, see mqtt_manager.h)
+ * - Core 1: Throughput task (idle priority, see throughput.h)
  * - Main loop: Web server, OTA (runs on Core 1)
+ *
+ * The LED and network tasks can't be re-pinned in place. When their core
+ * changes they start a replacement on the new core at a safe point in
+ * their loop and delete themselves.
  */
 
 #include <Arduino.h>
@@ -17,19 +22,18 @@
 #include <freertos/task.h>
 #include <WiFi.h>
 #include <esp_task_wdt.h>
+#include <Adafruit_NeoPixel.h>
 #include "../config.h"
 #include "../core/types.h"
 #include "../core/state.h"
+#include "../core/histogram.h"
 #include "../network/connectivity.h"
-
-// ===========================================
-// DUAL CORE CONFIGURATION
-// ===========================================
-
-#define LED_CORE 0          // Core for LED effects (smooth animation)
-#define NETWORK_CORE 1      // Core for network operations
-#define LED_TASK_PRIORITY 2 // Higher priority for smooth animation
-#define NET_TASK_PRIORITY 1 // Lower priority for network
+#include "../network/probe_burst.h"
+#include "../network/segment_probe.h"
+#include "../network/throughput_config.h"
+#include "../storage/history.h"
+#include "../storage/outage_log.h"
+#include "task_layout.h"
 
 // Performance logging interval
 #define PERF_LOG_INTERVAL 5000  // Log every 5 seconds
@@ -40,6 +44,7 @@
 
 extern TaskHandle_t ledTaskHandle;
 extern TaskHandle_t networkTaskHandle;
+extern TaskHandle_t webTaskHandle;
 extern SystemStats stats;
 extern PerformanceMetrics perf;
 
@@ -54,6 +59,19 @@ extern unsigned long lastCheck;
 // From effects_base.h / effects.h
 extern void updateFade();
 extern void applyEffect();
+extern void resetAllEffectState();
+extern Adafruit_NeoPixel pixels;
+
+// Relocation to activeLayout's core (set by applyTaskLayout())
+static volatile bool ledTaskRelocate = false;
+static volatile bool netTaskRelocate = false;
+
+// Benchmark hold: network task parks instead of checking
+static volatile bool netTaskHold = false;
+static volatile bool netTaskHeld = false;
+
+inline void startLEDTask();
+inline void startNetworkTask();
 
 // ===========================================
 // LED TASK (Core 0) - Smooth 60fps animation
@@ -62,7 +80,10 @@ extern void applyEffect();
 /**
  * LED rendering task - runs on Core 0
  * Maintains 60fps with precise timing via vTaskDelayUntil.
- * Updates fade transitions and applies current effect.
+ * Takes one render snapshot per frame (render_params.h), picks up state
+ * changes from the event bus, updates fade transitions and applies
+ * current effect. Effect switches and brightness are applied here so
+ * effect state and the pixel buffer are only touched by this task.
  * Reports FPS and frame timing every 5 seconds.
  * 
  * @param parameter Unused task parameter
@@ -77,6 +98,15 @@ inline void ledTask(void* parameter) {
   unsigned long frameStartUs;
   unsigned long maxFrameUs = 0;
   
+  // Frame period jitter (deviation from the 16 ms tick)
+  unsigned long lastFrameUs = 0;
+  uint32_t jitterSumUs = 0;
+  
+  // Last applied settings (effect switch resets effect state)
+  readRenderParams(render);
+  uint8_t shownEffect = render.effect;
+  uint8_t shownBrightness = render.brightness;
+  
   Serial.println("[LED Task] Started on Core " + String(xPortGetCoreID()));
   
   // Add this task to watchdog
@@ -86,6 +116,37 @@ inline void ledTask(void* parameter) {
     esp_task_wdt_reset();
     frameStartUs = micros();
     
+    if (lastFrameUs != 0) {
+      long periodUs = (long)(frameStartUs - lastFrameUs);
+      uint32_t jitter = abs(periodUs - 16000L);
+      jitterSumUs += jitter;
+      perf.ledJitterSumUs += jitter;
+      perf.ledJitterFrames++;
+      if (perf.ledJitterPeakReset) {
+        perf.ledJitterPeakUs = 0;
+        perf.ledJitterPeakReset = false;
+      }
+      if (jitter > perf.ledJitterPeakUs) perf.ledJitterPeakUs = jitter;
+    }
+    lastFrameUs = frameStartUs;
+    
+    // One consistent settings snapshot for the whole frame
+    readRenderParams(render);
+    if (render.effect != shownEffect) {
+      resetAllEffectState();  // Clean start for the new effect
+      shownEffect = render.effect;
+    }
+    if (render.brightness != shownBrightness && !ledTaskPaused) {  // OTA/reset own the pixels
+      pixels.setBrightness(render.brightness);
+      shownBrightness = render.brightness;
+    }
+    
+    // Fade towards the color of each new state (drained even while paused)
+    Event ev;
+    while (pollEvent(EVENT_SUB_LED, ev)) {
+      if (ev.type == EVENT_STATE) setStateColor(ev.b);
+    }
+    
     if (!ledTaskPaused) {
       // Update fade and apply effect
       updateFade();
@@ -95,6 +156,7 @@ inline void ledTask(void* parameter) {
     // Measure frame time
     unsigned long frameUs = micros() - frameStartUs;
     perf.ledFrameTimeUs = frameUs;
+    histObserve(ledFrameHist, frameUs);
     if (frameUs > maxFrameUs) maxFrameUs = frameUs;
     
     frameCount++;
@@ -107,20 +169,28 @@ inline void ledTask(void* parameter) {
       perf.ledActualFPS = fps;
       perf.ledMaxFrameTimeUs = maxFrameUs;
       perf.ledStackHighWater = uxTaskGetStackHighWaterMark(NULL);
+      perf.ledJitterUs = frameCount > 0 ? jitterSumUs / frameCount : 0;
       
-      Serial.printf("[LED] FPS: %.1f | Frame: %lu us (max %lu us) | Stack: %lu bytes free\n", 
-        fps, perf.ledFrameTimeUs, maxFrameUs, perf.ledStackHighWater * 4);
+      Serial.printf("[LED] FPS: %.1f | Frame: %lu us (max %lu us) | Jitter: %lu us | Stack: %lu bytes free\n", 
+        fps, perf.ledFrameTimeUs, maxFrameUs, (unsigned long)perf.ledJitterUs, perf.ledStackHighWater * 4);
       
       frameCount = 0;
       maxFrameUs = 0;
+      jitterSumUs = 0;
       lastFPSReport = now;
     }
     
+    if (ledTaskRelocate) break;  // Frame done, safe to hand over
+    
     // Use vTaskDelayUntil for precise timing
     vTaskDelayUntil(&lastWakeTime, frameDelay);
   }
   
   esp_task_wdt_delete(NULL);
+  if (ledTaskRelocate) {
+    ledTaskRelocate = false;
+    startLEDTask();  // Replacement on the new core
+  }
   vTaskDelete(NULL);
 }
 
@@ -130,14 +200,21 @@ inline void ledTask(void* parameter) {
 
 /**
  * Network monitoring task - runs on Core 1
- * Checks internet connectivity at CHECK_INTERVAL (default 10s).
- * Updates system state based on consecutive failures.
+ * Checks internet connectivity every CHECK_INTERVAL (default 10s), offset
+ * and jittered per device and held back by the probe rate limit
+ * (see probe_schedule.h).
+ * Runs a loss/jitter burst after every cfg.burstEvery passing checks.
+ * Probes the gateway and DNS resolver in parallel with each check.
+ * Updates system state based on consecutive failures, failing segment
+ * and link quality, and publishes each result on the event bus.
+ * Sleeps until the next check is due (at most NET_IDLE_WAKE_MS); WiFi
+ * events wake it early.
  * Reports check statistics every 5 seconds.
  * 
  * @param parameter Unused task parameter
  */
 inline void networkTask(void* parameter) {
-  const TickType_t checkDelay = pdMS_TO_TICKS(100);  // Check every 100ms
+  const TickType_t checkDelay = pdMS_TO_TICKS(100);  // Rate-limit retry
   
   // Performance tracking
   unsigned long lastPerfReport = millis();
@@ -149,7 +226,18 @@ inline void networkTask(void* parameter) {
   // Add this task to watchdog
   esp_task_wdt_add(NULL);
   
+  // Per-device phase, so units booted together don't check in lockstep
+  initProbeSchedule(lastCheck);
+  
   while (true) {
+    // Between checks: safe to hand over to a task on the new core
+    if (netTaskRelocate) {
+      netTaskRelocate = false;
+      esp_task_wdt_delete(NULL);
+      startNetworkTask();
+      vTaskDelete(NULL);
+    }
+    
     esp_task_wdt_reset();
     
     // Update stack high water mark periodically
@@ -158,8 +246,9 @@ inline void networkTask(void* parameter) {
       perf.netStackHighWater = uxTaskGetStackHighWaterMark(NULL);
       
       if (checkCount > 0) {
-        Serial.printf("[Net] Checks: %lu | Avg time: %lu ms | Stack: %lu bytes free\n",
-          checkCount, totalCheckTimeMs / checkCount, perf.netStackHighWater * 4);
+        Serial.printf("[Net] Checks: %lu | Avg time: %lu ms | Stack: %lu bytes free | Reused: %lu/%lu\n",
+          checkCount, totalCheckTimeMs / checkCount, perf.netStackHighWater * 4,
+          poolStats.reused, poolStats.reused + poolStats.opened);
       }
       
       checkCount = 0;
@@ -167,9 +256,19 @@ inline void networkTask(void* parameter) {
       lastPerfReport = now;
     }
     
+    // Write queued outage records (batched to spare the flash)
+    serviceOutageLog();
+    
     // Skip if in config portal mode
     if (configPortalActive) {
-      vTaskDelay(checkDelay);
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(NET_IDLE_WAKE_MS));
+      continue;
+    }
+    
+    // Parked while the layout benchmark runs its own probes
+    netTaskHeld = netTaskHold;
+    if (netTaskHold) {
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(NET_IDLE_WAKE_MS));
       continue;
     }
     
@@ -179,8 +278,10 @@ inline void networkTask(void* parameter) {
           currentState != STATE_CONFIG_PORTAL && currentState != STATE_BOOTING) {
         Serial.println("[Network] WiFi lost!");
         changeState(STATE_WIFI_LOST);
+        segment = SegmentStatus();  // Gateway may differ after reconnect
+        resetConnectionPool();      // Sockets died with the link
       }
-      vTaskDelay(checkDelay);
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(NET_IDLE_WAKE_MS));  // Woken on reconnect
       continue;
     }
     
@@ -192,43 +293,79 @@ inline void networkTask(void* parameter) {
     
     // Internet check (non-blocking timing)
     now = millis();
-    if (now - lastCheck >= CHECK_INTERVAL) {
+    if (now - lastCheck >= probeSchedule.delayMs) {
+      // One config snapshot per check (web API may replace it meanwhile)
+      ProbeConfig cfg;
+      uint32_t revision = probeConfigSnapshot(cfg);
+      
+      // Hold the check until the rate limit allows all its attempts
+      if (!probeTokensReady(cfg.maxAttempts)) {
+        vTaskDelay(checkDelay);
+        continue;
+      }
       lastCheck = now;
+      scheduleNextCheck();
+      syncProbeStatus(revision);
       
       unsigned long checkStart = millis();
       Serial.print("[Network] Checking... ");
-      int successes = checkInternet();
+      startSegmentProbes();             // Gateway/DNS run alongside the WAN checks
+      int successes = checkInternet(cfg);
+      finishSegmentProbes();
       unsigned long checkTime = millis() - checkStart;
       
       checkCount++;
       totalCheckTimeMs += checkTime;
       
-      stats.totalChecks++;
+      recordCheckResult(successes >= cfg.quorum);
+      historyRecord(successes >= cfg.quorum, checkTime);
+      outageLogCheck(successes >= cfg.quorum, checkTime);
+      publishEvent(EVENT_CHECK, successes >= cfg.quorum, 0, checkTime);
       
-      if (successes >= 1) {
+      if (successes >= cfg.quorum) {
         Serial.printf("OK (%lu ms)\n", checkTime);
-        stats.successfulChecks++;
-        stats.consecutiveFailures = 0;
-        stats.consecutiveSuccesses++;
         
-        if (currentState != STATE_INTERNET_OK) {
-          changeState(STATE_INTERNET_OK);
+        // Loss/jitter burst on every Nth passing check (skipped while a
+        // throughput test saturates the link, it would measure itself)
+        if (!cfg.burstEnabled) {
+          quality.degraded = false;
+        } else if (throughputResult.running) {
+          // Keep the previous burst result
+        } else if ((stats.consecutiveSuccesses - 1) % cfg.burstEvery == 0) {
+          if (runProbeBurst(cfg, quality)) {
+            updateQualityState(computeQualityScore(quality.lossPct, quality.rttMs, quality.jitterMs));
+            publishEvent(EVENT_QUALITY, quality.degraded, 0, quality.score);
+            Serial.printf("[Burst] %u/%u replies | loss %.1f%% | rtt %.1f ms | jitter %.1f ms | score %u\n",
+              quality.received, quality.sent, quality.lossPct, quality.rttMs,
+              quality.jitterMs, quality.score);
+          }
         }
+        
+        changeState(connectivityState(true));
       } else {
-        Serial.printf("FAIL (%lu ms)\n", checkTime);
-        stats.failedChecks++;
-        stats.consecutiveFailures++;
-        stats.consecutiveSuccesses = 0;
+        Serial.printf("FAIL (%lu ms) | gateway %s | dns %s | wan ip %s\n", checkTime,
+          segment.gatewayOk ? "ok" : "fail", segment.dnsOk ? "ok" : "fail",
+          segment.wanIpOk ? "ok" : "fail");
         
-        if (stats.consecutiveFailures >= FAILURES_BEFORE_RED) {
-          changeState(STATE_INTERNET_DOWN);
-        } else {
-          changeState(STATE_INTERNET_DEGRADED);
-        }
+        changeState(connectivityState(false));
       }
     }
     
-    vTaskDelay(checkDelay);
+    // Sleep until the next check is due; WiFi events wake us early
+    unsigned long sinceCheck = millis() - lastCheck;
+    unsigned long waitMs = sinceCheck < probeSchedule.delayMs ? probeSchedule.delayMs - sinceCheck : 1;
+    if (waitMs > NET_IDLE_WAKE_MS) waitMs = NET_IDLE_WAKE_MS;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+  }
+}
+
+/**
+ * WiFi event hook: wake the network task on link changes
+ * Without this it would only notice at its next NET_IDLE_WAKE_MS wakeup.
+ */
+inline void onNetworkWiFiEvent(arduino_event_id_t event) {
+  if (networkTaskHandle != NULL) {
+    xTaskNotifyGive(networkTaskHandle);
   }
 }
 
@@ -237,7 +374,7 @@ inline void networkTask(void* parameter) {
 // ===========================================
 
 /**
- * Create and start the LED rendering task on Core 0
+ * Create and start the LED rendering task (Core 0 by default)
  * Must be called during setup after pixels.begin()
  */
 inline void startLEDTask() {
@@ -246,28 +383,35 @@ inline void startLEDTask() {
     "LEDTask",            // Task name
     4096,                 // Stack size (bytes)
     NULL,                 // Task parameters
-    LED_TASK_PRIORITY,    // Priority (higher = more important)
+    activeLayout.ledPriority,  // Priority (higher = more important)
     &ledTaskHandle,       // Task handle
-    LED_CORE              // Core to run on (0)
+    activeLayout.ledCore  // Core to run on
   );
-  Serial.println("LED task created on Core 0");
+  Serial.printf("LED task created on Core %u\n", activeLayout.ledCore);
 }
 
 /**
- * Create and start the network monitoring task on Core 1
+ * Create and start the network monitoring task (Core 1 by default)
  * Must be called after WiFi is connected
  */
 inline void startNetworkTask() {
+  static bool wifiHooked = false;
+  
   xTaskCreatePinnedToCore(
     networkTask,          // Task function
     "NetworkTask",        // Task name
     8192,                 // Stack size (bytes) - larger for HTTP
     NULL,                 // Task parameters
-    NET_TASK_PRIORITY,    // Priority
+    activeLayout.netPriority,  // Priority
     &networkTaskHandle,   // Task handle
-    NETWORK_CORE          // Core to run on (1)
+    activeLayout.netCore  // Core to run on
   );
-  Serial.println("Network task created on Core 1");
+  if (!wifiHooked) {
+    WiFi.onEvent(onNetworkWiFiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    WiFi.onEvent(onNetworkWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    wifiHooked = true;
+  }
+  Serial.printf("Network task created on Core %u\n", activeLayout.netCore);
 }
 
 #endif // SYSTEM_TASKS_H
@@ -7,77 +7,143 @@
  * 
  * Handles login/logout, session tokens, rate limiting, and auth checking.
  * Passwords are verified against SHA-256 hashes stored in NVS.
+ *
+ * Sessions live in a fixed table (auth.sessions, MAX_SESSIONS slots), so
+ * several browsers can stay logged in; a new login takes a free or
+ * expired slot, else the least recently used one. Tokens are checked
+ * against every slot in constant time, straight from the request
+ * headers, without String copies. Only the web task touches the table.
  */
 
 #include <Arduino.h>
-#include <WebServer.h>
 #include <ArduinoJson.h>
 #include "../core/types.h"
 #include "../core/crypto.h"
+#include "../core/clock.h"
+#include "http_server.h"
+#include "json_api.h"
 
 // ===========================================
 // EXTERNAL DECLARATIONS
 // ===========================================
 
-extern WebServer server;
+extern HttpServer server;
 extern AuthState auth;
 extern String storedWebPasswordHash;  // SHA-256 hash of web password
 
 // ===========================================
-// CONSTANTS
+// TOKEN GENERATION
 // ===========================================
 
-#define TOKEN_LENGTH 32
+/**
+ * Generate a cryptographically random session token
+ * Uses ESP32 hardware RNG for better security
+ * @param out TOKEN_LENGTH + 1 bytes; 32 alphanumeric characters + NUL
+ */
+inline void generateToken(char* out) {
+  const char chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+  for (int i = 0; i < TOKEN_LENGTH; i++) {
+    out[i] = chars[esp_random() % 62];
+  }
+  out[TOKEN_LENGTH] = '\0';
+}
 
 // ===========================================
-// RESPONSE HELPERS
+// SESSION TABLE
 // ===========================================
 
+inline bool sessionExpired(const Session& s, uint64_t now) {
+  return now - s.lastSeenMs >= SESSION_IDLE_TIMEOUT || now - s.createdMs >= SESSION_MAX_AGE;
+}
+
 /**
- * Send a JSON error response
- * @param code HTTP status code (e.g., 400, 401, 500)
- * @param message Error message to include in response
+ * Find the live session holding a token
+ * Compares against every slot, whole token each time, so the time taken
+ * doesn't depend on which slot or how many characters match.
+ * @param token Start of the token (not NUL-terminated)
+ * @param len Token length
+ * @return The session, or nullptr
  */
-inline void sendError(int code, const char* message) {
-  JsonDocument doc;
-  doc["success"] = false;
-  doc["error"] = message;
-  String output;
-  serializeJson(doc, output);
-  server.send(code, "application/json", output);
+inline Session* findSession(const char* token, size_t len) {
+  if (len != TOKEN_LENGTH) return nullptr;
+
+  uint64_t now = clockMonoMs();
+  Session* found = nullptr;
+  for (int i = 0; i < MAX_SESSIONS; i++) {
+    Session& s = auth.sessions[i];
+    uint8_t diff = s.token[0] == '\0';
+    for (int j = 0; j < TOKEN_LENGTH; j++) {
+      diff |= s.token[j] ^ token[j];
+    }
+    if (diff == 0 && !sessionExpired(s, now)) found = &s;
+  }
+  return found;
 }
 
 /**
- * Send a JSON success response
- * @param message Optional success message
+ * Start a session in a free or expired slot, else the least recently
+ * used one (that browser has to log in again)
  */
-inline void sendSuccess(const char* message = nullptr) {
-  JsonDocument doc;
-  doc["success"] = true;
-  if (message) {
-    doc["message"] = message;
+inline Session& createSession() {
+  uint64_t now = clockMonoMs();
+  Session* slot = &auth.sessions[0];
+  for (int i = 0; i < MAX_SESSIONS; i++) {
+    Session& s = auth.sessions[i];
+    if (s.token[0] == '\0' || sessionExpired(s, now)) {
+      slot = &s;
+      break;
+    }
+    if (s.lastSeenMs < slot->lastSeenMs) slot = &s;
   }
-  String output;
-  serializeJson(doc, output);
-  server.send(200, "application/json", output);
+
+  generateToken(slot->token);
+  slot->createdMs = now;
+  slot->lastSeenMs = now;
+  return *slot;
 }
 
 // ===========================================
-// TOKEN GENERATION
+// REQUEST TOKEN PARSING
 // ===========================================
 
 /**
- * Generate a cryptographically random session token
- * Uses ESP32 hardware RNG for better security
- * @return 32-character alphanumeric token
+ * Find the "session" cookie in a Cookie header, in place
+ * @param len Set to the value's length
+ * @return Start of the value, or nullptr
  */
-inline String generateToken() {
-  String token = "";
-  const char chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
-  for (int i = 0; i < TOKEN_LENGTH; i++) {
-    token += chars[esp_random() % 62];
+inline const char* findSessionCookie(const char* cookie, size_t& len) {
+  const char* p = cookie;
+  while (*p) {
+    while (*p == ' ') p++;
+    size_t pairLen = strcspn(p, ";");
+    if (pairLen > 8 && strncmp(p, "session=", 8) == 0) {
+      len = pairLen - 8;
+      return p + 8;
+    }
+    p += pairLen;
+    if (*p == ';') p++;
   }
-  return token;
+  return nullptr;
+}
+
+/**
+ * The session this request carries (cookie, then "Authorization: Bearer")
+ * @return The session, or nullptr
+ */
+inline Session* requestSession() {
+  const char* cookie = server.headerValue("Cookie");
+  if (cookie) {
+    size_t len;
+    const char* token = findSessionCookie(cookie, len);
+    Session* s = token ? findSession(token, len) : nullptr;
+    if (s) return s;
+  }
+  // Also check Authorization header for API calls
+  const char* authHeader = server.headerValue("Authorization");
+  if (authHeader && strncasecmp(authHeader, "Bearer ", 7) == 0) {
+    return findSession(authHeader + 7, strlen(authHeader + 7));
+  }
+  return nullptr;
 }
 
 // ===========================================
@@ -86,32 +152,15 @@ inline String generateToken() {
 
 /**
  * Check if current request is authenticated
- * Looks for valid session token in Cookie or Authorization header
+ * Looks for a live session token in Cookie or Authorization header
+ * and marks that session as used
  * @return true if authenticated, false otherwise
  */
 inline bool checkAuth() {
-  // Check session token in cookie or header
-  if (server.hasHeader("Cookie")) {
-    String cookie = server.header("Cookie");
-    int idx = cookie.indexOf("session=");
-    if (idx >= 0) {
-      String token = cookie.substring(idx + 8);
-      int end = token.indexOf(';');
-      if (end > 0) token = token.substring(0, end);
-      if (token.length() > 0 && token == auth.sessionToken) {
-        return true;
-      }
-    }
-  }
-  // Also check Authorization header for API calls
-  if (server.hasHeader("Authorization")) {
-    String authHeader = server.header("Authorization");
-    String token = authHeader.substring(7);
-    if (token.length() > 0 && token == auth.sessionToken) {
-      return true;
-    }
-  }
-  return false;
+  Session* s = requestSession();
+  if (!s) return false;
+  s->lastSeenMs = clockMonoMs();
+  return true;
 }
 
 /**
@@ -168,14 +217,17 @@ inline void handleLogin() {
   // Compare hash of entered password with stored hash
   if (verifyPassword(password, storedWebPasswordHash)) {
     auth.loginAttempts = 0;
-    auth.sessionToken = generateToken();
+    Session& session = createSession();
 
-    // Max-Age=31536000 = 1 year (browser will remember)
-    server.sendHeader("Set-Cookie", "session=" + auth.sessionToken + "; Path=/; HttpOnly; SameSite=Strict; Max-Age=31536000");
+    // Cookie lasts as long as the session can
+    char cookie[96];
+    snprintf(cookie, sizeof(cookie), "session=%s; Path=/; HttpOnly; SameSite=Strict; Max-Age=%lu",
+             session.token, (unsigned long)(SESSION_MAX_AGE / 1000));
+    server.sendHeader("Set-Cookie", cookie);
     
     JsonDocument doc;
     doc["success"] = true;
-    doc["token"] = auth.sessionToken;
+    doc["token"] = session.token;
     String output;
     serializeJson(doc, output);
     server.send(200, "application/json", output);
@@ -196,10 +248,11 @@ inline void handleLogin() {
 
 /**
  * Handle GET/POST /logout
- * Clears session token and cookie
+ * Ends this request's session (others stay logged in) and clears the cookie
  */
 inline void handleLogout() {
-  auth.sessionToken = "";
+  Session* s = requestSession();
+  if (s) *s = Session();
   server.sendHeader("Set-Cookie", "session=; Path=/; HttpOnly; Max-Age=0");
   sendSuccess("logged out");
 }
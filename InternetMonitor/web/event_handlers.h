@@ -0,0 +1,110 @@
+#ifndef WEB_EVENT_HANDLERS_H
+#define WEB_EVENT_HANDLERS_H
+
+/**
+ * @file event_handlers.h
+ * @brief Web consumer of the event bus and the /events endpoint
+ *
+ * The web task drains EVENT_SUB_WEB into a small numbered log, so clients can
+ * ask for "everything since seq N" instead of diffing /stats snapshots.
+ */
+
+#include <Arduino.h>
+#include "../core/events.h"
+#include "http_server.h"
+#include "auth.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+
+// ===========================================
+// EVENT LOG (web task only)
+// ===========================================
+
+struct WebEventEntry {
+  uint32_t seq;
+  Event ev;
+};
+
+static WebEventEntry webEventLog[EVENT_LOG_SIZE];
+static uint32_t webEventSeq = 0;   // Seq of the newest entry (0 = none yet)
+
+/**
+ * Move queued bus events into the log (call from the web task)
+ */
+inline void serviceWebEvents() {
+  Event ev;
+  while (pollEvent(EVENT_SUB_WEB, ev)) {
+    webEventSeq++;
+    WebEventEntry& e = webEventLog[webEventSeq % EVENT_LOG_SIZE];
+    e.seq = webEventSeq;
+    e.ev = ev;
+  }
+}
+
+/**
+ * Format the type-specific fields of an event
+ * @return Characters written
+ */
+inline int formatEventFields(const Event& ev, char* buf, size_t len) {
+  switch (ev.type) {
+    case EVENT_STATE:
+      return snprintf(buf, len, "\"from\":%u,\"to\":%u", ev.a, ev.b);
+    case EVENT_CHECK:
+      return snprintf(buf, len, "\"ok\":%s,\"ms\":%lu", ev.a ? "true" : "false", (unsigned long)ev.value);
+    case EVENT_QUALITY:
+      return snprintf(buf, len, "\"score\":%lu,\"degraded\":%s", (unsigned long)ev.value, ev.a ? "true" : "false");
+    case EVENT_THROUGHPUT:
+      return snprintf(buf, len, "\"ok\":%s,\"downKbps\":%lu", ev.a ? "true" : "false", (unsigned long)ev.value);
+    default:
+      return snprintf(buf, len, "\"value\":%lu", (unsigned long)ev.value);
+  }
+}
+
+// ===========================================
+// EVENTS HANDLER
+// ===========================================
+
+/**
+ * Handle GET /events[?since=<seq>]
+ * Events newer than `since`, oldest first (at most EVENT_LOG_SIZE).
+ * Poll again with the returned "seq". "ago" is ms before this response.
+ *
+ * {"seq":57,"dropped":0,"events":[{"seq":56,"type":"check","ago":9980,"ok":true,"ms":212},
+ *  {"seq":57,"type":"state","ago":20,"from":4,"to":6}]}
+ */
+inline void handleEvents() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  serviceWebEvents();  // Include anything queued since the last web task cycle
+
+  uint32_t since = server.hasArg("since") ? strtoul(server.arg("since").c_str(), NULL, 10) : 0;
+  uint32_t oldest = webEventSeq >= EVENT_LOG_SIZE ? webEventSeq - EVENT_LOG_SIZE + 1 : 1;
+  if (since + 1 > oldest) oldest = since + 1;
+
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+
+  char chunk[160];
+  int len = snprintf(chunk, sizeof(chunk), "{\"seq\":%lu,\"dropped\":%lu,\"events\":[",
+    (unsigned long)webEventSeq, (unsigned long)eventRings[EVENT_SUB_WEB].dropped);
+  server.sendContent(chunk, len);
+
+  uint32_t now = millis();
+  for (uint32_t seq = oldest; seq <= webEventSeq; seq++) {
+    const WebEventEntry& e = webEventLog[seq % EVENT_LOG_SIZE];
+    len = snprintf(chunk, sizeof(chunk), "%s{\"seq\":%lu,\"type\":\"%s\",\"ago\":%lu,",
+      seq > oldest ? "," : "", (unsigned long)e.seq, eventTypeName(e.ev.type),
+      (unsigned long)(now - e.ev.ms));
+    len += formatEventFields(e.ev, chunk + len, sizeof(chunk) - len - 1);
+    chunk[len++] = '}';
+    server.sendContent(chunk, len);
+  }
+
+  server.sendContent("]}");
+}
+
+#endif // WEB_EVENT_HANDLERS_H
@@ -11,7 +11,7 @@
  */
 
 #include <Arduino.h>
-#include <WebServer.h>
+#include <limits.h>
 #include <WiFi.h>
 #include <Adafruit_NeoPixel.h>
 #include <ArduinoJson.h>
@@ -19,21 +19,31 @@
 #include "../core/types.h"
 #include "../core/state.h"
 #include "../storage/nvs_manager.h"
+#include "../storage/outage_log.h"
+#include "../system/cpu_stats.h"
+#include "../system/metrics.h"
+#include "../core/json_writer.h"
 #include "../mqtt/mqtt_config.h"
+#include "http_server.h"
 #include "auth.h"
+#include "json_api.h"
 #include "ui_login.h"
 #include "ui_styles.h"
 #include "ui_modal.h"
 #include "ui_dashboard.h"
+#include "ui_assets.h"
 
 // ===========================================
 // EXTERNAL DECLARATIONS
 // ===========================================
 
-extern WebServer server;
+extern HttpServer server;
 extern Adafruit_NeoPixel pixels;
 extern SystemStats stats;
 extern PerformanceMetrics perf;
+extern QualityMetrics quality;
+extern SegmentStatus segment;
+extern ThroughputResult throughputResult;
 
 extern volatile int currentState;
 extern volatile int currentEffect;
@@ -50,305 +60,200 @@ extern String storedSSID;
 extern MQTTConfig mqttConfig;
 
 // From effects.h
-extern void resetAllEffectState();
+
+// ===========================================
+// STATIC ASSETS
+// ===========================================
+
+/**
+ * Send a gzipped bundle or page from ui_assets.h
+ * Hashed URLs may be cached for good; pages are revalidated on every
+ * view. A request with a matching ETag gets 304.
+ */
+inline void sendAsset(const UiAsset& asset) {
+  server.sendHeader("ETag", asset.etag);
+  server.sendHeader("Cache-Control", asset.cacheControl);
+
+  const char* match = server.headerValue("If-None-Match");
+  if (match && (strcmp(match, "*") == 0 || strstr(match, asset.etag))) {
+    server.send(304);
+    return;
+  }
+
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset.type, (PGM_P)asset.data, asset.length);
+}
+
+/**
+ * Register a route per hashed bundle (dashboard and portal servers;
+ * no auth: CSS/JS only). Pages are served by their own handler.
+ */
+inline void registerAssetRoutes() {
+  for (size_t i = 0; i < UI_ASSET_COUNT; i++) {
+    const UiAsset* asset = &uiAssets[i];
+    if (strncmp(asset->path, "/assets/", 8) != 0) continue;
+    server.on(asset->path, HTTP_GET, [asset]() { sendAsset(*asset); });
+  }
+}
 
 // ===========================================
 // DASHBOARD HANDLER
 // ===========================================
 
+/**
+ * Handle GET /
+ * Login page until authenticated (never cached, same URL), then the
+ * dashboard page.
+ */
 inline void handleRoot() {
   if (!checkAuth()) {
+    server.sendHeader("Cache-Control", "no-store");
     server.send(200, "text/html", LOGIN_HTML);
     return;
   }
 
-  // Build dashboard using chunked response to reduce memory fragmentation
-  unsigned long uptime = millis() - stats.bootTime;
-  float successRate = stats.totalChecks > 0 ? (100.0 * stats.successfulChecks / stats.totalChecks) : 100;
-
-  String stateStr, stateColor;
-  switch (currentState) {
-    case STATE_INTERNET_OK: stateStr = "ONLINE"; stateColor = "#22c55e"; break;
-    case STATE_INTERNET_DEGRADED: stateStr = "DEGRADED"; stateColor = "#f59e0b"; break;
-    case STATE_INTERNET_DOWN: stateStr = "OFFLINE"; stateColor = "#ef4444"; break;
-    case STATE_WIFI_LOST: stateStr = "NO WIFI"; stateColor = "#ef4444"; break;
-    case STATE_CONFIG_PORTAL: stateStr = "SETUP"; stateColor = "#c026d3"; break;
-    default: stateStr = "STARTING"; stateColor = "#3b82f6"; break;
-  }
-
-  // Use chunked transfer to reduce memory fragmentation
-  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-  server.send(200, "text/html", "");
-
-  // Head
-  server.sendContent("<!DOCTYPE html><html><head>");
-  server.sendContent("<meta charset=\"UTF-8\">");
-  server.sendContent("<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">");
-  server.sendContent("<title>Internet Monitor</title><style>");
-  server.sendContent(FPSTR(DASHBOARD_CSS));
-  server.sendContent(FPSTR(CSS_MODAL));
-  server.sendContent("</style></head><body><div class=\"wrap\">");
-
-  // Header
-  server.sendContent("<div class=\"hdr\"><div class=\"hdr-left\">");
-  server.sendContent("<h1>Internet Monitor</h1>");
-  server.sendContent("<p class=\"sub\">ESP32-S3 MATRIX • DUAL CORE</p>");
-  server.sendContent("</div><button class=\"logout\" onclick=\"logout()\">Logout</button></div>");
-
-  // Status
-  server.sendContent("<div class=\"status\">");
-  server.sendContent("<span class=\"status-dot\" id=\"dot\" style=\"background:" + stateColor + ";box-shadow:0 0 8px " + stateColor + "\"></span>");
-  server.sendContent("<span class=\"status-text\" id=\"stxt\" style=\"color:" + stateColor + "\">" + stateStr + "</span>");
-  server.sendContent("</div>");
-
-  // Effects card - collapsible, all effects in one grid
-  server.sendContent("<div class=\"card\"><div class=\"card-title collapsible\" id=\"effectsT\" onclick=\"T('effects')\"><span>Effects</span><span class=\"toggle\">▼</span></div>");
-  server.sendContent("<div class=\"card-body\" id=\"effectsB\"><div class=\"grid\">");
-  server.sendContent("<button class=\"btn off" + String(currentEffect == 0 ? " active" : "") + "\" onclick=\"E(0)\">Off</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 1 ? " active" : "") + "\" onclick=\"E(1)\">Solid</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 2 ? " active" : "") + "\" onclick=\"E(2)\">Ripple</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 3 ? " active" : "") + "\" onclick=\"E(3)\">Rainbow</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 4 ? " active" : "") + "\" onclick=\"E(4)\">Rain</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 5 ? " active" : "") + "\" onclick=\"E(5)\">Matrix</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 6 ? " active" : "") + "\" onclick=\"E(6)\">Fire</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 7 ? " active" : "") + "\" onclick=\"E(7)\">Plasma</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 8 ? " active" : "") + "\" onclick=\"E(8)\">Ocean</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 9 ? " active" : "") + "\" onclick=\"E(9)\">Nebula</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 10 ? " active" : "") + "\" onclick=\"E(10)\">Life</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 11 ? " active" : "") + "\" onclick=\"E(11)\">Pong</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 12 ? " active" : "") + "\" onclick=\"E(12)\">Metaballs</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 13 ? " active" : "") + "\" onclick=\"E(13)\">Interference</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 14 ? " active" : "") + "\" onclick=\"E(14)\">Noise</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 15 ? " active" : "") + "\" onclick=\"E(15)\">Pool</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 16 ? " active" : "") + "\" onclick=\"E(16)\">Rings</button>");
-  server.sendContent("<button class=\"btn" + String(currentEffect == 17 ? " active" : "") + "\" onclick=\"E(17)\">Ball</button>");
-  server.sendContent("</div>");
-
-  // Settings sliders within effects card
-  server.sendContent("<div class=\"slider-row\"><div class=\"slider-label\"><span>Brightness</span>");
-  server.sendContent("<span class=\"slider-val\" id=\"bv\">" + String(currentBrightness) + "/50</span></div>");
-  server.sendContent("<input type=\"range\" min=\"5\" max=\"50\" value=\"" + String(currentBrightness) + "\" oninput=\"B(this.value)\"></div>");
-
-  server.sendContent("<div class=\"slider-row\"><div class=\"slider-label\"><span>Speed</span>");
-  server.sendContent("<span class=\"slider-val\" id=\"sv\">" + String(effectSpeed) + "%</span></div>");
-  server.sendContent("<input type=\"range\" min=\"10\" max=\"100\" value=\"" + String(effectSpeed) + "\" oninput=\"S(this.value)\"></div>");
-
-  server.sendContent("<div class=\"rot-row\"><span>Rotation</span>");
-  server.sendContent("<button class=\"rot-btn" + String(currentRotation == 0 ? " active" : "") + "\" onclick=\"R(0)\">0°</button>");
-  server.sendContent("<button class=\"rot-btn" + String(currentRotation == 1 ? " active" : "") + "\" onclick=\"R(1)\">90°</button>");
-  server.sendContent("<button class=\"rot-btn" + String(currentRotation == 2 ? " active" : "") + "\" onclick=\"R(2)\">180°</button>");
-  server.sendContent("<button class=\"rot-btn" + String(currentRotation == 3 ? " active" : "") + "\" onclick=\"R(3)\">270°</button>");
-  server.sendContent("</div></div></div>");
-
-  // Statistics
-  server.sendContent("<div class=\"card\"><div class=\"card-title\">Statistics</div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Uptime</span><span class=\"stat-val\" id=\"up\">" + formatUptime(uptime) + "</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Checks</span><span class=\"stat-val\" id=\"chk\">" + String(stats.totalChecks) + "</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Success Rate</span><span class=\"stat-val\" id=\"rate\">" + String(successRate, 1) + "%</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Failed</span><span class=\"stat-val\" id=\"fail\">" + String(stats.failedChecks) + "</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Last Outage</span><span class=\"stat-val\" id=\"last\">" + (stats.lastDowntime > 0 ? formatUptime(stats.lastDowntime) : "None") + "</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Total Downtime</span><span class=\"stat-val\" id=\"down\">" + formatUptime(stats.totalDowntimeMs) + "</span></div>");
-  server.sendContent("</div>");
-
-  // Network
-  server.sendContent("<div class=\"card\"><div class=\"card-title\">Network</div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">SSID</span><span class=\"stat-val\">" + storedSSID + "</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">IP</span><span class=\"stat-val\">" + WiFi.localIP().toString() + "</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Signal</span><span class=\"stat-val\" id=\"rssi\">" + String(WiFi.RSSI()) + " dBm</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">MAC</span><span class=\"stat-val\">" + WiFi.macAddress() + "</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Channel</span><span class=\"stat-val\">" + String(WiFi.channel()) + "</span></div>");
-  server.sendContent("</div>");
-
-  // MQTT - collapsible, default collapsed
-  bool hasBroker = strlen(mqttConfig.broker) > 0;
-  String mqttStatusColor = mqttConfig.connected ? "#22c55e" : (mqttConfig.enabled ? "#f59e0b" : "#707088");
-  server.sendContent("<div class=\"card\"><div class=\"card-title collapsible collapsed\" id=\"mqttT\" onclick=\"T('mqtt')\"><span>MQTT</span><span class=\"toggle\">▼</span></div>");
-  server.sendContent("<div class=\"card-body collapsed\" id=\"mqttB\">");
-  
-  // Status row
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Status</span><span class=\"stat-val\" id=\"mqttStatus\" style=\"color:" + mqttStatusColor + "\">" + getMQTTStatusText() + "</span></div>");
-  
-  // Enable toggle - disabled unless config is valid/tested, OR currently enabled (so can be turned off)
-  bool toggleEnabled = mqttConfig.enabled || (hasBroker && mqttConfig.connected);
-  String toggleOpacity = toggleEnabled ? "" : "opacity:0.5;pointer-events:none;";
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Enabled</span>");
-  server.sendContent("<label class=\"tog\" id=\"mqttEnToggle\" onclick=\"mqttToggle()\" style=\"" + toggleOpacity + "\">");
-  server.sendContent("<span class=\"tog-bg\" id=\"mqttEnBg\" style=\"background:" + String(mqttConfig.enabled ? "#4338ca" : "#303048") + "\"></span>");
-  server.sendContent("<span class=\"tog-knob\" id=\"mqttEnKnob\" style=\"left:" + String(mqttConfig.enabled ? "22px" : "2px") + "\"></span>");
-  server.sendContent("<input type=\"hidden\" id=\"mqttEn\" value=\"" + String(mqttConfig.enabled ? "1" : "0") + "\">");
-  server.sendContent("</label></div>");
-  
-  // Broker
-  server.sendContent("<div class=\"stat\" style=\"flex-wrap:wrap\"><span class=\"stat-label\">Broker</span>");
-  server.sendContent("<input type=\"text\" id=\"mqttBroker\" value=\"" + String(mqttConfig.broker) + "\" placeholder=\"mqtt.example.com\" style=\"flex:1;min-width:120px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem\"></div>");
-  
-  // Port
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Port</span>");
-  server.sendContent("<input type=\"number\" id=\"mqttPort\" value=\"" + String(mqttConfig.port) + "\" style=\"width:70px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem\"></div>");
-  
-  // Username
-  server.sendContent("<div class=\"stat\" style=\"flex-wrap:wrap\"><span class=\"stat-label\">Username</span>");
-  server.sendContent("<input type=\"text\" id=\"mqttUser\" value=\"" + String(mqttConfig.username) + "\" placeholder=\"(optional)\" style=\"flex:1;min-width:100px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem\"></div>");
-  
-  // Password
-  server.sendContent("<div class=\"stat\" style=\"flex-wrap:wrap\"><span class=\"stat-label\">Password</span>");
-  server.sendContent("<input type=\"password\" id=\"mqttPass\" placeholder=\"" + String(strlen(mqttConfig.password) > 0 ? "••••••••" : "(optional)") + "\" style=\"flex:1;min-width:100px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem\"></div>");
-  
-  // Topic
-  server.sendContent("<div class=\"stat\" style=\"flex-wrap:wrap\"><span class=\"stat-label\">Base Topic</span>");
-  server.sendContent("<input type=\"text\" id=\"mqttTopic\" value=\"" + String(mqttConfig.baseTopic) + "\" style=\"flex:1;min-width:120px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem\"></div>");
-  
-  // Interval
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Interval (sec)</span>");
-  server.sendContent("<input type=\"number\" id=\"mqttInt\" value=\"" + String(mqttConfig.publishIntervalMs / 1000) + "\" min=\"5\" max=\"3600\" style=\"width:70px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem\"></div>");
-  
-  // HA Discovery toggle
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">HA Discovery</span>");
-  server.sendContent("<label class=\"tog\" onclick=\"togHA()\">");
-  server.sendContent("<span class=\"tog-bg\" id=\"mqttHABg\" style=\"background:" + String(mqttConfig.homeAssistantDiscovery ? "#4338ca" : "#303048") + "\"></span>");
-  server.sendContent("<span class=\"tog-knob\" id=\"mqttHAKnob\" style=\"left:" + String(mqttConfig.homeAssistantDiscovery ? "22px" : "2px") + "\"></span>");
-  server.sendContent("<input type=\"hidden\" id=\"mqttHA\" value=\"" + String(mqttConfig.homeAssistantDiscovery ? "1" : "0") + "\">");
-  server.sendContent("</label></div>");
-  
-  // Buttons
-  server.sendContent("<div style=\"display:flex;gap:8px;margin-top:12px\">");
-  server.sendContent("<button class=\"btn\" style=\"flex:1\" id=\"mqttTestBtn\" onclick=\"mqttTest()\"" + String(hasBroker ? "" : " disabled") + ">Test</button>");
-  server.sendContent("<button class=\"btn\" style=\"flex:1\" id=\"mqttSaveBtn\" onclick=\"mqttSave()\" disabled>Save</button>");
-  server.sendContent("<button class=\"btn\" style=\"flex:1;background:#7f1d1d;color:#fca5a5\" id=\"mqttResetBtn\" onclick=\"mqttReset()\"" + String(hasBroker ? "" : " disabled") + ">Reset</button>");
-  server.sendContent("</div>");
-  
-  server.sendContent("<p style=\"font-size:.6rem;color:#505068;margin-top:8px\">Publishes to: <span id=\"mqttPubTopic\">" + String(mqttConfig.baseTopic) + "/state</span></p>");
-  server.sendContent("</div></div>");
-
-  // System - collapsible, default collapsed
-  server.sendContent("<div class=\"card\"><div class=\"card-title collapsible collapsed\" id=\"sysT\" onclick=\"T('sys')\"><span>System</span><span class=\"toggle\">▼</span></div>");
-  server.sendContent("<div class=\"card-body collapsed\" id=\"sysB\">");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Architecture</span><span class=\"stat-val\">Dual Core ESP32-S3</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">CPU Freq</span><span class=\"stat-val\">" + String(ESP.getCpuFreqMHz()) + " MHz</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Free Heap</span><span class=\"stat-val\" id=\"heap\">" + String(ESP.getFreeHeap() / 1024) + " KB</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Min Free Heap</span><span class=\"stat-val\" id=\"minheap\">" + String(ESP.getMinFreeHeap() / 1024) + " KB</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Flash Size</span><span class=\"stat-val\">" + String(ESP.getFlashChipSize() / 1024 / 1024) + " MB</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Sketch Size</span><span class=\"stat-val\">" + String(ESP.getSketchSize() / 1024) + " KB</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Chip Temp</span><span class=\"stat-val\" id=\"temp\">" + String(getChipTemp(), 1) + "°C</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">OTA Updates</span><span class=\"stat-val good\">Enabled</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Firmware</span><span class=\"stat-val\">v" + String(FW_VERSION) + "</span></div>");
-  server.sendContent("</div></div>");
-
-  // Diagnostics - collapsible, default collapsed
-  server.sendContent("<div class=\"card\"><div class=\"card-title collapsible collapsed\" id=\"diagT\" onclick=\"T('diag')\"><span>Diagnostics</span><span class=\"toggle\">▼</span></div>");
-  server.sendContent("<div class=\"card-body collapsed\" id=\"diagB\">");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">LED FPS</span><span class=\"stat-val\" id=\"fps\">" + String(perf.ledActualFPS, 1) + "</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Frame Time</span><span class=\"stat-val\" id=\"frameus\">" + String(perf.ledFrameTimeUs) + " µs</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Max Frame Time</span><span class=\"stat-val\" id=\"maxframeus\">" + String(perf.ledMaxFrameTimeUs) + " µs</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">LED Stack Free</span><span class=\"stat-val\" id=\"ledstack\">" + String(perf.ledStackHighWater * 4) + " bytes</span></div>");
-  server.sendContent("<div class=\"stat\"><span class=\"stat-label\">Net Stack Free</span><span class=\"stat-val\" id=\"netstack\">" + String(perf.netStackHighWater * 4) + " bytes</span></div>");
-  server.sendContent("</div></div>");
-
-  // Factory Reset - at bottom
-  server.sendContent("<div class=\"card\"><div class=\"card-title\">Danger Zone</div>");
-  server.sendContent("<button class=\"btn btn-danger\" style=\"width:100%\" onclick=\"factoryReset()\">Factory Reset</button>");
-  server.sendContent("<p style=\"font-size:.65rem;color:#707088;margin-top:8px;text-align:center\">Clears WiFi, password, and all settings</p>");
-  server.sendContent("</div></div>");
-
-  // Modal overlay (for styled popups)
-  server.sendContent(FPSTR(MODAL_HTML));
-
-  // JavaScript
-  server.sendContent("<script>");
-  server.sendContent(FPSTR(MODAL_JS));
-  server.sendContent(FPSTR(DASHBOARD_JS));
-  server.sendContent("</script></body></html>");
+  // Static page, filled in from /api/dashboard; usually a 304
+  sendAsset(uiAssets[ASSET_DASHBOARD_HTML_INDEX]);
 }
 
 // ===========================================
-// API HANDLERS
+// SETTINGS
 // ===========================================
 
+// One batch of LED settings; -1 leaves a field unchanged
+struct SettingsChange {
+  int effect = -1;
+  int brightness = -1;
+  int speed = -1;
+  int rotation = -1;
+};
+
+/**
+ * Validate and apply a batch of settings as one change
+ * Nothing is applied unless every field is valid. A new effect brings its
+ * default brightness and speed unless the batch sets them too. The LED
+ * task sees the whole batch in one publish.
+ * @return nullptr, or what was wrong (nothing changed)
+ */
+inline const char* applySettings(const SettingsChange& c) {
+  if (c.effect != -1 && (c.effect < 0 || c.effect >= NUM_EFFECTS)) return "effect out of range";
+  if (c.brightness != -1 && (c.brightness < 5 || c.brightness > 50)) return "brightness out of range";
+  if (c.speed != -1 && (c.speed < 10 || c.speed > 100)) return "speed out of range";
+  if (c.rotation != -1 && (c.rotation < ROTATION_0 || c.rotation > ROTATION_270)) return "rotation out of range";
+
+  if (c.effect >= 0) {
+    currentEffect = c.effect;
+    currentBrightness = effectDefaults[c.effect][0];
+    effectSpeed = effectDefaults[c.effect][1];
+  }
+  if (c.brightness >= 0) currentBrightness = c.brightness;
+  if (c.speed >= 0) effectSpeed = c.speed;
+  if (c.rotation >= 0) currentRotation = c.rotation;
+
+  publishRenderParams();  // LED task resets effect state on a switch
+  markSettingsChanged();
+  Serial.printf("Settings: %s, brightness=%u, speed=%u, rotation=%u\n",
+    effectNames[currentEffect], currentBrightness, effectSpeed, currentRotation * 90);
+  return nullptr;
+}
+
+inline void sendSettings() {
+  JsonDocument doc;
+  doc["effect"] = currentEffect;
+  doc["brightness"] = currentBrightness;
+  doc["speed"] = effectSpeed;
+  doc["rotation"] = currentRotation;
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+/**
+ * Handle POST /api/settings
+ * JSON body with any of the fields, applied together or not at all:
+ * {"brightness":30} or {"effect":5,"rotation":1}
+ * Returns the resulting settings:
+ * {"effect":5,"brightness":25,"speed":60,"rotation":1}
+ */
+inline void handleSettingsSave() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  JsonDocument body;
+  if (deserializeJson(body, server.arg("plain"))) {
+    sendError(400, "invalid json");
+    return;
+  }
+
+  // A field of the wrong type fails the batch (it must not read as unchanged);
+  // applySettings() checks the ranges
+  SettingsChange c;
+  if (!readIntField(body["effect"], 0, INT_MAX, c.effect) ||
+      !readIntField(body["brightness"], 0, INT_MAX, c.brightness) ||
+      !readIntField(body["speed"], 0, INT_MAX, c.speed) ||
+      !readIntField(body["rotation"], 0, INT_MAX, c.rotation)) {
+    sendError(400, "settings must be non-negative integers");
+    return;
+  }
+
+  const char* err = applySettings(c);
+  if (err) {
+    sendError(400, err);
+    return;
+  }
+  sendSettings();
+}
+
+// Single-setting GET endpoints, kept for scripts and bookmarks
+// (invalid values are ignored, as before)
+
 inline void handleEffect() {
   if (!checkAuth()) { sendUnauthorized(); return; }
-  if (server.hasArg("e")) {
-    int effect = server.arg("e").toInt();
-    if (effect >= 0 && effect < NUM_EFFECTS) {
-      currentEffect = effect;
-      resetAllEffectState();  // Reset all effect state for clean start
-      
-      // Apply per-effect default brightness and speed
-      currentBrightness = effectDefaults[effect][0];
-      effectSpeed = effectDefaults[effect][1];
-      pixels.setBrightness(currentBrightness);
-      
-      markSettingsChanged();
-      Serial.print("Effect: ");
-      Serial.print(effectNames[currentEffect]);
-      Serial.print(" (brightness=");
-      Serial.print(currentBrightness);
-      Serial.print(", speed=");
-      Serial.print(effectSpeed);
-      Serial.println(")");
-      
-      // Return new values so UI can update
-      JsonDocument doc;
-      doc["brightness"] = currentBrightness;
-      doc["speed"] = effectSpeed;
-      String output;
-      serializeJson(doc, output);
-      server.send(200, "application/json", output);
-      return;
-    }
+  SettingsChange c;
+  if (server.hasArg("e")) c.effect = server.arg("e").toInt();
+  if (c.effect >= 0 && !applySettings(c)) {
+    // Return new values so UI can update
+    sendSettings();
+    return;
   }
   sendSuccess("effect set");
 }
 
 inline void handleBrightness() {
   if (!checkAuth()) { sendUnauthorized(); return; }
-  if (server.hasArg("b")) {
-    int brightness = server.arg("b").toInt();
-    if (brightness >= 5 && brightness <= 50) {
-      currentBrightness = brightness;
-      pixels.setBrightness(currentBrightness);
-      markSettingsChanged();
-      Serial.print("Brightness: ");
-      Serial.println(currentBrightness);
-    }
-  }
+  SettingsChange c;
+  if (server.hasArg("b")) c.brightness = server.arg("b").toInt();
+  if (c.brightness >= 0) applySettings(c);
   sendSuccess("brightness set");
 }
 
 inline void handleRotation() {
   if (!checkAuth()) { sendUnauthorized(); return; }
-  if (server.hasArg("r")) {
-    int rotation = server.arg("r").toInt();
-    if (rotation >= ROTATION_0 && rotation <= ROTATION_270) {
-      currentRotation = rotation;
-      markSettingsChanged();
-      Serial.print("Rotation: ");
-      Serial.println(rotation * 90);
-    }
-  }
+  SettingsChange c;
+  if (server.hasArg("r")) c.rotation = server.arg("r").toInt();
+  if (c.rotation >= 0) applySettings(c);
   sendSuccess("rotation set");
 }
 
 inline void handleSpeed() {
   if (!checkAuth()) { sendUnauthorized(); return; }
-  if (server.hasArg("s")) {
-    int speed = server.arg("s").toInt();
-    if (speed >= 10 && speed <= 100) {
-      effectSpeed = speed;
-      markSettingsChanged();
-      Serial.print("Speed: ");
-      Serial.println(effectSpeed);
-    }
-  }
+  SettingsChange c;
+  if (server.hasArg("s")) c.speed = server.arg("s").toInt();
+  if (c.speed >= 0) applySettings(c);
   sendSuccess("speed set");
 }
 
+// ===========================================
+// API HANDLERS
+// ===========================================
+
 inline void handleFactoryReset() {
   if (!checkAuth()) { sendUnauthorized(); return; }
 
   Serial.println("FACTORY RESET requested via web UI");
 
-  // Clear ALL NVS data
+  // Clear ALL NVS data and the outage journal
   clearAllNVS();
+  clearOutageLog();
 
   JsonDocument doc;
   doc["success"] = true;
@@ -374,64 +279,251 @@ inline void handleFactoryReset() {
   ESP.restart();
 }
 
+// ===========================================
+// JSON RESPONSES
+// ===========================================
+
+static char jsonChunk[JSON_CHUNK];  // Web task only: handlers run one at a time
+
+inline void jsonToClient(const char* data, size_t length) {
+  server.sendContent(data, length);
+}
+
+/**
+ * Start a 200 JSON response whose body is streamed by a JsonWriter over
+ * jsonChunk (JsonWriter out(jsonChunk, JSON_CHUNK, jsonToClient))
+ */
+inline void beginJsonResponse() {
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+}
+
+// ===========================================
+// STATS FIELDS
+// ===========================================
+
+/**
+ * Write the /stats "cpu" object (web task only: reads the sampler's table)
+ * Percentages are of one core; busy/avg are the latest interval and the
+ * rolling window. "overflow": more tasks than CPU_MAX_TASKS, figures stale.
+ */
+inline void writeCpuStats(JsonWriter& out) {
+  out.beginObject("cpu");
+  out.field("available", (bool)CPU_STATS_AVAILABLE);
+  out.field("overflow", cpuOverflow);
+  out.field("intervalMs", cpuLastIntervalMs);
+  out.field("windowS", (CPU_SAMPLE_MS / 1000) * cpuFilled);
+  if (cpuFilled > 0) {
+    out.beginArray("cores");
+    for (int c = 0; c < 2; c++) {
+      out.beginObject();
+      out.field("busy", cpuCoreBusy[c][cpuLatestSlot()] / 10.0f, 1);
+      out.field("avg", cpuWindowAvg(cpuCoreBusy[c]) / 10.0f, 1);
+      out.field("idleMs", cpuWindowIdleMs(c));
+      out.endObject();
+    }
+    out.endArray();
+
+    out.beginArray("tasks");
+    for (int i = 0; i < CPU_MAX_TASKS; i++) {
+      const CpuTaskStat& t = cpuTasks[i];
+      if (!t.handle) continue;
+      out.beginObject();
+      out.field("name", t.name);
+      out.field("core", t.core);
+      out.field("prio", t.priority);
+      out.field("pct", t.pct[cpuLatestSlot()] / 10.0f, 1);
+      out.field("avg", cpuWindowAvg(t.pct) / 10.0f, 1);
+      out.endObject();
+    }
+    out.endArray();
+  }
+  out.endObject();
+}
+
+/**
+ * Write the /stats "http" object (web task only: reads the server's counters)
+ * Latency is accept to last byte sent, over the last HTTP_LATENCY_SAMPLES
+ * requests; handler time excludes waiting on the client. "outAllocs"
+ * counts output blocks that missed the pool.
+ */
+inline void writeHttpStats(JsonWriter& out) {
+  const HttpMetrics& m = server.metrics();
+  out.beginObject("http");
+  out.field("requests", m.requests);
+  out.field("active", m.active);
+  out.field("peak", m.peakActive);
+  out.field("dropped", m.dropped);
+  out.field("rejected", m.rejected);
+  out.field("p50Ms", httpLatencyPercentile(m, 50));
+  out.field("p95Ms", httpLatencyPercentile(m, 95));
+  out.field("maxMs", httpLatencyPercentile(m, 100));
+  out.field("handlerUs", m.requests > 0 ? m.handlerUsTotal / m.requests : 0);
+  out.field("handlerMaxUs", m.handlerUsMax);
+  out.field("outAllocs", m.outAllocs);
+  out.endObject();
+}
+
+// Server-side cost of keeping dashboards current: /stats polls versus
+// pushes on /api/live (web task only)
+struct LiveCost {
+  uint32_t polls = 0;
+  uint64_t pollUs = 0;       // Handler time, totals for the averages
+  uint64_t pollBytes = 0;    // Response bodies
+  uint32_t pushes = 0;       // Change checks that sent an event
+  uint32_t checks = 0;       // Change checks run
+  uint64_t pushUs = 0;       // Check + diff + serialize, all checks
+  uint64_t pushBytes = 0;    // Event bytes, once (not per stream)
+};
+
+static LiveCost liveCost;
+
+/**
+ * Write the /stats "live" object
+ * Per-request cost on both paths; a poll also costs each tab a TCP
+ * connection and an auth check, a push is shared by all streams.
+ */
+inline void writeLiveStats(JsonWriter& out) {
+  out.beginObject("live");
+  out.field("streams", server.streamCount());
+  out.field("polls", liveCost.polls);
+  out.field("pollUs", liveCost.polls > 0 ? liveCost.pollUs / liveCost.polls : 0);
+  out.field("pollBytes", liveCost.polls > 0 ? liveCost.pollBytes / liveCost.polls : 0);
+  out.field("checks", liveCost.checks);
+  out.field("pushes", liveCost.pushes);
+  out.field("checkUs", liveCost.checks > 0 ? liveCost.pushUs / liveCost.checks : 0);
+  out.field("pushBytes", liveCost.pushes > 0 ? liveCost.pushBytes / liveCost.pushes : 0);
+  out.endObject();
+}
+
+// Top-level /stats members: the web side of the metrics schema, then
+// the web-task-only objects
+#define STATS_FIELD_COUNT (METRIC_FIELD_COUNT + 3)
+
+/**
+ * Write one top-level /stats member into the open object
+ * @param i 0 .. STATS_FIELD_COUNT - 1
+ */
+inline void writeStatsField(JsonWriter& out, const MetricsSnapshot& m, size_t i) {
+  if (i < METRIC_FIELD_COUNT) {
+    writeMetricField(out, metricFields[i], m, METRICS_WEB);
+    return;
+  }
+  switch (i - METRIC_FIELD_COUNT) {
+    case 0: writeCpuStats(out); break;
+    case 1: writeHttpStats(out); break;
+    case 2: writeLiveStats(out); break;
+  }
+}
+
+/**
+ * Write the /stats fields (also the top level of /api/dashboard)
+ */
+inline void writeStatsFields(JsonWriter& out) {
+  MetricsSnapshot m;
+  captureMetrics(m);
+  for (size_t i = 0; i < STATS_FIELD_COUNT; i++) {
+    writeStatsField(out, m, i);
+  }
+}
+
+// ===========================================
+// STATS HANDLERS
+// ===========================================
+
 /**
  * Handle GET /stats
  * Returns comprehensive system statistics as JSON
  */
 inline void handleStats() {
+  unsigned long start = micros();
   if (!checkAuth()) { sendUnauthorized(); return; }
 
-  JsonDocument doc;
-  
-  float successRate = stats.totalChecks > 0 
-    ? (100.0 * stats.successfulChecks / stats.totalChecks) 
-    : 100;
-
-  const char* stateStr;
-  switch (currentState) {
-    case STATE_INTERNET_OK: stateStr = "ONLINE"; break;
-    case STATE_INTERNET_DEGRADED: stateStr = "DEGRADED"; break;
-    case STATE_INTERNET_DOWN: stateStr = "OFFLINE"; break;
-    case STATE_WIFI_LOST: stateStr = "NO WIFI"; break;
-    default: stateStr = "STARTING"; break;
-  }
+  beginJsonResponse();
+  JsonWriter out(jsonChunk, JSON_CHUNK, jsonToClient);
+  out.beginObject();
+  writeStatsFields(out);
+  out.endObject();
+  out.finish();
 
-  // State info
-  doc["state"] = currentState;
-  doc["stateText"] = stateStr;
-  
-  // Uptime and checks
-  doc["uptime"] = millis() - stats.bootTime;
-  doc["checks"] = stats.totalChecks;
-  doc["rate"] = serialized(String(successRate, 1));
-  doc["failed"] = stats.failedChecks;
-  doc["downtime"] = stats.totalDowntimeMs;
-  doc["lastOutage"] = stats.lastDowntime;
-  
-  // Network info
-  doc["rssi"] = WiFi.RSSI();
-  
-  // System info
-  doc["heap"] = ESP.getFreeHeap();
-  doc["minHeap"] = ESP.getMinFreeHeap();
-  doc["temp"] = serialized(String(getChipTemp(), 1));
-  doc["cpuFreq"] = ESP.getCpuFreqMHz();
-  
-  // Performance metrics
-  doc["ledFps"] = serialized(String(perf.ledActualFPS, 1));
-  doc["ledFrameUs"] = perf.ledFrameTimeUs;
-  doc["ledMaxFrameUs"] = perf.ledMaxFrameTimeUs;
-  doc["ledStack"] = perf.ledStackHighWater * 4;
-  doc["netStack"] = perf.netStackHighWater * 4;
-  
-  // Static info
-  doc["effects"] = NUM_EFFECTS;
-  doc["dualCore"] = true;
-  doc["version"] = FW_VERSION;
+  liveCost.polls++;
+  liveCost.pollUs += micros() - start;
+  liveCost.pollBytes += out.length();
+}
 
-  String output;
-  serializeJson(doc, output);
-  server.send(200, "application/json", output);
+/**
+ * Handle GET /api/dashboard
+ * Everything the static dashboard page renders, in one response:
+ * the /stats fields plus
+ * {"settings":{"effect":3,"brightness":20,"speed":50,"rotation":0},
+ *  "effectList":["Off","Solid",...],
+ *  "device":{"ssid":"home","ip":"192.168.1.40","mac":"AA:BB:...","channel":6,
+ *            "flashMb":8,"sketchKb":1204},
+ *  "mqtt":{"enabled":true,"connected":true,"status":"Connected","broker":"...",
+ *          "port":1883,"username":"","hasPassword":false,"topic":"internet_monitor",
+ *          "interval":30,"ha_discovery":true}}
+ */
+inline void handleDashboardData() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  static uint32_t sketchSize = 0;  // Reads the app image header, so only once
+  if (sketchSize == 0) sketchSize = ESP.getSketchSize();
+
+  char ip[16];
+  IPAddress addr = WiFi.localIP();
+  snprintf(ip, sizeof(ip), "%u.%u.%u.%u", addr[0], addr[1], addr[2], addr[3]);
+
+  uint8_t mac[6];
+  char macStr[18];
+  WiFi.macAddress(mac);
+  snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+           mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+
+  char mqttStatus[40];
+  getMQTTStatusText(mqttStatus, sizeof(mqttStatus));
+
+  beginJsonResponse();
+  JsonWriter out(jsonChunk, JSON_CHUNK, jsonToClient);
+  out.beginObject();
+  writeStatsFields(out);
+
+  out.beginObject("settings");
+  out.field("effect", currentEffect);
+  out.field("brightness", currentBrightness);
+  out.field("speed", effectSpeed);
+  out.field("rotation", currentRotation);
+  out.endObject();
+
+  out.beginArray("effectList");
+  for (int i = 0; i < NUM_EFFECTS; i++) {
+    out.value(effectNames[i]);
+  }
+  out.endArray();
+
+  out.beginObject("device");
+  out.field("ssid", storedSSID.c_str());
+  out.field("ip", ip);
+  out.field("mac", macStr);
+  out.field("channel", WiFi.channel());
+  out.field("flashMb", ESP.getFlashChipSize() / 1024 / 1024);
+  out.field("sketchKb", sketchSize / 1024);
+  out.endObject();
+
+  out.beginObject("mqtt");
+  out.field("enabled", mqttConfig.enabled);
+  out.field("connected", mqttConfig.connected);
+  out.field("status", mqttStatus);
+  out.field("broker", mqttConfig.broker);
+  out.field("port", mqttConfig.port);
+  out.field("username", mqttConfig.username);
+  out.field("hasPassword", mqttConfig.password[0] != '\0');
+  out.field("topic", mqttConfig.baseTopic);
+  out.field("interval", mqttConfig.publishIntervalMs / 1000);
+  out.field("ha_discovery", mqttConfig.homeAssistantDiscovery);
+  out.endObject();
+
+  out.endObject();
+  out.finish();
 }
 
 #endif // WEB_HANDLERS_H
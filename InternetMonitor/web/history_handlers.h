@@ -0,0 +1,91 @@
+#ifndef WEB_HISTORY_HANDLERS_H
+#define WEB_HISTORY_HANDLERS_H
+
+/**
+ * @file history_handlers.h
+ * @brief Web API handler for the check history range query
+ */
+
+#include <Arduino.h>
+#include "../storage/history.h"
+#include "http_server.h"
+#include "auth.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+
+// Query results (web handlers run one at a time on the web task)
+static HistoryPoint historyPoints[HISTORY_MAX_POINTS];
+
+// ===========================================
+// HISTORY HANDLER
+// ===========================================
+
+/**
+ * Handle GET /history?range=3600[&tier=minute][&points=120]
+ * range:  seconds back from now (60 s - 90 days, default 1 h)
+ * tier:   raw, minute, hour or day (default: finest tier covering range)
+ * points: max points returned (default and max HISTORY_MAX_POINTS)
+ *
+ * Response, points oldest first as [t, checks, failures, avgMs, maxMs].
+ * t and now are seconds since boot; utc is Unix time at `now` (0 if the
+ * clock hasn't synced), so a point's wall time is utc - (now - t):
+ * {"tier":"minute","now":86400,"utc":1717243200,"range":3600,"step":60,"points":[[82800,6,0,212,340],...]}
+ */
+inline void handleHistory() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  long range = server.hasArg("range") ? server.arg("range").toInt() : 3600;
+  if (range < 60 || range > 90L * 86400) {
+    sendError(400, "range must be 60 s - 90 days");
+    return;
+  }
+
+  HistoryTierId tier = historyPickTier(range);
+  if (server.hasArg("tier")) {
+    int t = historyTierFromName(server.arg("tier").c_str());
+    if (t < 0) {
+      sendError(400, "tier must be raw, minute, hour or day");
+      return;
+    }
+    tier = (HistoryTierId)t;
+  }
+
+  int maxPoints = HISTORY_MAX_POINTS;
+  if (server.hasArg("points")) {
+    maxPoints = constrain(server.arg("points").toInt(), 10, HISTORY_MAX_POINTS);
+  }
+
+  uint32_t now = clockUptimeSec();
+  uint32_t from = now >= (uint32_t)range ? now - range + 1 : 0;  // Inclusive, exactly `range` seconds
+  uint32_t stepSec;
+  int n = historyQuery(tier, from, now, historyPoints, maxPoints, stepSec);
+
+  // Stream in small chunks instead of building one large String
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+
+  char chunk[512];
+  int len = snprintf(chunk, sizeof(chunk),
+    "{\"tier\":\"%s\",\"now\":%lu,\"utc\":%lu,\"range\":%ld,\"step\":%lu,\"points\":[",
+    historyTierNames[tier], (unsigned long)now, (unsigned long)clockUtcSec(), range, (unsigned long)stepSec);
+
+  for (int i = 0; i < n; i++) {
+    const HistoryPoint& p = historyPoints[i];
+    if (len > (int)sizeof(chunk) - 48) {
+      server.sendContent(chunk, len);
+      len = 0;
+    }
+    len += snprintf(chunk + len, sizeof(chunk) - len, "%s[%lu,%lu,%lu,%u,%u]",
+      i > 0 ? "," : "", (unsigned long)p.t, (unsigned long)p.checks, (unsigned long)p.failures,
+      p.avgRttMs, p.maxRttMs);
+  }
+
+  len += snprintf(chunk + len, sizeof(chunk) - len, "]}");
+  server.sendContent(chunk, len);
+}
+
+#endif // WEB_HISTORY_HANDLERS_H
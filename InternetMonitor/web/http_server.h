@@ -0,0 +1,902 @@
+#ifndef WEB_HTTP_SERVER_H
+#define WEB_HTTP_SERVER_H
+
+/**
+ * @file http_server.h
+ * @brief Non-blocking HTTP/1.1 server with the WebServer handler API
+ *
+ * Drop-in for the subset of the Arduino WebServer API the handlers use
+ * (on/arg/header/send/sendHeader/sendContent), built on lwIP sockets and
+ * driven by poll() from the web task (see server.h).
+ *
+ * Each of the HTTP_MAX_CLIENTS connections has its own request buffer and
+ * output queue. poll() select()s over all of them: requests are read as
+ * bytes arrive, and once one is complete its handler runs and the
+ * response is queued. Queued output drains whenever the socket is
+ * writable, so a slow client no longer holds up the others. Handlers
+ * still run one at a time, on the web task.
+ *
+ * Output from PROGMEM (FPSTR) is queued by reference; everything else is
+ * copied into HTTP_OUT_CHUNK blocks. Drained blocks go back to a pool of
+ * HTTP_OUT_POOL, so a warm server queues responses without touching the
+ * heap. A response that queues more than HTTP_OUT_MAX copied bytes makes
+ * the handler wait for that client, which stalls the whole web task, so
+ * the wait is capped at HTTP_FLUSH_WAIT_MS per response; a client that
+ * can't keep up loses its response instead.
+ *
+ * Responses are sent with "Connection: close"; a streamed body
+ * (setContentLength(CONTENT_LENGTH_UNKNOWN)) ends when the socket closes.
+ *
+ * A handler can instead keep its connection as an event stream
+ * (beginStream()). Up to HTTP_MAX_STREAMS stay open after the handler
+ * returns; streamWrite() queues the same bytes on all of them, and a
+ * client that falls HTTP_STREAM_MAX behind is dropped.
+ */
+
+#include <Arduino.h>
+#include <HTTP_Method.h>
+#include <functional>
+#include <lwip/sockets.h>
+#include <esp_memory_utils.h>
+#include <esp_task_wdt.h>
+#include "../config.h"
+
+#ifndef CONTENT_LENGTH_UNKNOWN
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#endif
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+// ===========================================
+// REQUEST LATENCY METRICS
+// ===========================================
+
+struct HttpMetrics {
+  uint32_t requests = 0;         // Responses completed
+  uint32_t dropped = 0;          // Closed early (client gone, timeout, error)
+  uint32_t rejected = 0;         // Malformed or too large (4xx from the server)
+  uint8_t active = 0;            // Open connections
+  uint8_t peakActive = 0;        // Most open at once
+  uint64_t handlerUsTotal = 0;   // Handler run time, for the average
+  uint32_t handlerUsMax = 0;
+  uint32_t outAllocs = 0;        // Output blocks taken from the heap (pool empty)
+  uint16_t latencyMs[HTTP_LATENCY_SAMPLES];  // Accept to last byte, recent requests
+  uint8_t latencyHead = 0;
+  uint8_t latencyFilled = 0;
+};
+
+/**
+ * Latency percentile over the recent requests
+ * @param pct 0-100
+ * @return Milliseconds, 0 before the first request
+ */
+inline uint16_t httpLatencyPercentile(const HttpMetrics& m, uint8_t pct) {
+  if (m.latencyFilled == 0) return 0;
+
+  uint16_t sorted[HTTP_LATENCY_SAMPLES];
+  uint8_t n = m.latencyFilled;
+  for (uint8_t i = 0; i < n; i++) {
+    uint16_t v = m.latencyMs[i];
+    uint8_t j = i;
+    while (j > 0 && sorted[j - 1] > v) {
+      sorted[j] = sorted[j - 1];
+      j--;
+    }
+    sorted[j] = v;
+  }
+  return sorted[(n - 1) * pct / 100];
+}
+
+// ===========================================
+// HTTP SERVER
+// ===========================================
+
+class HttpServer {
+public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  explicit HttpServer(uint16_t port) : _port(port) {}
+
+  // Routes (register before begin())
+  void on(const char* uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+
+  void on(const char* uri, HTTPMethod method, THandlerFunction fn) {
+    if (_routeCount >= HTTP_MAX_ROUTES) {
+      Serial.printf("[HTTP] Route table full, %s not registered\n", uri);
+      return;
+    }
+    _routes[_routeCount++] = {uri, method, fn};
+  }
+
+  void onNotFound(THandlerFunction fn) { _notFound = fn; }
+
+  // Every request header is kept (up to HTTP_MAX_HEADERS)
+  void collectHeaders(const char** keys, size_t count) { (void)keys; (void)count; }
+
+  /**
+   * Open the listening socket
+   */
+  void begin() {
+    if (_listenFd >= 0) return;
+
+    int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd < 0) {
+      Serial.println("[HTTP] socket() failed");
+      return;
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(_port);
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, HTTP_MAX_CLIENTS) < 0) {
+      Serial.printf("[HTTP] Can't listen on port %u\n", _port);
+      ::close(fd);
+      return;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    _listenFd = fd;
+  }
+
+  /**
+   * Close the listening socket and all connections, and forget the routes
+   * (call from the web task, or before it runs)
+   */
+  void stop() {
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++) {
+      if (_conns[i].fd >= 0) closeConn(_conns[i], false);
+    }
+    if (_listenFd >= 0) {
+      ::close(_listenFd);
+      _listenFd = -1;
+    }
+    _routeCount = 0;
+    _notFound = nullptr;
+  }
+
+  void close() { stop(); }
+
+  // Serviced by the web task; kept for WebServer compatibility
+  void handleClient() { poll(0); }
+
+  /**
+   * Accept, read, dispatch and write whatever is ready
+   * @param timeoutMs How long to wait for socket activity
+   */
+  void poll(uint32_t timeoutMs) {
+    if (_listenFd < 0) {
+      if (timeoutMs > 0) vTaskDelay(pdMS_TO_TICKS(timeoutMs));
+      return;
+    }
+
+    fd_set rd, wr;
+    FD_ZERO(&rd);
+    FD_ZERO(&wr);
+    int maxFd = -1;
+
+    // No free slot: leave new clients in the listen backlog
+    if (freeConn() != nullptr) {
+      FD_SET(_listenFd, &rd);
+      maxFd = _listenFd;
+    }
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++) {
+      HttpConn& c = _conns[i];
+      if (c.fd < 0) continue;
+      if (c.stream) {
+        FD_SET(c.fd, &rd);  // Only to notice the client leaving
+        if (c.head) FD_SET(c.fd, &wr);
+      } else {
+        FD_SET(c.fd, c.responding ? &wr : &rd);
+      }
+      if (c.fd > maxFd) maxFd = c.fd;
+    }
+
+    struct timeval tv;
+    tv.tv_sec = timeoutMs / 1000;
+    tv.tv_usec = (timeoutMs % 1000) * 1000;
+    int ready = maxFd >= 0 ? select(maxFd + 1, &rd, &wr, nullptr, &tv) : 0;
+    if (maxFd < 0 && timeoutMs > 0) vTaskDelay(pdMS_TO_TICKS(timeoutMs));
+    if (ready < 0) return;
+
+    if (ready > 0 && FD_ISSET(_listenFd, &rd)) acceptConn();
+
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++) {
+      HttpConn& c = _conns[i];
+      if (c.fd < 0) continue;
+
+      if (c.stream && FD_ISSET(c.fd, &rd) && !streamOpen(c)) {
+        closeConn(c, true);
+        continue;
+      }
+      if (!c.responding && FD_ISSET(c.fd, &rd)) {
+        readConn(c);
+        if (c.fd < 0) continue;
+      }
+      if (c.responding && (FD_ISSET(c.fd, &wr) || c.head == nullptr)) {
+        if (!writeConn(c)) {
+          closeConn(c, false);
+          continue;
+        }
+        if (c.head == nullptr && (!c.stream || c.failed)) {
+          closeConn(c, !c.failed);
+          continue;
+        }
+      }
+      // An idle stream is fine; one that can't drain isn't
+      if (c.stream && c.head == nullptr) continue;
+      // Read the clock after this connection's I/O: lastIoMs may have just
+      // moved past a timestamp taken before it, and the difference is unsigned
+      if (millis() - c.lastIoMs > HTTP_IDLE_TIMEOUT_MS) closeConn(c, false);
+    }
+  }
+
+  // ===========================================
+  // REQUEST ACCESS (current request)
+  // ===========================================
+
+  String arg(const char* name) const {
+    int i = argIndex(name);
+    return i >= 0 ? String(_argValues[i]) : String();
+  }
+  String arg(const String& name) const { return arg(name.c_str()); }
+  bool hasArg(const char* name) const { return argIndex(name) >= 0; }
+  bool hasArg(const String& name) const { return hasArg(name.c_str()); }
+
+  String header(const char* name) const {
+    const char* value = headerValue(name);
+    return value ? String(value) : String();
+  }
+
+  // Like header(), without the String copy (valid until the handler returns)
+  const char* headerValue(const char* name) const {
+    for (uint8_t i = 0; i < _headerCount; i++) {
+      if (strcasecmp(_headerNames[i], name) == 0) return _headerValues[i];
+    }
+    return nullptr;
+  }
+
+  bool hasHeader(const char* name) const {
+    for (uint8_t i = 0; i < _headerCount; i++) {
+      if (strcasecmp(_headerNames[i], name) == 0) return true;
+    }
+    return false;
+  }
+
+  HTTPMethod method() const { return _method; }
+  String uri() const { return String(_uri); }
+
+  // ===========================================
+  // RESPONSE (current request)
+  // ===========================================
+
+  void sendHeader(const String& name, const String& value, bool first = false) {
+    String line = name + ": " + value + "\r\n";
+    if (first) _extraHeaders = line + _extraHeaders;
+    else _extraHeaders += line;
+  }
+
+  void setContentLength(size_t length) { _contentLength = length; }
+
+  void send(int code, const char* type = nullptr, const String& content = String()) {
+    sendHead(code, type, content.length());
+    queueCopy(content.c_str(), content.length());
+    flushNow();
+  }
+
+  void send(int code, const char* type, const char* content) {
+    size_t length = strlen(content);
+    sendHead(code, type, length);
+    if (esp_ptr_in_drom(content)) queueRef(content, length);
+    else queueCopy(content, length);
+    flushNow();
+  }
+
+  // Binary PROGMEM body, sent without a copy
+  void send_P(int code, const char* type, PGM_P content, size_t length) {
+    sendHead(code, type, length);
+    queueRef(content, length);
+    flushNow();
+  }
+
+  void sendContent(const String& content) { queueCopy(content.c_str(), content.length()); }
+  void sendContent(const char* content, size_t length) { queueCopy(content, length); }
+  void sendContent(const __FlashStringHelper* content) {
+    const char* p = reinterpret_cast<const char*>(content);
+    queueRef(p, strlen(p));
+  }
+
+  // ===========================================
+  // EVENT STREAMS
+  // ===========================================
+
+  /**
+   * Keep the current connection open after the handler returns
+   * Sends the head (no Content-Length); the handler may queue a first
+   * event with sendContent(). Set extra headers before calling.
+   * @return false if HTTP_MAX_STREAMS are already open
+   */
+  bool beginStream(const char* type) {
+    if (!_cur || _headSent || streamCount() >= HTTP_MAX_STREAMS) return false;
+    _contentLength = CONTENT_LENGTH_UNKNOWN;
+    sendHead(200, type, 0);
+    _cur->stream = true;
+    flushNow();
+    return true;
+  }
+
+  uint8_t streamCount() const {
+    uint8_t n = 0;
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++) {
+      if (_conns[i].fd >= 0 && _conns[i].stream) n++;
+    }
+    return n;
+  }
+
+  /**
+   * Queue the same bytes on every open stream (web task, outside handlers)
+   * Each stream gets its own copy; a stream already HTTP_STREAM_MAX
+   * behind is closed instead.
+   */
+  void streamWrite(const char* data, size_t length) {
+    HttpConn* saved = _cur;
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++) {
+      HttpConn& c = _conns[i];
+      if (c.fd < 0 || !c.stream || c.failed) continue;
+      if (c.queued + length > HTTP_STREAM_MAX) {
+        closeConn(c, false);
+        continue;
+      }
+      if (c.head == nullptr) c.lastIoMs = millis();  // Idle until now
+      _cur = &c;
+      queueCopy(data, length);
+      flushNow();
+    }
+    _cur = saved;
+  }
+
+  const HttpMetrics& metrics() const { return _metrics; }
+
+private:
+  struct HttpRoute {
+    const char* uri;
+    HTTPMethod method;
+    THandlerFunction fn;
+  };
+
+  // One queued piece of output; data points at flash or just past the
+  // struct (every block has HTTP_OUT_CHUNK bytes of storage)
+  struct OutSeg {
+    OutSeg* next;
+    const char* data;
+    size_t len;
+    size_t sent;
+    bool ref;        // data is a flash reference, not a copy
+  };
+
+  struct HttpConn {
+    int fd = -1;
+    bool responding = false;    // Handler ran, draining output
+    size_t reqLen = 0;
+    char req[HTTP_REQUEST_MAX + 1];
+    unsigned long acceptedUs = 0;
+    unsigned long lastIoMs = 0;
+    OutSeg* head = nullptr;
+    OutSeg* tail = nullptr;
+    size_t queued = 0;          // Copied bytes not yet sent
+    bool failed = false;        // Output discarded (out of memory, client gone)
+    bool stream = false;        // Stays open after the response (beginStream())
+    unsigned long flushWaitMs = 0;  // Time this response's handler spent in flushBlocking()
+  };
+
+  uint16_t _port;
+  int _listenFd = -1;
+  HttpRoute _routes[HTTP_MAX_ROUTES];
+  uint8_t _routeCount = 0;
+  THandlerFunction _notFound;
+  HttpConn _conns[HTTP_MAX_CLIENTS];
+  HttpMetrics _metrics;
+  OutSeg* _pool = nullptr;      // Drained output blocks for reuse
+  uint8_t _poolCount = 0;
+
+  // Current request, parsed in place in its connection's buffer
+  HttpConn* _cur = nullptr;
+  HTTPMethod _method = HTTP_GET;
+  const char* _uri = "";
+  const char* _argNames[HTTP_MAX_ARGS];
+  const char* _argValues[HTTP_MAX_ARGS];
+  uint8_t _argCount = 0;
+  const char* _headerNames[HTTP_MAX_HEADERS];
+  const char* _headerValues[HTTP_MAX_HEADERS];
+  uint8_t _headerCount = 0;
+
+  // Current response
+  bool _headSent = false;
+  size_t _contentLength = CONTENT_LENGTH_NOT_SET;
+  String _extraHeaders;
+
+  // ===========================================
+  // CONNECTIONS
+  // ===========================================
+
+  HttpConn* freeConn() {
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++) {
+      if (_conns[i].fd < 0) return &_conns[i];
+    }
+    return nullptr;
+  }
+
+  void acceptConn() {
+    HttpConn* c = freeConn();
+    if (!c) return;
+
+    int fd = accept(_listenFd, nullptr, nullptr);
+    if (fd < 0) return;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+    c->fd = fd;
+    c->responding = false;
+    c->reqLen = 0;
+    c->acceptedUs = micros();
+    c->lastIoMs = millis();
+    c->queued = 0;
+    c->failed = false;
+    c->stream = false;
+
+    _metrics.active++;
+    if (_metrics.active > _metrics.peakActive) _metrics.peakActive = _metrics.active;
+  }
+
+  OutSeg* takeSeg() {
+    OutSeg* seg = _pool;
+    if (seg) {
+      _pool = seg->next;
+      _poolCount--;
+      return seg;
+    }
+    seg = (OutSeg*)malloc(sizeof(OutSeg) + HTTP_OUT_CHUNK);
+    if (seg) _metrics.outAllocs++;
+    return seg;
+  }
+
+  void releaseSeg(OutSeg* seg) {
+    if (_poolCount >= HTTP_OUT_POOL) {
+      free(seg);
+      return;
+    }
+    seg->next = _pool;
+    _pool = seg;
+    _poolCount++;
+  }
+
+  void freeOutput(HttpConn& c) {
+    while (c.head) {
+      OutSeg* next = c.head->next;
+      releaseSeg(c.head);
+      c.head = next;
+    }
+    c.tail = nullptr;
+    c.queued = 0;
+  }
+
+  void closeConn(HttpConn& c, bool completed) {
+    // A stream's lifetime isn't a response time
+    if (!completed) _metrics.dropped++;
+    else if (!c.stream) recordLatency((micros() - c.acceptedUs) / 1000);
+
+    freeOutput(c);
+    ::close(c.fd);
+    c.fd = -1;
+    c.responding = false;
+    c.stream = false;
+    _metrics.active--;
+  }
+
+  /**
+   * Read and discard whatever a stream client sent
+   * @return false once the client has closed the connection
+   */
+  bool streamOpen(HttpConn& c) {
+    char discard[64];
+    int n = recv(c.fd, discard, sizeof(discard), MSG_DONTWAIT);
+    if (n == 0) return false;
+    return n > 0 || errno == EAGAIN || errno == EWOULDBLOCK;
+  }
+
+  void recordLatency(uint32_t ms) {
+    _metrics.requests++;
+    _metrics.latencyMs[_metrics.latencyHead] = (uint16_t)min(ms, (uint32_t)UINT16_MAX);
+    _metrics.latencyHead = (_metrics.latencyHead + 1) % HTTP_LATENCY_SAMPLES;
+    if (_metrics.latencyFilled < HTTP_LATENCY_SAMPLES) _metrics.latencyFilled++;
+  }
+
+  /**
+   * Read what has arrived; dispatch once the request is complete
+   */
+  void readConn(HttpConn& c) {
+    int n = recv(c.fd, c.req + c.reqLen, HTTP_REQUEST_MAX - c.reqLen, MSG_DONTWAIT);
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+      closeConn(c, false);
+      return;
+    }
+    if (n < 0) return;
+
+    c.reqLen += n;
+    c.req[c.reqLen] = '\0';
+    c.lastIoMs = millis();
+
+    char* headEnd = strstr(c.req, "\r\n\r\n");
+    if (!headEnd) {
+      if (c.reqLen >= HTTP_REQUEST_MAX) reject(c, 431, "headers too large");
+      return;
+    }
+
+    size_t bodyStart = headEnd + 4 - c.req;
+    size_t bodyLen;
+    if (!requestContentLength(c.req, bodyLen)) {
+      reject(c, 400, "bad content-length");
+      return;
+    }
+    if (bodyLen > HTTP_REQUEST_MAX - bodyStart) {
+      reject(c, 413, "request too large");
+      return;
+    }
+    if (c.reqLen < bodyStart + bodyLen) return;  // Body still arriving
+
+    dispatch(c, headEnd, bodyLen);
+  }
+
+  /**
+   * Push queued output without blocking
+   * @return false if the connection failed
+   */
+  bool writeConn(HttpConn& c) {
+    while (c.head) {
+      OutSeg* seg = c.head;
+      if (seg->sent < seg->len) {
+        int n = ::send(c.fd, seg->data + seg->sent, seg->len - seg->sent, MSG_DONTWAIT);
+        if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK;
+        seg->sent += n;
+        c.lastIoMs = millis();
+        if (seg->sent < seg->len) return true;
+      }
+      if (!seg->ref) c.queued -= seg->len;
+      c.head = seg->next;
+      if (!c.head) c.tail = nullptr;
+      releaseSeg(seg);
+    }
+    return true;
+  }
+
+  // ===========================================
+  // REQUEST PARSING
+  // ===========================================
+
+  /**
+   * Content-Length of the request (0 if absent)
+   * Digits only: strtoul() would take "-1" as ULONG_MAX. Values past
+   * HTTP_REQUEST_MAX are clamped, which is already too large.
+   * @return false if the header is present but not a number
+   */
+  static bool requestContentLength(const char* req, size_t& length) {
+    length = 0;
+    const char* line = strstr(req, "\r\n");
+    while (line && line[2] != '\r') {
+      line += 2;
+      if (strncasecmp(line, "Content-Length:", 15) == 0) {
+        const char* p = line + 15;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p < '0' || *p > '9') return false;
+        for (; *p >= '0' && *p <= '9'; p++) {
+          length = length * 10 + (*p - '0');
+          if (length > HTTP_REQUEST_MAX) length = HTTP_REQUEST_MAX + 1;
+        }
+        while (*p == ' ' || *p == '\t') p++;
+        return *p == '\r';
+      }
+      line = strstr(line, "\r\n");
+    }
+    return true;
+  }
+
+  static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  }
+
+  // Decode %XX and '+' in place
+  static void urlDecode(char* s) {
+    char* out = s;
+    while (*s) {
+      if (*s == '+') {
+        *out++ = ' ';
+        s++;
+      } else if (*s == '%' && hexValue(s[1]) >= 0 && hexValue(s[2]) >= 0) {
+        *out++ = (char)(hexValue(s[1]) * 16 + hexValue(s[2]));
+        s += 3;
+      } else {
+        *out++ = *s++;
+      }
+    }
+    *out = '\0';
+  }
+
+  void addArg(const char* name, const char* value) {
+    if (_argCount < HTTP_MAX_ARGS) {
+      _argNames[_argCount] = name;
+      _argValues[_argCount] = value;
+      _argCount++;
+    }
+  }
+
+  // Split "a=1&b=2" in place
+  void parseArgs(char* s) {
+    while (s && *s) {
+      char* next = strchr(s, '&');
+      if (next) *next++ = '\0';
+      char* eq = strchr(s, '=');
+      if (eq) *eq++ = '\0';
+      urlDecode(s);
+      if (eq) urlDecode(eq);
+      if (*s) addArg(s, eq ? eq : "");
+      s = next;
+    }
+  }
+
+  int argIndex(const char* name) const {
+    for (uint8_t i = 0; i < _argCount; i++) {
+      if (strcmp(_argNames[i], name) == 0) return i;
+    }
+    return -1;
+  }
+
+  static bool parseMethod(const char* s, HTTPMethod& out) {
+    if (strcmp(s, "GET") == 0) out = HTTP_GET;
+    else if (strcmp(s, "POST") == 0) out = HTTP_POST;
+    else if (strcmp(s, "PUT") == 0) out = HTTP_PUT;
+    else if (strcmp(s, "DELETE") == 0) out = HTTP_DELETE;
+    else if (strcmp(s, "HEAD") == 0) out = HTTP_HEAD;
+    else if (strcmp(s, "OPTIONS") == 0) out = HTTP_OPTIONS;
+    else if (strcmp(s, "PATCH") == 0) out = HTTP_PATCH;
+    else return false;
+    return true;
+  }
+
+  /**
+   * Parse the buffered request and run its handler
+   * @param headEnd Start of the blank line ending the headers
+   */
+  void dispatch(HttpConn& c, char* headEnd, size_t bodyLen) {
+    char* body = headEnd + 4;
+    body[bodyLen] = '\0';
+    *headEnd = '\0';
+
+    _argCount = 0;
+    _headerCount = 0;
+
+    // Request line: METHOD URI VERSION
+    char* line = c.req;
+    char* eol = strstr(line, "\r\n");
+    if (eol) *eol = '\0';
+    char* uri = strchr(line, ' ');
+    if (!uri) {
+      reject(c, 400, "bad request");
+      return;
+    }
+    *uri++ = '\0';
+    char* version = strchr(uri, ' ');
+    if (version) *version = '\0';
+    if (!parseMethod(line, _method)) {
+      reject(c, 405, "method not allowed");
+      return;
+    }
+    char* query = strchr(uri, '?');
+    if (query) *query++ = '\0';
+    urlDecode(uri);
+    _uri = uri;
+    parseArgs(query);
+
+    // Headers
+    bool form = false;
+    while (eol) {
+      line = eol + 2;
+      eol = strstr(line, "\r\n");
+      if (eol) *eol = '\0';
+      char* colon = strchr(line, ':');
+      if (!colon) continue;
+      *colon++ = '\0';
+      while (*colon == ' ') colon++;
+      if (strcasecmp(line, "Content-Type") == 0 &&
+          strncasecmp(colon, "application/x-www-form-urlencoded", 33) == 0) {
+        form = true;
+      }
+      if (_headerCount < HTTP_MAX_HEADERS) {
+        _headerNames[_headerCount] = line;
+        _headerValues[_headerCount] = colon;
+        _headerCount++;
+      }
+    }
+
+    // Form posts become arguments; any other body is "plain"
+    if (bodyLen > 0) {
+      if (form) parseArgs(body);
+      else addArg("plain", body);
+    }
+
+    // Run the handler
+    _cur = &c;
+    c.flushWaitMs = 0;
+    _headSent = false;
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+    _extraHeaders = "";
+
+    unsigned long start = micros();
+    THandlerFunction* fn = nullptr;
+    for (uint8_t i = 0; i < _routeCount; i++) {
+      if (strcmp(_routes[i].uri, _uri) == 0 &&
+          (_routes[i].method == HTTP_ANY || _routes[i].method == _method)) {
+        fn = &_routes[i].fn;
+        break;
+      }
+    }
+    if (fn) (*fn)();
+    else if (_notFound) _notFound();
+    else send(404, "text/plain", "Not found");
+    if (!_headSent) send(500, "text/plain", "No response");
+
+    uint32_t us = micros() - start;
+    _metrics.handlerUsTotal += us;
+    if (us > _metrics.handlerUsMax) _metrics.handlerUsMax = us;
+
+    _cur = nullptr;
+    _extraHeaders = "";
+    c.responding = true;
+    c.lastIoMs = millis();
+  }
+
+  /**
+   * Answer a request the server can't hand to a handler
+   */
+  void reject(HttpConn& c, int code, const char* message) {
+    _metrics.rejected++;
+    _cur = &c;
+    _headSent = false;
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+    _extraHeaders = "";
+    send(code, "text/plain", message);
+    _cur = nullptr;
+    c.responding = true;
+  }
+
+  // ===========================================
+  // RESPONSE OUTPUT
+  // ===========================================
+
+  static const char* statusText(int code) {
+    switch (code) {
+      case 200: return "OK";
+      case 204: return "No Content";
+      case 301: return "Moved Permanently";
+      case 302: return "Found";
+      case 304: return "Not Modified";
+      case 400: return "Bad Request";
+      case 401: return "Unauthorized";
+      case 403: return "Forbidden";
+      case 404: return "Not Found";
+      case 405: return "Method Not Allowed";
+      case 409: return "Conflict";
+      case 413: return "Payload Too Large";
+      case 429: return "Too Many Requests";
+      case 431: return "Request Header Fields Too Large";
+      case 500: return "Internal Server Error";
+      case 503: return "Service Unavailable";
+      default:  return "";
+    }
+  }
+
+  void sendHead(int code, const char* type, size_t length) {
+    if (!_cur || _headSent) return;
+    _headSent = true;
+
+    char head[160];
+    int n = snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\n", code, statusText(code));
+    if (type && type[0]) {
+      n += snprintf(head + n, sizeof(head) - n, "Content-Type: %s\r\n", type);
+    }
+    if (_contentLength == CONTENT_LENGTH_NOT_SET) _contentLength = length;
+    if (_contentLength != CONTENT_LENGTH_UNKNOWN) {
+      n += snprintf(head + n, sizeof(head) - n, "Content-Length: %lu\r\n", (unsigned long)_contentLength);
+    }
+    queueCopy(head, min((size_t)n, sizeof(head) - 1));
+    queueCopy(_extraHeaders.c_str(), _extraHeaders.length());
+    queueCopy("Connection: close\r\n\r\n", 21);
+  }
+
+  OutSeg* appendSeg(HttpConn& c, bool ref) {
+    OutSeg* seg = takeSeg();
+    if (!seg) {
+      c.failed = true;
+      freeOutput(c);
+      return nullptr;
+    }
+    seg->next = nullptr;
+    seg->data = (const char*)(seg + 1);
+    seg->len = 0;
+    seg->sent = 0;
+    seg->ref = ref;
+    if (c.tail) c.tail->next = seg;
+    else c.head = seg;
+    c.tail = seg;
+    return seg;
+  }
+
+  void queueRef(const char* data, size_t length) {
+    if (!_cur || _cur->failed || length == 0) return;
+    OutSeg* seg = appendSeg(*_cur, true);
+    if (!seg) return;
+    seg->data = data;
+    seg->len = length;
+  }
+
+  void queueCopy(const char* data, size_t length) {
+    if (!_cur || _cur->failed || length == 0) return;
+    HttpConn& c = *_cur;
+
+    while (length > 0) {
+      OutSeg* seg = c.tail;
+      if (!seg || seg->ref || seg->len == HTTP_OUT_CHUNK) {
+        seg = appendSeg(c, false);
+        if (!seg) return;
+      }
+      size_t n = min(length, HTTP_OUT_CHUNK - seg->len);
+      memcpy((char*)seg->data + seg->len, data, n);
+      seg->len += n;
+      c.queued += n;
+      data += n;
+      length -= n;
+    }
+
+    if (c.queued > HTTP_OUT_MAX) flushBlocking(c);
+  }
+
+  // Hand what's queued to lwIP now, so a handler that replies and then
+  // restarts the device still gets its response out
+  void flushNow() {
+    if (!_cur || _cur->failed) return;
+    if (!writeConn(*_cur)) {
+      _cur->failed = true;
+      freeOutput(*_cur);
+    }
+  }
+
+  /**
+   * Wait until a large response has drained below half of HTTP_OUT_MAX
+   * This blocks the web task (every connection, /api/live, the settings
+   * save), so a response gets HTTP_FLUSH_WAIT_MS in total; past that
+   * its output is dropped and the connection closed as failed.
+   */
+  void flushBlocking(HttpConn& c) {
+    unsigned long start = millis();
+    while (c.queued > HTTP_OUT_MAX / 2) {
+      if (!writeConn(c) || c.flushWaitMs + (millis() - start) > HTTP_FLUSH_WAIT_MS) {
+        c.failed = true;
+        freeOutput(c);
+        break;
+      }
+      if (c.queued <= HTTP_OUT_MAX / 2) break;
+
+      fd_set wr;
+      FD_ZERO(&wr);
+      FD_SET(c.fd, &wr);
+      struct timeval tv = {0, HTTP_POLL_MS * 1000};
+      select(c.fd + 1, nullptr, &wr, nullptr, &tv);
+      esp_task_wdt_reset();
+    }
+    c.flushWaitMs += millis() - start;
+  }
+};
+
+#endif // WEB_HTTP_SERVER_H
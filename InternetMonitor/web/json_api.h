@@ -0,0 +1,74 @@
+#ifndef WEB_JSON_API_H
+#define WEB_JSON_API_H
+
+/**
+ * @file json_api.h
+ * @brief JSON response and request-body helpers shared by the API handlers
+ */
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "http_server.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+
+// ===========================================
+// RESPONSE HELPERS
+// ===========================================
+
+/**
+ * Send a JSON error response
+ * @param code HTTP status code (e.g., 400, 401, 500)
+ * @param message Error message to include in response
+ */
+inline void sendError(int code, const char* message) {
+  JsonDocument doc;
+  doc["success"] = false;
+  doc["error"] = message;
+  String output;
+  serializeJson(doc, output);
+  server.send(code, "application/json", output);
+}
+
+/**
+ * Send a JSON success response
+ * @param message Optional success message
+ */
+inline void sendSuccess(const char* message = nullptr) {
+  JsonDocument doc;
+  doc["success"] = true;
+  if (message) {
+    doc["message"] = message;
+  }
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+// ===========================================
+// REQUEST HELPERS
+// ===========================================
+
+/**
+ * Read an optional integer field from a JSON body
+ * A wrong type or out-of-range value is an error rather than a silent
+ * fallback (`value | default` would keep the default).
+ * @param value Field (null when omitted; out is left unchanged)
+ * @param out Destination
+ * @return false if the field is present but not an integer in [min, max]
+ */
+template <typename T>
+inline bool readIntField(JsonVariantConst value, long min, long max, T& out) {
+  if (value.isNull()) return true;
+  if (!value.is<long>()) return false;
+  long n = value.as<long>();
+  if (n < min || n > max) return false;
+  out = (T)n;
+  return true;
+}
+
+#endif // WEB_JSON_API_H
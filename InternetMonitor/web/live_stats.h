@@ -0,0 +1,230 @@
+#ifndef WEB_LIVE_STATS_H
+#define WEB_LIVE_STATS_H
+
+/**
+ * @file live_stats.h
+ * @brief GET /api/live: /stats changes pushed as server-sent events
+ *
+ * A dashboard opens one EventSource instead of polling /stats every 2 s
+ * and /mqtt/status every 5 s. On connect it gets the full stats object;
+ * after that the web task checks every LIVE_INTERVAL_MS (sooner after a
+ * state event) and sends only the top-level fields that changed. The
+ * event is built once and queued on every open stream.
+ *
+ * Each check writes the whole object into liveJson, hashes every
+ * top-level member's text and compares it with the hash last pushed;
+ * changed members are moved together in place and sent. No heap use.
+ *
+ * uptime and utc are left out of the comparison (they always change);
+ * the page advances them itself between full snapshots. cpu and http
+ * differ on almost every check, so they are compared only every
+ * LIVE_SLOW_INTERVAL_MS rather than resending ~1 KB each second.
+ */
+
+#include <Arduino.h>
+#include "../config.h"
+#include "../core/json_writer.h"
+#include "../system/metrics.h"
+#include "../mqtt/mqtt_config.h"
+#include "http_server.h"
+#include "auth.h"
+#include "handlers.h"
+#include "event_handlers.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+extern MQTTConfig mqttConfig;
+
+// ===========================================
+// LIVE FIELDS
+// ===========================================
+
+// /stats members plus the MQTT status shown on the dashboard
+#define LIVE_FIELD_COUNT (STATS_FIELD_COUNT + 1)
+
+inline void writeLiveMqtt(JsonWriter& out) {
+  char status[40];
+  getMQTTStatusText(status, sizeof(status));
+  out.beginObject("mqtt");
+  out.field("enabled", mqttConfig.enabled);
+  out.field("connected", mqttConfig.connected);
+  out.field("status", status);
+  out.endObject();
+}
+
+/**
+ * Write one top-level member of the pushed object
+ * @param i 0 .. LIVE_FIELD_COUNT - 1
+ */
+inline void writeLiveField(JsonWriter& out, const MetricsSnapshot& m, size_t i) {
+  if (i < STATS_FIELD_COUNT) writeStatsField(out, m, i);
+  else writeLiveMqtt(out);
+}
+
+// ===========================================
+// LIVE STATE (web task only)
+// ===========================================
+
+static char liveJson[LIVE_JSON_MAX];             // Latest object, then the event body
+static uint32_t livePrevHash[LIVE_FIELD_COUNT];  // Members as last pushed
+static bool livePrevValid = false;
+static unsigned long liveLastCheck = 0;
+static unsigned long liveLastSend = 0;
+static unsigned long liveLastSlow = 0;            // Last check that compared slow fields
+static uint32_t liveSeenSeq = 0;                 // webEventSeq at the last check
+
+// FNV-1a over one member's JSON text
+inline uint32_t liveHash(const char* data, size_t length) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    h ^= (uint8_t)data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// Always different, and not worth an event on their own
+inline bool liveFieldVolatile(const char* member, size_t length) {
+  static const char* const keys[] = {"\"uptime\":", "\"utc\":", "\"live\":"};
+  for (const char* k : keys) {
+    size_t n = strlen(k);
+    if (length >= n && memcmp(member, k, n) == 0) return true;
+  }
+  return false;
+}
+
+// Change on nearly every check; compared every LIVE_SLOW_INTERVAL_MS
+inline bool liveFieldSlow(const char* member, size_t length) {
+  static const char* const keys[] = {"\"cpu\":", "\"http\":"};
+  for (const char* k : keys) {
+    size_t n = strlen(k);
+    if (length >= n && memcmp(member, k, n) == 0) return true;
+  }
+  return false;
+}
+
+/**
+ * Push changed fields to the open streams (call from the web task)
+ */
+inline void serviceLiveStats() {
+  if (server.streamCount() == 0) {
+    livePrevValid = false;
+    return;
+  }
+
+  unsigned long now = millis();
+  bool event = webEventSeq != liveSeenSeq;
+  if (!event && now - liveLastCheck < LIVE_INTERVAL_MS) {
+    if (now - liveLastSend >= LIVE_KEEPALIVE_MS) {
+      server.streamWrite(": ping\n\n", 8);
+      liveLastSend = now;
+    }
+    return;
+  }
+  liveLastCheck = now;
+  liveSeenSeq = webEventSeq;
+
+  unsigned long start = micros();
+  MetricsSnapshot m;
+  captureMetrics(m);
+
+  // Whole object, noting where each member starts and ends
+  uint16_t from[LIVE_FIELD_COUNT];
+  uint16_t to[LIVE_FIELD_COUNT];
+  JsonWriter out(liveJson, sizeof(liveJson));
+  out.beginObject();
+  for (size_t i = 0; i < LIVE_FIELD_COUNT; i++) {
+    from[i] = out.length();
+    writeLiveField(out, m, i);
+    to[i] = out.length();
+    if (from[i] < to[i] && liveJson[from[i]] == ',') from[i]++;
+  }
+  out.endObject();
+  out.finish();
+  if (out.overflow()) {
+    Serial.println("[Live] Stats exceed LIVE_JSON_MAX, not pushed");
+    return;
+  }
+
+  // Skipped slow fields keep their old hash, so a change goes out on
+  // the next slow pass
+  bool slowDue = !livePrevValid || now - liveLastSlow >= LIVE_SLOW_INTERVAL_MS;
+  if (slowDue) liveLastSlow = now;
+
+  // Move changed members to the front, comma-separated. Members only
+  // move left, past ones already hashed.
+  size_t length = 0;
+  for (size_t i = 0; i < LIVE_FIELD_COUNT; i++) {
+    const char* member = liveJson + from[i];
+    size_t n = to[i] - from[i];
+    if (n == 0 || liveFieldVolatile(member, n)) continue;
+    if (!slowDue && liveFieldSlow(member, n)) continue;
+
+    uint32_t h = liveHash(member, n);
+    if (livePrevValid && h == livePrevHash[i]) continue;
+    livePrevHash[i] = h;
+
+    if (length > 0) liveJson[length++] = ',';
+    memmove(liveJson + length, member, n);
+    length += n;
+  }
+  livePrevValid = true;
+
+  if (length > 0) {
+    static const char head[] = "event: stats\ndata: {";
+    server.streamWrite(head, sizeof(head) - 1);
+    server.streamWrite(liveJson, length);
+    server.streamWrite("}\n\n", 3);
+    liveLastSend = millis();
+    liveCost.pushes++;
+    liveCost.pushBytes += sizeof(head) - 1 + length + 3;
+  }
+
+  liveCost.checks++;
+  liveCost.pushUs += micros() - start;
+}
+
+// ===========================================
+// LIVE HANDLER
+// ===========================================
+
+/**
+ * Handle GET /api/live (text/event-stream)
+ * First event is the full object, later ones only changed fields:
+ *   retry: 3000
+ *   event: stats
+ *   data: {"state":4,"stateText":"ONLINE","checks":1520,...,"mqtt":{...}}
+ *
+ *   event: stats
+ *   data: {"checks":1521,"heap":182344}
+ * 503 when HTTP_MAX_STREAMS are open (the page polls /stats instead).
+ */
+inline void handleLive() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  server.sendHeader("Cache-Control", "no-cache");
+  if (!server.beginStream("text/event-stream")) {
+    sendError(503, "too many streams");
+    return;
+  }
+
+  char head[48];
+  int n = snprintf(head, sizeof(head), "retry: %d\nevent: stats\ndata: ", LIVE_RETRY_MS);
+  server.sendContent(head, n);
+
+  MetricsSnapshot m;
+  captureMetrics(m);
+  JsonWriter out(jsonChunk, JSON_CHUNK, jsonToClient);
+  out.beginObject();
+  for (size_t i = 0; i < LIVE_FIELD_COUNT; i++) {
+    writeLiveField(out, m, i);
+  }
+  out.endObject();
+  out.finish();
+  server.sendContent("\n\n", 2);
+}
+
+#endif // WEB_LIVE_STATS_H
@@ -0,0 +1,361 @@
+#ifndef WEB_METRICS_HANDLERS_H
+#define WEB_METRICS_HANDLERS_H
+
+/**
+ * @file metrics_handlers.h
+ * @brief GET /metrics in the Prometheus text format, and its scrape token
+ *
+ * Gauges and counters come from the metrics schema (system/metrics.h),
+ * followed by per-core / per-task CPU, the HTTP server counters and the
+ * probe RTT / LED frame time histograms (core/histogram.h). The body is
+ * streamed through the template writer one TEMPLATE_CHUNK at a time and
+ * never held whole; numbers are formatted without printf.
+ *
+ * /metrics is open until a token is set, like most exporters. After
+ * that a scrape needs "Authorization: Bearer <token>" (or a dashboard
+ * session). The token sits in NVS in plain text: it only guards
+ * read-only numbers, and Prometheus has to send it as is anyway.
+ */
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <ArduinoJson.h>
+#include "../config.h"
+#include "../core/histogram.h"
+#include "../system/metrics.h"
+#include "../system/cpu_stats.h"
+#include "http_server.h"
+#include "auth.h"
+#include "template.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+extern Preferences preferences;
+
+// ===========================================
+// SCRAPE TOKEN
+// ===========================================
+
+static char metricsToken[METRICS_TOKEN_MAX + 1] = "";  // "" = open
+
+inline void loadMetricsConfigFromNVS() {
+  preferences.begin(NVS_NAMESPACE, true);  // read-only
+  String token = preferences.getString(NVS_KEY_METRICS_TOKEN, "");
+  preferences.end();
+  strlcpy(metricsToken, token.c_str(), sizeof(metricsToken));
+}
+
+/**
+ * Set and persist the scrape token
+ * @param token Validated by the caller; "" opens /metrics again
+ */
+inline void setMetricsToken(const char* token) {
+  strlcpy(metricsToken, token, sizeof(metricsToken));
+  preferences.begin(NVS_NAMESPACE, false);  // read-write
+  preferences.putString(NVS_KEY_METRICS_TOKEN, metricsToken);
+  preferences.end();
+}
+
+// Same time whether a guess is wrong in its first or last character
+inline bool metricsTokenMatches(const char* given) {
+  size_t len = strlen(metricsToken);
+  size_t givenLen = strnlen(given, METRICS_TOKEN_MAX + 1);
+  uint8_t diff = len != givenLen;
+  for (size_t i = 0; i < len; i++) {
+    diff |= metricsToken[i] ^ (i < givenLen ? given[i] : 0);
+  }
+  return diff == 0;
+}
+
+inline bool checkMetricsAuth() {
+  if (metricsToken[0] == '\0') return true;
+  const char* header = server.headerValue("Authorization");
+  if (header && strncmp(header, "Bearer ", 7) == 0 && metricsTokenMatches(header + 7)) {
+    return true;
+  }
+  return checkAuth();
+}
+
+// Letters, digits and -._~ (safe in a header and a scrape config)
+inline bool metricsTokenValid(const char* token) {
+  size_t len = strlen(token);
+  if (len < METRICS_TOKEN_MIN || len > METRICS_TOKEN_MAX) return false;
+  for (const char* p = token; *p; p++) {
+    if (!isalnum((unsigned char)*p) && !strchr("-._~", *p)) return false;
+  }
+  return true;
+}
+
+// ===========================================
+// TEXT FORMAT
+// ===========================================
+
+#define PROM_PREFIX "internet_monitor_"
+
+// "# HELP" and "# TYPE" lines for one metric family
+inline void promFamily(TemplateWriter& out, const char* name, const char* type, const char* help) {
+  out.print("# HELP " PROM_PREFIX);
+  out.print(name);
+  out.print(" ");
+  out.print(help);
+  out.print("\n# TYPE " PROM_PREFIX);
+  out.print(name);
+  out.print(" ");
+  out.print(type);
+  out.print("\n");
+}
+
+// Label value: backslash, quote and newline escaped
+inline void promLabel(TemplateWriter& out, const char* value) {
+  for (; *value; value++) {
+    if (*value == '\\' || *value == '"') out.write("\\", 1);
+    if (*value == '\n') out.print("\\n");
+    else out.write(value, 1);
+  }
+}
+
+// A bucket bound or sum in seconds, trailing zeros trimmed
+inline void promSeconds(TemplateWriter& out, uint64_t value, uint32_t perSecond) {
+  char num[NUM_FORMAT_MAX];
+  uint8_t decimals = perSecond >= 1000000 ? 6 : 3;
+  size_t n = formatFixed(num, (double)value / perSecond, decimals);
+  while (n > 1 && num[n - 1] == '0') n--;
+  if (num[n - 1] == '.') n--;
+  out.write(num, n);
+}
+
+/**
+ * One schema entry as a gauge or counter (skipped if not on /metrics,
+ * text, or NaN)
+ */
+inline void writePromField(TemplateWriter& out, const MetricField& f, const MetricsSnapshot& m) {
+  if (!f.prom || f.type == METRIC_STR || f.type == METRIC_CHARS) return;
+  if ((f.type == METRIC_FLOAT1 || f.type == METRIC_FLOAT2) && isnan(metricValue<float>(f, m))) return;
+  bool seconds = f.flags & METRIC_PROM_SECONDS;
+
+  promFamily(out, f.prom, (f.flags & METRIC_COUNTER) ? "counter" : "gauge", f.help);
+  out.print(PROM_PREFIX);
+  out.print(f.prom);
+  out.print(" ");
+  switch (f.type) {
+    case METRIC_UINT:
+      if (seconds) out.printFixed(metricValue<uint64_t>(f, m) / 1000.0, 3);
+      else out.printUint(metricValue<uint64_t>(f, m));
+      break;
+    case METRIC_INT:
+      out.printInt(metricValue<int32_t>(f, m));
+      break;
+    case METRIC_FLOAT1:
+    case METRIC_FLOAT2: {
+      uint8_t decimals = f.type == METRIC_FLOAT1 ? 1 : 2;
+      float v = metricValue<float>(f, m);
+      if (seconds) out.printFixed(v / 1000.0, decimals + 3);
+      else out.printFixed(v, decimals);
+      break;
+    }
+    case METRIC_BOOL:
+      out.print(metricValue<bool>(f, m) ? "1" : "0");
+      break;
+    default:
+      break;
+  }
+  out.print("\n");
+}
+
+/**
+ * A histogram: cumulative buckets, +Inf, sum and count
+ * @param perSecond Recorded units per second (1000 for ms, 1000000 for us)
+ */
+inline void writePromHistogram(TemplateWriter& out, const char* name, const char* help,
+                               const Histogram& live, uint32_t perSecond) {
+  Histogram h;
+  histSnapshot(live, h);
+
+  promFamily(out, name, "histogram", help);
+  uint32_t cumulative = 0;
+  for (uint8_t i = 0; i <= h.boundCount; i++) {
+    cumulative += h.counts[i];
+    out.print(PROM_PREFIX);
+    out.print(name);
+    out.print("_bucket{le=\"");
+    if (i < h.boundCount) promSeconds(out, h.bounds[i], perSecond);
+    else out.print("+Inf");
+    out.print("\"} ");
+    out.printUint(cumulative);
+    out.print("\n");
+  }
+  out.print(PROM_PREFIX);
+  out.print(name);
+  out.print("_sum ");
+  promSeconds(out, h.sum, perSecond);
+  out.print("\n" PROM_PREFIX);
+  out.print(name);
+  out.print("_count ");
+  out.printUint(h.count);
+  out.print("\n");
+}
+
+/**
+ * CPU load from the sampler's table (web task only), rolling window
+ */
+inline void writePromCpu(TemplateWriter& out) {
+  if (cpuFilled == 0) return;
+
+  promFamily(out, "cpu_core_percent", "gauge", "CPU load per core, rolling window");
+  for (int c = 0; c < 2; c++) {
+    out.printf(PROM_PREFIX "cpu_core_percent{core=\"%d\"} ", c);
+    out.printFixed(cpuWindowAvg(cpuCoreBusy[c]) / 10.0, 1);
+    out.print("\n");
+  }
+
+  promFamily(out, "cpu_task_percent", "gauge", "CPU load per task (percent of one core), rolling window");
+  for (int i = 0; i < CPU_MAX_TASKS; i++) {
+    const CpuTaskStat& t = cpuTasks[i];
+    if (!t.handle) continue;
+    out.print(PROM_PREFIX "cpu_task_percent{task=\"");
+    promLabel(out, t.name);
+    if (t.core >= 0) out.printf("\",core=\"%d\"} ", t.core);
+    else out.print("\",core=\"any\"} ");
+    out.printFixed(cpuWindowAvg(t.pct) / 10.0, 1);
+    out.print("\n");
+  }
+}
+
+// A family with a single unlabelled sample
+inline void promSingle(TemplateWriter& out, const char* name, const char* type,
+                       const char* help, unsigned long long value) {
+  promFamily(out, name, type, help);
+  out.print(PROM_PREFIX);
+  out.print(name);
+  out.print(" ");
+  out.printUint(value);
+  out.print("\n");
+}
+
+/**
+ * HTTP server counters (web task only)
+ */
+inline void writePromHttp(TemplateWriter& out) {
+  const HttpMetrics& m = server.metrics();
+  promSingle(out, "http_requests_total", "counter", "HTTP responses completed", m.requests);
+  promSingle(out, "http_dropped_total", "counter", "HTTP connections closed early", m.dropped);
+  promSingle(out, "http_rejected_total", "counter", "Malformed or oversized HTTP requests", m.rejected);
+  promSingle(out, "http_output_allocs_total", "counter",
+             "HTTP output blocks taken from the heap (pool empty)", m.outAllocs);
+  promSingle(out, "http_connections", "gauge", "Open HTTP connections", m.active);
+}
+
+// ===========================================
+// METRICS HANDLER
+// ===========================================
+
+/**
+ * Handle GET /metrics (text/plain; version=0.0.4)
+ *   # HELP internet_monitor_checks_total Connectivity checks run
+ *   # TYPE internet_monitor_checks_total counter
+ *   internet_monitor_checks_total 1520
+ *   ...
+ *   internet_monitor_probe_rtt_seconds_bucket{le="0.05"} 1377
+ * 401 when a token is set and neither it nor a session is given.
+ */
+inline void handleMetrics() {
+  if (!checkMetricsAuth()) {
+    server.sendHeader("WWW-Authenticate", "Bearer");
+    server.send(401, "text/plain", "unauthorized\n");
+    return;
+  }
+
+  MetricsSnapshot m;
+  captureMetrics(m);
+
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain; version=0.0.4; charset=utf-8", "");
+
+  TemplateWriter& out = templateOut;
+  out.begin();
+
+  out.print("# HELP " PROM_PREFIX "build_info Firmware version\n"
+            "# TYPE " PROM_PREFIX "build_info gauge\n"
+            PROM_PREFIX "build_info{version=\"");
+  promLabel(out, m.version);
+  out.print("\"} 1\n");
+
+  for (size_t i = 0; i < METRIC_FIELD_COUNT; i++) {
+    writePromField(out, metricFields[i], m);
+  }
+  writePromCpu(out);
+  writePromHttp(out);
+  writePromHistogram(out, "probe_rtt_seconds", "Check target response time (passed checks)",
+                     probeRttHist, 1000);
+  writePromHistogram(out, "led_frame_seconds", "LED frame render time",
+                     ledFrameHist, 1000000);
+  out.flush();
+}
+
+// ===========================================
+// METRICS CONFIG HANDLERS
+// ===========================================
+
+/**
+ * Handle GET /metrics/config
+ * {"tokenSet":true} (the token itself is never returned)
+ */
+inline void handleMetricsConfigGet() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  JsonDocument doc;
+  doc["tokenSet"] = metricsToken[0] != '\0';
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+/**
+ * Handle POST /metrics/config
+ * JSON body, one of:
+ * {"token":"<16-64 of A-Z a-z 0-9 - . _ ~>"}  set
+ * {"token":""}                                open /metrics again
+ * {"generate":true}                           random token, returned once:
+ *                                             {"success":true,"token":"..."}
+ */
+inline void handleMetricsConfigSave() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  JsonDocument body;
+  if (deserializeJson(body, server.arg("plain"))) {
+    sendError(400, "invalid json");
+    return;
+  }
+
+  if (body["generate"] | false) {
+    char token[TOKEN_LENGTH + 1];
+    generateToken(token);
+    setMetricsToken(token);
+
+    JsonDocument doc;
+    doc["success"] = true;
+    doc["token"] = token;
+    String output;
+    serializeJson(doc, output);
+    server.send(200, "application/json", output);
+    return;
+  }
+
+  if (!body["token"].is<const char*>()) {
+    sendError(400, "token or generate required");
+    return;
+  }
+  const char* token = body["token"];
+  if (token[0] != '\0' && !metricsTokenValid(token)) {
+    sendError(400, "token must be 16-64 characters of A-Z a-z 0-9 - . _ ~");
+    return;
+  }
+
+  setMetricsToken(token);
+  sendSuccess(token[0] ? "metrics token set" : "metrics open");
+}
+
+#endif // WEB_METRICS_HANDLERS_H
@@ -7,17 +7,17 @@
  */
 
 #include <Arduino.h>
-#include <WebServer.h>
 #include <ArduinoJson.h>
 #include "../mqtt/mqtt_config.h"
 #include "../mqtt/mqtt_manager.h"
+#include "http_server.h"
 #include "auth.h"
 
 // ===========================================
 // EXTERNAL DECLARATIONS
 // ===========================================
 
-extern WebServer server;
+extern HttpServer server;
 extern MQTTConfig mqttConfig;
 
 // ===========================================
@@ -171,6 +171,11 @@ inline void handleMqttStatus() {
   doc["failures"] = mqttConfig.connectionFailures;
   doc["last_publish"] = (millis() - mqttConfig.lastPublishTime) / 1000;
   
+  // Seconds until the next reconnect attempt (0 when connected or due)
+  unsigned long sinceAttempt = millis() - mqttConfig.lastConnectAttempt;
+  doc["retry_in"] = (!mqttConfig.connected && sinceAttempt < mqttConfig.reconnectDelayMs)
+    ? (mqttConfig.reconnectDelayMs - sinceAttempt) / 1000 : 0;
+  
   String output;
   serializeJson(doc, output);
   server.send(200, "application/json", output);
@@ -0,0 +1,77 @@
+#ifndef WEB_OUTAGE_HANDLERS_H
+#define WEB_OUTAGE_HANDLERS_H
+
+/**
+ * @file outage_handlers.h
+ * @brief Web API handler for the outage journal
+ */
+
+#include <Arduino.h>
+#include "../storage/outage_log.h"
+#include "http_server.h"
+#include "auth.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+
+// One page of records (web handlers run one at a time on the web task)
+static OutageRecord outagePage[OUTAGE_LOG_PAGE_MAX];
+
+// ===========================================
+// OUTAGES HANDLER
+// ===========================================
+
+/**
+ * Handle GET /outages?limit=20[&before=<seq>]
+ * Newest first. Pass the returned "next" as `before` to get the
+ * following page; "next" is 0 on the last page.
+ *
+ * start/end are Unix time when "utc" is true, otherwise seconds since
+ * boot `boot` (the clock hadn't synced when the outage closed). uptime
+ * and utc in the header give the current boot's timebase.
+ *
+ * {"total":42,"boot":7,"uptime":86400,"utc":1717243200,"next":23,"outages":[{"seq":42,
+ *  "boot":7,"cause":"offline","utc":true,"start":1717230000,"end":1717230060,
+ *  "duration":60,"failed":6,"minRtt":180},...]}
+ */
+inline void handleOutages() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  int limit = 20;
+  if (server.hasArg("limit")) {
+    limit = constrain(server.arg("limit").toInt(), 1, OUTAGE_LOG_PAGE_MAX);
+  }
+  uint32_t before = server.hasArg("before") ? strtoul(server.arg("before").c_str(), NULL, 10) : 0;
+
+  uint32_t total;
+  int n = readOutages(before, outagePage, limit, total);
+  uint32_t next = (n == limit && outagePage[n - 1].seq > 1) ? outagePage[n - 1].seq : 0;
+
+  // Stream record by record, never holding the whole list as a String
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+
+  char chunk[192];
+  int len = snprintf(chunk, sizeof(chunk),
+    "{\"total\":%lu,\"boot\":%u,\"uptime\":%lu,\"utc\":%lu,\"next\":%lu,\"outages\":[",
+    (unsigned long)total, outageBootId, (unsigned long)clockUptimeSec(),
+    (unsigned long)clockUtcSec(), (unsigned long)next);
+  server.sendContent(chunk, len);
+
+  for (int i = 0; i < n; i++) {
+    const OutageRecord& r = outagePage[i];
+    len = snprintf(chunk, sizeof(chunk),
+      "%s{\"seq\":%lu,\"boot\":%u,\"cause\":\"%s\",\"utc\":%s,\"start\":%lu,\"end\":%lu,\"duration\":%lu,\"failed\":%u,\"minRtt\":%u}",
+      i > 0 ? "," : "", (unsigned long)r.seq, r.boot, outageCauseText(r.cause),
+      (r.flags & OUTAGE_FLAG_UTC) ? "true" : "false", (unsigned long)r.startSec, (unsigned long)r.endSec, (unsigned long)(r.endSec - r.startSec),
+      r.failedChecks, r.minRttMs);
+    server.sendContent(chunk, len);
+  }
+
+  server.sendContent("]}");
+}
+
+#endif // WEB_OUTAGE_HANDLERS_H
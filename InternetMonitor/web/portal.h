@@ -12,7 +12,6 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
 #include <DNSServer.h>
 #include <ArduinoJson.h>
 #include <esp_task_wdt.h>
@@ -20,15 +19,19 @@
 #include "../core/types.h"
 #include "../core/state.h"
 #include "../storage/nvs_manager.h"
+#include "http_server.h"
 #include "auth.h"
 #include "ui_login.h"
 #include "ui_portal.h"
+#include "ui_assets.h"
+#include "template.h"
+#include "server.h"
 
 // ===========================================
 // EXTERNAL DECLARATIONS
 // ===========================================
 
-extern WebServer server;
+extern HttpServer server;
 extern DNSServer dnsServer;
 extern bool configPortalActive;
 extern unsigned long lastPortalActivity;
@@ -104,6 +107,15 @@ inline String buildNetworkListHTML(int networkCount) {
 // PORTAL HANDLERS
 // ===========================================
 
+/**
+ * Placeholder values for PORTAL_HTML
+ */
+inline void fillPortal(const char* key, TemplateWriter& out) {
+  if (strcmp(key, "cssPath") == 0) out.print(ASSET_PORTAL_CSS_PATH);
+  else if (strcmp(key, "jsPath") == 0) out.print(ASSET_PORTAL_JS_PATH);
+  else if (strcmp(key, "networks") == 0) out.print(cachedNetworkListHTML.c_str());  // Already escaped
+}
+
 inline void handlePortalRoot() {
   Serial.println("Portal request received: /");
   lastPortalActivity = millis();
@@ -111,50 +123,13 @@ inline void handlePortalRoot() {
   // No auth required for config portal - it's on a local open AP network
   // and user may have just factory reset (no password knowledge)
 
-  // Chunked response for memory efficiency
   server.setContentLength(CONTENT_LENGTH_UNKNOWN);
   server.send(200, "text/html", "");
+  renderTemplate(PORTAL_HTML, fillPortal);
 
-  server.sendContent("<!DOCTYPE html><html><head>");
-  server.sendContent("<meta charset='UTF-8'>");
-  server.sendContent("<meta name='viewport' content='width=device-width,initial-scale=1'>");
-  server.sendContent("<title>WiFi Setup</title><style>");
-  server.sendContent(FPSTR(PORTAL_CSS));
-  server.sendContent("</style></head><body><div class='wrap'>");
-
-  // Header
-  server.sendContent("<h1>Internet Monitor</h1>");
-  server.sendContent("<p class='sub'>WIFI SETUP</p>");
-
-  // Network list
-  server.sendContent("<div class='card'><div class='card-title'>Select Network</div>");
-  server.sendContent("<div id='networks'>");
-  server.sendContent(cachedNetworkListHTML);
-  server.sendContent("</div>");
-  server.sendContent("<button class='btn scan' onclick='scan(event)'>Scan Again</button>");
-  server.sendContent("</div>");
-
-  // Password input (hidden initially)
-  server.sendContent("<div class='card' id='pwcard' style='display:none'>");
-  server.sendContent("<div class='card-title'>Enter Password</div>");
-  server.sendContent("<p id='selssid'></p>");
-  server.sendContent("<input type='password' id='pw' placeholder='WiFi Password'>");
-  server.sendContent("</div>");
-
-  // Admin password (always visible)
-  server.sendContent("<div class='card'>");
-  server.sendContent("<div class='card-title'>Dashboard Password</div>");
-  server.sendContent("<input type='password' id='adminpw' placeholder='Admin password (default: admin)'>");
-  server.sendContent("<p style='font-size:.7rem;color:#707088;margin-top:8px'>Leave blank to use default password: admin</p>");
-  server.sendContent("<button class='btn connect' onclick='connect()'>Connect</button>");
-  server.sendContent("</div>");
-
-  // Status
-  server.sendContent("<div class='status' id='status'></div>");
-
-  server.sendContent("</div><script>");
-  server.sendContent(FPSTR(PORTAL_JS));
-  server.sendContent("</script></body></html>");
+  Serial.printf("[Portal] Page %lu bytes, %u chunks, %lu us, heap blocks %+ld\n",
+    (unsigned long)templateStats.bytes, templateStats.chunks,
+    (unsigned long)templateStats.renderUs, (long)templateStats.heapBlocks);
 }
 
 inline void handleScan() {
@@ -285,6 +260,7 @@ inline void setupPortalWebServer() {
   server.on("/", HTTP_GET, handlePortalRoot);
   server.on("/scan", HTTP_GET, handleScan);
   server.on("/connect", HTTP_POST, handleConnect);
+  registerAssetRoutes();
 
   // Captive portal detection endpoints - redirect all to portal
   server.on("/generate_204", HTTP_GET, []() {
@@ -405,6 +381,7 @@ inline void enterConfigMode() {
   // Setup portal web server
   setupPortalWebServer();
   server.begin();
+  startWebTask();
 
   Serial.println("Config portal ready - connect to WiFi: " + String(CONFIG_AP_SSID));
 }
@@ -0,0 +1,287 @@
+#ifndef WEB_PROBE_HANDLERS_H
+#define WEB_PROBE_HANDLERS_H
+
+/**
+ * @file probe_handlers.h
+ * @brief Web API handlers for the probe target list
+ */
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "../network/probe_config.h"
+#include "../network/connectivity.h"
+#include "http_server.h"
+#include "auth.h"
+#include "json_api.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+extern QualityMetrics quality;
+
+// ===========================================
+// VALIDATION
+// ===========================================
+
+/**
+ * Parse and validate a single target from JSON
+ * @param obj JSON object with url, type, expect, weight, timeout
+ * @param out Parsed target
+ * @return nullptr on success, otherwise an error message
+ */
+inline const char* parseProbeTarget(JsonObjectConst obj, ProbeTarget& out) {
+  const char* url = obj["url"] | "";
+  if (strlen(url) == 0) return "target url required";
+  if (strlen(url) >= sizeof(out.url)) return "target url too long";
+
+  int type = probeTypeFromName(obj["type"] | "http");
+  if (type < 0) return "target type must be http or tcp";
+
+  if (type == PROBE_HTTP && strncmp(url, "http://", 7) != 0) {
+    return "http target must start with http://";
+  }
+  if (type == PROBE_TCP) {
+    const char* colon = strrchr(url, ':');
+    int port = colon ? atoi(colon + 1) : 0;
+    if (!colon || colon == url || port <= 0 || port > 65535) {
+      return "tcp target must be host:port";
+    }
+  }
+
+  int expect = 0;
+  if (!readIntField(obj["expect"], 0, 599, expect) || (expect != 0 && expect < 100)) {
+    return "expect must be 0 or 100-599";
+  }
+
+  int weight = PROBE_DEFAULT_WEIGHT;
+  if (!readIntField(obj["weight"], 1, PROBE_MAX_WEIGHT, weight)) return "weight must be 1-10";
+
+  int timeout = PROBE_DEFAULT_TIMEOUT;
+  if (!readIntField(obj["timeout"], 250, 10000, timeout)) return "timeout must be 250-10000 ms";
+
+  strlcpy(out.url, url, sizeof(out.url));
+  out.type = type;
+  out.expectStatus = expect;
+  out.weight = weight;
+  out.timeoutMs = timeout;
+  return nullptr;
+}
+
+/**
+ * Parse and validate burst settings from JSON
+ * Missing fields keep their current value in cfg.
+ * @param obj JSON object with enabled, host, count, interval, every
+ * @param cfg Config to update
+ * @return nullptr on success, otherwise an error message
+ */
+inline const char* parseBurstConfig(JsonObjectConst obj, ProbeConfig& cfg) {
+  const char* host = obj["host"] | cfg.burstHost;
+  if (strlen(host) == 0) return "burst host required";
+  if (strlen(host) >= sizeof(cfg.burstHost)) return "burst host too long";
+
+  int count = cfg.burstCount;
+  if (!readIntField(obj["count"], 10, 100, count)) return "burst count must be 10-100";
+
+  int interval = cfg.burstIntervalMs;
+  if (!readIntField(obj["interval"], 10, 1000, interval)) return "burst interval must be 10-1000 ms";
+
+  int every = cfg.burstEvery;
+  if (!readIntField(obj["every"], 1, 60, every)) return "burst every must be 1-60";
+
+  JsonVariantConst enabled = obj["enabled"];
+  if (!enabled.isNull() && !enabled.is<bool>()) return "burst enabled must be true or false";
+
+  cfg.burstEnabled = enabled | cfg.burstEnabled;
+  strlcpy(cfg.burstHost, host, sizeof(cfg.burstHost));
+  cfg.burstCount = count;
+  cfg.burstIntervalMs = interval;
+  cfg.burstEvery = every;
+  return nullptr;
+}
+
+// ===========================================
+// PROBE CONFIG GET HANDLER
+// ===========================================
+
+/**
+ * Handle GET /probes
+ * Returns target list, quorum settings, burst settings, per-target
+ * and burst results, connection pool counters and schedule/rate limit
+ */
+inline void handleProbesGet() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  ProbeConfig cfg;
+  probeConfigSnapshot(cfg);
+
+  JsonDocument doc;
+  doc["quorum"] = cfg.quorum;
+  doc["attempts"] = cfg.maxAttempts;
+  doc["max"] = MAX_PROBE_TARGETS;
+
+  JsonArray targets = doc["targets"].to<JsonArray>();
+  for (int i = 0; i < cfg.count; i++) {
+    const ProbeTarget& t = cfg.targets[i];
+    JsonObject obj = targets.add<JsonObject>();
+    obj["url"] = t.url;
+    obj["type"] = probeTypeName(t.type);
+    obj["expect"] = t.expectStatus;
+    obj["weight"] = t.weight;
+    obj["timeout"] = t.timeoutMs;
+
+    // Runtime results (reset whenever the list changes)
+    obj["ok"] = probeStatus[i].successes;
+    obj["fail"] = probeStatus[i].failures;
+    obj["rtt"] = probeStatus[i].lastRttMs;
+    obj["last"] = probeStatus[i].lastOk;
+  }
+
+  JsonObject burst = doc["burst"].to<JsonObject>();
+  burst["enabled"] = cfg.burstEnabled;
+  burst["host"] = cfg.burstHost;
+  burst["count"] = cfg.burstCount;
+  burst["interval"] = cfg.burstIntervalMs;
+  burst["every"] = cfg.burstEvery;
+
+  // Last burst results
+  burst["sent"] = quality.sent;
+  burst["received"] = quality.received;
+  burst["loss"] = serialized(String(quality.lossPct, 1));
+  burst["rtt"] = serialized(String(quality.rttMs, 1));
+  burst["jitter"] = serialized(String(quality.jitterMs, 1));
+  burst["score"] = quality.score;
+  burst["degraded"] = quality.degraded;
+
+  // Keep-alive pool counters (HTTP targets only)
+  JsonObject pool = doc["pool"].to<JsonObject>();
+  pool["reused"] = poolStats.reused;
+  pool["opened"] = poolStats.opened;
+  pool["stale"] = poolStats.stale;
+  pool["evicted"] = poolStats.evicted;
+
+  // Check timing and rate limit (see probe_schedule.h)
+  JsonObject schedule = doc["schedule"].to<JsonObject>();
+  schedule["phase"] = probeSchedule.phaseMs;
+  schedule["next"] = probeSchedule.delayMs;
+  schedule["jitter"] = CHECK_JITTER_PCT;
+  schedule["rate"] = PROBE_RATE_PER_MIN;
+  schedule["tokens"] = serialized(String(probeSchedule.tokens, 1));
+  schedule["deferred"] = probeSchedule.deferred;
+
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+// ===========================================
+// PROBE CONFIG SAVE HANDLER
+// ===========================================
+
+/**
+ * Handle POST /probes
+ * Replaces the target list with a JSON body:
+ * {"quorum":1,"attempts":2,"targets":[{"url":"http://...","type":"http",
+ *  "expect":204,"weight":1,"timeout":3000}],
+ *  "burst":{"enabled":true,"host":"1.1.1.1","count":50,"interval":50,"every":3}}
+ * "burst" is optional; omitted fields keep their current value.
+ * The whole list is validated before anything is applied; a field of the
+ * wrong type or out of range is a 400.
+ */
+inline void handleProbesSave() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  JsonDocument body;
+  if (deserializeJson(body, server.arg("plain"))) {
+    sendError(400, "invalid json");
+    return;
+  }
+
+  JsonArrayConst targets = body["targets"];
+  if (targets.isNull() || targets.size() == 0) {
+    sendError(400, "at least one target required");
+    return;
+  }
+  if (targets.size() > MAX_PROBE_TARGETS) {
+    sendError(400, "too many targets");
+    return;
+  }
+
+  // Start from the live config so omitted burst settings are kept
+  ProbeConfig cfg;
+  probeConfigSnapshot(cfg);
+  cfg.count = 0;
+
+  for (JsonObjectConst obj : targets) {
+    const char* err = parseProbeTarget(obj, cfg.targets[cfg.count]);
+    if (err) {
+      sendError(400, err);
+      return;
+    }
+    cfg.count++;
+  }
+
+  JsonObjectConst burst = body["burst"];
+  if (!burst.isNull()) {
+    const char* err = parseBurstConfig(burst, cfg);
+    if (err) {
+      sendError(400, err);
+      return;
+    }
+  }
+
+  // Omitted: the defaults, clamped to the list by normalizeProbeConfig()
+  int attempts = PROBE_DEFAULT_ATTEMPTS;
+  if (!readIntField(body["attempts"], 1, cfg.count, attempts)) {
+    sendError(400, "attempts must be 1 to the number of targets");
+    return;
+  }
+  int quorum = PROBE_DEFAULT_QUORUM;
+  if (!readIntField(body["quorum"], 1, min(attempts, (int)cfg.count), quorum)) {
+    sendError(400, "quorum must be 1 to attempts");
+    return;
+  }
+
+  cfg.maxAttempts = attempts;
+  cfg.quorum = quorum;
+  normalizeProbeConfig(cfg);
+
+  probeConfigApply(cfg);
+  saveProbeConfigToNVS(cfg);
+
+  Serial.printf("[Probe] %d targets configured (quorum %d of %d)\n",
+    cfg.count, cfg.quorum, cfg.maxAttempts);
+
+  JsonDocument doc;
+  doc["success"] = true;
+  doc["targets"] = cfg.count;
+  doc["quorum"] = cfg.quorum;
+  doc["attempts"] = cfg.maxAttempts;
+
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+// ===========================================
+// RESET PROBE CONFIG
+// ===========================================
+
+/**
+ * Handle POST /probes/reset
+ * Restores the default targets from config.h
+ */
+inline void handleProbesReset() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  ProbeConfig cfg;
+  setDefaultProbeConfig(cfg);
+  probeConfigApply(cfg);
+  clearProbeConfigFromNVS();
+
+  Serial.println("[Probe] Targets reset to defaults");
+  sendSuccess("probe targets reset");
+}
+
+#endif // WEB_PROBE_HANDLERS_H
@@ -5,20 +5,85 @@
  * @file server.h
  * @brief Web server setup and route registration
  * 
- * Configures the HTTP server and registers all API endpoint handlers.
+ * Configures the HTTP server, registers all API endpoint handlers and
+ * runs the web task that services it.
  */
 
 #include <Arduino.h>
-#include <WebServer.h>
+#include <esp_task_wdt.h>
+#include "../system/task_layout.h"
+#include "../system/cpu_stats.h"
+#include "../storage/nvs_manager.h"
+#include "http_server.h"
 #include "auth.h"
 #include "handlers.h"
 #include "mqtt_handlers.h"
+#include "probe_handlers.h"
+#include "throughput_handlers.h"
+#include "history_handlers.h"
+#include "outage_handlers.h"
+#include "time_handlers.h"
+#include "event_handlers.h"
+#include "live_stats.h"
+#include "task_handlers.h"
+#include "metrics_handlers.h"
 
 // ===========================================
 // EXTERNAL DECLARATIONS
 // ===========================================
 
-extern WebServer server;
+extern HttpServer server;
+extern TaskHandle_t webTaskHandle;
+
+// ===========================================
+// WEB TASK
+// ===========================================
+
+/**
+ * Web task: services the HTTP server, then the /events log, the
+ * /api/live pushes and the CPU sampler (all read by handlers on this
+ * task). The debounced settings save runs here too, so every Preferences
+ * write is on one task.
+ */
+inline void webTask(void* parameter) {
+  esp_task_wdt_add(NULL);
+
+  while (true) {
+    esp_task_wdt_reset();
+
+    // Waits up to HTTP_POLL_MS for socket activity
+    server.poll(HTTP_POLL_MS);
+
+    // Save settings to NVS if needed (debounced)
+    saveSettingsToNVSIfNeeded();
+
+    // Pick up state/check events for /events
+    serviceWebEvents();
+
+    // Push changed stats to /api/live streams
+    serviceLiveStats();
+
+    // Per-task CPU load (self-timed, every CPU_SAMPLE_MS)
+    sampleCpuStats();
+  }
+}
+
+/**
+ * Start the web task (once; normal mode and the config portal share it)
+ */
+inline void startWebTask() {
+  if (webTaskHandle != NULL) return;
+
+  xTaskCreatePinnedToCore(
+    webTask,
+    "Web",
+    HTTP_TASK_STACK,
+    NULL,
+    activeLayout.webPriority,
+    &webTaskHandle,
+    ARDUINO_RUNNING_CORE
+  );
+}
 
 // ===========================================
 // WEB SERVER SETUP
@@ -34,12 +99,18 @@ inline void setupWebServer() {
   server.on("/login", HTTP_POST, handleLogin);
   server.on("/logout", handleLogout);
   server.on("/stats", handleStats);
+  server.on("/api/dashboard", HTTP_GET, handleDashboardData);
+  server.on("/api/live", HTTP_GET, handleLive);
+  server.on("/api/settings", HTTP_POST, handleSettingsSave);
   server.on("/effect", handleEffect);
   server.on("/brightness", handleBrightness);
   server.on("/rotation", handleRotation);
   server.on("/speed", handleSpeed);
   server.on("/factory-reset", handleFactoryReset);
   
+  // Gzipped CSS/JS bundles (ui_assets.h)
+  registerAssetRoutes();
+  
   // MQTT routes
   server.on("/mqtt/config", HTTP_GET, handleMqttGetConfig);
   server.on("/mqtt/config", HTTP_POST, handleMqttSaveConfig);
@@ -47,7 +118,39 @@ inline void setupWebServer() {
   server.on("/mqtt/test", HTTP_POST, handleMqttTest);
   server.on("/mqtt/reset", HTTP_POST, handleMqttReset);
   
+  // Probe target routes
+  server.on("/probes", HTTP_GET, handleProbesGet);
+  server.on("/probes", HTTP_POST, handleProbesSave);
+  server.on("/probes/reset", HTTP_POST, handleProbesReset);
+  
+  // Throughput test routes
+  server.on("/throughput", HTTP_GET, handleThroughputGet);
+  server.on("/throughput/config", HTTP_POST, handleThroughputSaveConfig);
+  server.on("/throughput/run", HTTP_POST, handleThroughputRun);
+  
+  // Check history
+  server.on("/history", HTTP_GET, handleHistory);
+  server.on("/outages", HTTP_GET, handleOutages);
+  
+  // Clock
+  server.on("/time", HTTP_GET, handleTimeGet);
+  server.on("/time", HTTP_POST, handleTimeSave);
+  
+  // Event log (state changes, check results)
+  server.on("/events", HTTP_GET, handleEvents);
+  
+  // Task layout and benchmark
+  server.on("/tasks", HTTP_GET, handleTasksGet);
+  server.on("/tasks", HTTP_POST, handleTasksSave);
+  server.on("/tasks/bench", HTTP_POST, handleTasksBench);
+  
+  // Prometheus scrape endpoint and its token
+  server.on("/metrics", HTTP_GET, handleMetrics);
+  server.on("/metrics/config", HTTP_GET, handleMetricsConfigGet);
+  server.on("/metrics/config", HTTP_POST, handleMetricsConfigSave);
+  
   server.begin();
+  startWebTask();
   Serial.println("Web server started");
 }
 
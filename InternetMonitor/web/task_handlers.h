@@ -0,0 +1,188 @@
+#ifndef WEB_TASK_HANDLERS_H
+#define WEB_TASK_HANDLERS_H
+
+/**
+ * @file task_handlers.h
+ * @brief Web API handlers for the task layout and its benchmark
+ */
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "../system/task_layout.h"
+#include "../system/task_bench.h"
+#include "http_server.h"
+#include "auth.h"
+#include "json_api.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+
+// ===========================================
+// JSON HELPERS
+// ===========================================
+
+inline void taskLayoutToJson(JsonObject o, const TaskLayout& l) {
+  o["name"] = taskLayoutName(l);
+  o["led"]["core"] = l.ledCore;
+  o["led"]["priority"] = l.ledPriority;
+  o["net"]["core"] = l.netCore;
+  o["net"]["priority"] = l.netPriority;
+  o["mqtt"]["core"] = l.mqttCore;
+  o["mqtt"]["priority"] = l.mqttPriority;
+  o["web"]["core"] = ARDUINO_RUNNING_CORE;  // Not configurable
+  o["web"]["priority"] = l.webPriority;
+}
+
+// ===========================================
+// TASK LAYOUT GET HANDLER
+// ===========================================
+
+/**
+ * Handle GET /tasks
+ * Saved and running layout, presets and the last benchmark:
+ * {"layout":{"name":"default","led":{"core":0,"priority":2},...},
+ *  "active":{...},"presets":["default","led-core1",...],
+ *  "bench":{"running":false,"phase":null,"ago":120,"error":"",
+ *           "results":[{"layout":"default","ledJitterUs":85,"ledJitterMaxUs":910,
+ *                       "ledFps":62.4,"probeMs":182,"probeMaxMs":240,"probeFail":0,
+ *                       "httpMs":14,"httpMaxMs":31,"httpFail":0},...]}}
+ */
+inline void handleTasksGet() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  BenchStatus bench;
+  benchSnapshot(bench);
+
+  JsonDocument doc;
+  taskLayoutToJson(doc["layout"].to<JsonObject>(), taskLayout);
+  taskLayoutToJson(doc["active"].to<JsonObject>(), activeLayout);
+
+  JsonArray presets = doc["presets"].to<JsonArray>();
+  for (size_t i = 0; i < TASK_LAYOUT_PRESET_COUNT; i++) {
+    presets.add(taskLayoutPresets[i].name);
+  }
+
+  JsonObject b = doc["bench"].to<JsonObject>();
+  b["running"] = bench.running;
+  if (bench.phase >= 0) b["phase"] = taskLayoutPresets[bench.phase].name;
+  else b["phase"] = nullptr;
+  b["ago"] = bench.finishedAt > 0 ? (millis() - bench.finishedAt) / 1000 : 0;
+  b["error"] = bench.error;
+
+  JsonArray results = b["results"].to<JsonArray>();
+  for (int i = 0; i < bench.completed; i++) {
+    const BenchResult& r = bench.results[i];
+    JsonObject o = results.add<JsonObject>();
+    o["layout"] = r.layout;
+    o["ledJitterUs"] = r.ledJitterUs;
+    o["ledJitterMaxUs"] = r.ledJitterMaxUs;
+    o["ledFps"] = serialized(String(r.ledFps, 1));
+    o["probeMs"] = r.probeAvgMs;
+    o["probeMaxMs"] = r.probeMaxMs;
+    o["probeFail"] = r.probeFailures;
+    o["httpMs"] = r.httpAvgMs;
+    o["httpMaxMs"] = r.httpMaxMs;
+    o["httpFail"] = r.httpFailures;
+  }
+
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+// ===========================================
+// TASK LAYOUT SAVE HANDLER
+// ===========================================
+
+/**
+ * Handle POST /tasks
+ * JSON body, either a preset or per-task fields (omitted fields keep
+ * their current value):
+ * {"preset":"led-core1"}
+ * {"led":{"core":1,"priority":2},"net":{"core":1},"web":{"priority":2}}
+ * A field of the wrong type or out of range is a 400 (nothing changes).
+ * Saved to NVS and applied right away.
+ */
+inline void handleTasksSave() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  JsonDocument body;
+  if (deserializeJson(body, server.arg("plain"))) {
+    sendError(400, "invalid json");
+    return;
+  }
+
+  if (benchTaskHandle != NULL || taskRelocationPending()) {
+    sendError(409, "layout change in progress");
+    return;
+  }
+
+  TaskLayout l = taskLayout;
+  if (body["preset"].is<const char*>()) {
+    const char* name = body["preset"];
+    bool found = false;
+    for (size_t i = 0; i < TASK_LAYOUT_PRESET_COUNT; i++) {
+      if (strcmp(name, taskLayoutPresets[i].name) == 0) {
+        l = taskLayoutPresets[i].layout;
+        found = true;
+      }
+    }
+    if (!found) {
+      sendError(400, "unknown preset");
+      return;
+    }
+  } else {
+    if (!readIntField(body["led"]["core"], 0, 1, l.ledCore) ||
+        !readIntField(body["net"]["core"], 0, 1, l.netCore) ||
+        !readIntField(body["mqtt"]["core"], 0, 1, l.mqttCore)) {
+      sendError(400, "core must be 0 or 1");
+      return;
+    }
+    if (!readIntField(body["led"]["priority"], 1, TASK_PRIORITY_MAX, l.ledPriority) ||
+        !readIntField(body["net"]["priority"], 1, TASK_PRIORITY_MAX, l.netPriority) ||
+        !readIntField(body["mqtt"]["priority"], 1, TASK_PRIORITY_MAX, l.mqttPriority) ||
+        !readIntField(body["web"]["priority"], 1, TASK_PRIORITY_MAX, l.webPriority)) {
+      sendError(400, "priority must be 1-5");
+      return;
+    }
+  }
+
+  const char* err = taskLayoutError(l);
+  if (err) {
+    sendError(400, err);
+    return;
+  }
+
+  taskLayout = l;
+  saveTaskLayoutToNVS(l);
+  applyTaskLayout(l);
+  sendSuccess("layout applied");
+}
+
+// ===========================================
+// BENCHMARK HANDLER
+// ===========================================
+
+/**
+ * Handle POST /tasks/bench
+ * Runs every preset in turn (about a minute and a half; normal checks
+ * pause meanwhile). Poll GET /tasks for the results.
+ */
+inline void handleTasksBench() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  if (WiFi.status() != WL_CONNECTED || networkTaskHandle == NULL) {
+    sendError(409, "not connected");
+    return;
+  }
+  if (!startTaskBenchmark()) {
+    sendError(409, "benchmark already running");
+    return;
+  }
+  sendSuccess("benchmark started");
+}
+
+#endif // WEB_TASK_HANDLERS_H
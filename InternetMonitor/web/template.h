@@ -0,0 +1,186 @@
+#ifndef WEB_TEMPLATE_H
+#define WEB_TEMPLATE_H
+
+/**
+ * @file template.h
+ * @brief Streaming PROGMEM template renderer
+ *
+ * renderTemplate() walks a PROGMEM template and copies it into a fixed
+ * TEMPLATE_CHUNK buffer (one TCP segment). For each {{key}} it calls the
+ * page's fill function, which writes the value through the same writer:
+ * print() / printEscaped() for strings, printf() via a fixed scratch
+ * buffer, printUint() / printFixed() for numbers without printf. Each
+ * full chunk is passed to server.sendContent() in one call. /metrics uses
+ * the same writer for its text format.
+ *
+ * Nothing here touches the heap; with the server's output pool warm a
+ * page render allocates nothing. Web task only (one static writer).
+ */
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <esp_heap_caps.h>
+#include "../config.h"
+#include "../core/num_format.h"
+#include "http_server.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+
+// ===========================================
+// TEMPLATE WRITER
+// ===========================================
+
+class TemplateWriter {
+public:
+  void begin() {
+    _len = 0;
+    bytes = 0;
+    chunks = 0;
+  }
+
+  void write(const char* data, size_t length) {
+    while (length > 0) {
+      size_t n = min(length, (size_t)TEMPLATE_CHUNK - _len);
+      memcpy(_buf + _len, data, n);
+      _len += n;
+      data += n;
+      length -= n;
+      if (_len == TEMPLATE_CHUNK) flush();
+    }
+  }
+
+  void print(const char* s) { write(s, strlen(s)); }
+
+  // Text or attribute value from user input (SSID, broker, topic...)
+  void printEscaped(const char* s) {
+    for (; *s; s++) {
+      switch (*s) {
+        case '&': print("&amp;"); break;
+        case '<': print("&lt;"); break;
+        case '>': print("&gt;"); break;
+        case '"': print("&quot;"); break;
+        case '\'': print("&#39;"); break;
+        default: write(s, 1); break;
+      }
+    }
+  }
+
+  __attribute__((format(printf, 2, 3)))
+  void printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(_scratch, sizeof(_scratch), format, args);
+    va_end(args);
+    if (n > 0) write(_scratch, min((size_t)n, sizeof(_scratch) - 1));
+  }
+
+  void printUint(unsigned long long v) {
+    char num[NUM_FORMAT_MAX];
+    write(num, formatUint(num, v));
+  }
+
+  void printInt(long long v) {
+    char num[NUM_FORMAT_MAX];
+    write(num, formatInt(num, v));
+  }
+
+  // Fixed decimals; NaN and infinity print as "NaN"
+  void printFixed(double v, uint8_t decimals) {
+    char num[NUM_FORMAT_MAX];
+    size_t n = formatFixed(num, v, decimals);
+    if (n > 0) write(num, n);
+    else print("NaN");
+  }
+
+  void flush() {
+    if (_len == 0) return;
+    server.sendContent(_buf, _len);
+    bytes += _len;
+    chunks++;
+    _len = 0;
+  }
+
+  uint32_t bytes = 0;   // Sent so far
+  uint16_t chunks = 0;  // sendContent() calls
+
+private:
+  char _buf[TEMPLATE_CHUNK];
+  size_t _len = 0;
+  char _scratch[TEMPLATE_SCRATCH];
+};
+
+// Writes the value of one placeholder
+typedef void (*TemplateFill)(const char* key, TemplateWriter& out);
+
+// Last page render (web task only)
+struct TemplateStats {
+  uint32_t renders = 0;
+  uint32_t bytes = 0;
+  uint16_t chunks = 0;
+  uint32_t renderUs = 0;
+  int32_t heapBlocks = 0;   // Allocated heap blocks after minus before
+};
+
+static TemplateWriter templateOut;
+static TemplateStats templateStats;
+
+// ===========================================
+// RENDERING
+// ===========================================
+
+/**
+ * Stream a template; the response head must already be sent
+ * (setContentLength(CONTENT_LENGTH_UNKNOWN) + send(200, type, ""))
+ * @param tpl PROGMEM template with {{key}} placeholders
+ * @param fill Called once per placeholder
+ */
+inline void renderTemplate(PGM_P tpl, TemplateFill fill) {
+  // Heap blocks are counted device-wide, so another task allocating at
+  // the same moment shows up here too
+  multi_heap_info_t before;
+  heap_caps_get_info(&before, MALLOC_CAP_8BIT);
+  unsigned long start = micros();
+
+  TemplateWriter& out = templateOut;
+  out.begin();
+
+  const char* p = tpl;
+  while (*p) {
+    const char* open = strstr(p, "{{");
+    if (!open) {
+      out.print(p);
+      break;
+    }
+    out.write(p, open - p);
+
+    const char* close = strstr(open + 2, "}}");
+    size_t keyLen = close ? close - open - 2 : 0;
+    if (!close || keyLen >= TEMPLATE_KEY_MAX) {
+      out.write(open, 2);  // Not a placeholder, copy as is
+      p = open + 2;
+      continue;
+    }
+
+    char key[TEMPLATE_KEY_MAX];
+    memcpy(key, open + 2, keyLen);
+    key[keyLen] = '\0';
+    fill(key, out);
+    p = close + 2;
+  }
+  out.flush();
+
+  multi_heap_info_t after;
+  heap_caps_get_info(&after, MALLOC_CAP_8BIT);
+
+  templateStats.renders++;
+  templateStats.bytes = out.bytes;
+  templateStats.chunks = out.chunks;
+  templateStats.renderUs = micros() - start;
+  templateStats.heapBlocks = (int32_t)after.allocated_blocks - (int32_t)before.allocated_blocks;
+}
+
+#endif // WEB_TEMPLATE_H
@@ -0,0 +1,160 @@
+#ifndef WEB_THROUGHPUT_HANDLERS_H
+#define WEB_THROUGHPUT_HANDLERS_H
+
+/**
+ * @file throughput_handlers.h
+ * @brief Web API handlers for the throughput test
+ */
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "../network/throughput_config.h"
+#include "../network/throughput.h"
+#include "http_server.h"
+#include "auth.h"
+#include "json_api.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+
+// ===========================================
+// THROUGHPUT GET HANDLER
+// ===========================================
+
+/**
+ * Handle GET /throughput
+ * Returns config and the last result
+ */
+inline void handleThroughputGet() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  ThroughputConfig cfg;
+  throughputConfigSnapshot(cfg);
+  const ThroughputResult& r = throughputResult;
+
+  JsonDocument doc;
+  doc["scheduled"] = cfg.scheduled;
+  doc["interval"] = cfg.intervalMin;
+  doc["size"] = cfg.sizeBytes;
+  doc["download"] = cfg.downloadUrl;
+  doc["upload"] = cfg.uploadUrl;
+  doc["uploadEnabled"] = cfg.uploadEnabled;
+
+  JsonObject result = doc["result"].to<JsonObject>();
+  result["running"] = (bool)r.running;
+  result["downMbps"] = serialized(String(r.downMbps, 2));
+  result["upMbps"] = serialized(String(r.upMbps, 2));
+  result["downBytes"] = r.downBytes;
+  result["upBytes"] = r.upBytes;
+  result["downMs"] = r.downMs;
+  result["upMs"] = r.upMs;
+  result["runs"] = r.runs;
+  result["failures"] = r.failures;
+  result["ago"] = r.runs > 0 ? (millis() - r.lastRun) / 1000 : 0;
+  result["error"] = r.lastError;
+
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+// ===========================================
+// THROUGHPUT CONFIG SAVE HANDLER
+// ===========================================
+
+/**
+ * Handle POST /throughput/config
+ * JSON body, omitted fields keep their current value:
+ * {"scheduled":true,"interval":360,"size":5242880,
+ *  "download":"http://...","upload":"http://...","uploadEnabled":false}
+ * A field of the wrong type or out of range is a 400 (nothing changes).
+ */
+inline void handleThroughputSaveConfig() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  JsonDocument body;
+  if (deserializeJson(body, server.arg("plain"))) {
+    sendError(400, "invalid json");
+    return;
+  }
+
+  ThroughputConfig cfg;
+  throughputConfigSnapshot(cfg);
+
+  // `value | current` would keep the current value for a wrong type
+  for (const char* key : {"download", "upload"}) {
+    if (!body[key].isNull() && !body[key].is<const char*>()) {
+      sendError(400, "urls must be strings");
+      return;
+    }
+  }
+  for (const char* key : {"scheduled", "uploadEnabled"}) {
+    if (!body[key].isNull() && !body[key].is<bool>()) {
+      sendError(400, "scheduled and uploadEnabled must be true or false");
+      return;
+    }
+  }
+
+  const char* download = body["download"] | cfg.downloadUrl;
+  const char* upload = body["upload"] | cfg.uploadUrl;
+  if (strncmp(download, "http://", 7) != 0 || strlen(download) >= sizeof(cfg.downloadUrl)) {
+    sendError(400, "download must be an http:// url");
+    return;
+  }
+  if (strncmp(upload, "http://", 7) != 0 || strlen(upload) >= sizeof(cfg.uploadUrl)) {
+    sendError(400, "upload must be an http:// url");
+    return;
+  }
+
+  uint32_t size = cfg.sizeBytes;
+  if (!readIntField(body["size"], 64 * 1024, THROUGHPUT_MAX_SIZE, size)) {
+    sendError(400, "size must be 64 KB - 100 MB");
+    return;
+  }
+
+  int interval = cfg.intervalMin;
+  if (!readIntField(body["interval"], 15, 10080, interval)) {
+    sendError(400, "interval must be 15-10080 minutes");
+    return;
+  }
+
+  // Defaults point into cfg itself, so copy out before writing back
+  char downloadUrl[THROUGHPUT_URL_MAX_LEN];
+  char uploadUrl[THROUGHPUT_URL_MAX_LEN];
+  strlcpy(downloadUrl, download, sizeof(downloadUrl));
+  strlcpy(uploadUrl, upload, sizeof(uploadUrl));
+  strlcpy(cfg.downloadUrl, downloadUrl, sizeof(cfg.downloadUrl));
+  strlcpy(cfg.uploadUrl, uploadUrl, sizeof(cfg.uploadUrl));
+
+  cfg.scheduled = body["scheduled"] | cfg.scheduled;
+  cfg.uploadEnabled = body["uploadEnabled"] | cfg.uploadEnabled;
+  cfg.sizeBytes = size;
+  cfg.intervalMin = interval;
+
+  throughputConfigApply(cfg);
+  saveThroughputConfigToNVS(cfg);
+  sendSuccess("throughput config saved");
+}
+
+// ===========================================
+// RUN NOW
+// ===========================================
+
+/**
+ * Handle POST /throughput/run
+ * Starts a test in the background; poll GET /throughput for the result
+ */
+inline void handleThroughputRun() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  if (!requestThroughputTest()) {
+    sendError(409, "test already running");
+    return;
+  }
+  sendSuccess("throughput test started");
+}
+
+#endif // WEB_THROUGHPUT_HANDLERS_H
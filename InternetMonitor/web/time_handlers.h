@@ -0,0 +1,87 @@
+#ifndef WEB_TIME_HANDLERS_H
+#define WEB_TIME_HANDLERS_H
+
+/**
+ * @file time_handlers.h
+ * @brief Web API handlers for the clock / NTP server
+ */
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "../core/clock.h"
+#include "http_server.h"
+#include "auth.h"
+
+// ===========================================
+// EXTERNAL DECLARATIONS
+// ===========================================
+
+extern HttpServer server;
+
+// ===========================================
+// TIME GET HANDLER
+// ===========================================
+
+/**
+ * Handle GET /time
+ * {"state":"synced","utc":1717243200,"iso":"2024-06-01T12:00:00Z",
+ *  "server":"pool.ntp.org","fallback":"time.google.com","syncs":12,
+ *  "ago":1800,"driftPpm":3.2,"errorMs":4,"uptime":86400}
+ */
+inline void handleTimeGet() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  ClockStatus c = clockSnapshot();
+
+  JsonDocument doc;
+  doc["state"] = clockStateText();
+  uint32_t utc = clockUtcSec();
+  doc["utc"] = utc;
+  if (c.synced) {
+    char iso[24];
+    clockFormatIso(utc, iso, sizeof(iso));
+    doc["iso"] = iso;
+  }
+  doc["server"] = ntpServer;
+  doc["fallback"] = NTP_FALLBACK_SERVER;
+  doc["syncs"] = c.syncs;
+  doc["ago"] = c.synced ? (uint32_t)((clockMonoMs() - c.lastSyncMono) / 1000) : 0;
+  doc["driftPpm"] = serialized(String(c.driftPpm, 1));
+  doc["errorMs"] = c.lastErrorMs;
+  doc["uptime"] = clockUptimeSec();
+
+  String output;
+  serializeJson(doc, output);
+  server.send(200, "application/json", output);
+}
+
+// ===========================================
+// TIME CONFIG HANDLER
+// ===========================================
+
+/**
+ * Handle POST /time
+ * JSON body: {"server":"192.168.1.10"}
+ * Replaces the primary NTP server and resyncs; the fallback stays.
+ */
+inline void handleTimeSave() {
+  if (!checkAuth()) { sendUnauthorized(); return; }
+
+  JsonDocument body;
+  if (deserializeJson(body, server.arg("plain"))) {
+    sendError(400, "invalid json");
+    return;
+  }
+
+  const char* host = body["server"] | "";
+  size_t len = strlen(host);
+  if (len == 0 || len >= NTP_SERVER_MAX_LEN || strchr(host, ' ') != NULL) {
+    sendError(400, "server must be a host name or IP");
+    return;
+  }
+
+  setClockServer(host);
+  sendSuccess("ntp server saved");
+}
+
+#endif // WEB_TIME_HANDLERS_H
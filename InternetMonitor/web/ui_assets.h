@@ -0,0 +1,873 @@
+#ifndef UI_ASSETS_H
+#define UI_ASSETS_H
+
+/**
+ * @file ui_assets.h
+ * @brief Gzipped CSS/JS bundles and pages (generated by tools/build_assets.py)
+ *
+ * Do not edit: change the literals in ui_*.h and rerun the script.
+ * Served by sendAsset() (handlers.h) with Content-Encoding: gzip;
+ * hashed /assets/ URLs by registerAssetRoutes(), pages by their handler.
+ */
+
+#include <Arduino.h>
+
+struct UiAsset {
+  const char* path;         // Hashed /assets/ URL, or a page's route
+  const char* type;
+  const char* etag;         // Quoted content hash
+  const char* cacheControl; // Immutable for hashed URLs, revalidate for pages
+  const uint8_t* data;      // Gzipped, PROGMEM
+  size_t length;
+};
+
+// DASHBOARD_CSS, CSS_MODAL: 6011 -> 1662 bytes
+#define ASSET_DASHBOARD_CSS_PATH "/assets/dashboard.9e5a2ff1.css"
+#define ASSET_DASHBOARD_CSS_INDEX 0
+static const uint8_t ASSET_DASHBOARD_CSS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x58,0xeb,0x6e,0xa3,0x38,
+  0x14,0xfe,0x3f,0x4f,0x81,0x34,0x1a,0xa9,0x5d,0xd5,0x08,0x48,0x48,0x08,0x68,0xa5,
+  0x7d,0x8f,0xd5,0xfe,0x30,0xd8,0x4e,0x3c,0x05,0x8c,0x8c,0x69,0x9b,0x41,0x7d,0xf7,
+  0xb5,0x8d,0x01,0x1b,0x48,0x2f,0x73,0x69,0xa5,0x56,0x60,0xfb,0xdc,0xcf,0xe7,0xef,
+  0xf0,0xc5,0x93,0x3f,0x7f,0xf5,0x39,0x7b,0x01,0x2d,0xfd,0x41,0xeb,0x73,0x9a,0x33,
+  0x8e,0x30,0x07,0xf2,0x4d,0x56,0x41,0x7e,0xa6,0x75,0x1a,0x64,0x0d,0x44,0x48,0xad,
+  0x05,0xaf,0x5f,0xd4,0xfe,0x9c,0xa1,0x6b,0x4f,0x58,0x2d,0x00,0x81,0x15,0x2d,0xaf,
+  0x29,0x80,0x4d,0x53,0x62,0xd0,0x5e,0x5b,0x81,0xab,0x87,0xe1,0x1f,0xe8,0xe8,0x43,
+  0x0b,0xeb,0x16,0xb4,0x98,0x53,0x92,0xe5,0xb0,0x78,0x3c,0x73,0xd6,0xd5,0x28,0xfd,
+  0x1a,0x90,0x80,0x84,0x30,0x2b,0x58,0xc9,0x78,0xfa,0x35,0x4f,0xf2,0xa4,0x48,0x26,
+  0x1d,0xe1,0xa1,0x91,0x9a,0x69,0x0d,0x2e,0x98,0x9e,0x2f,0x22,0x0d,0x83,0xe0,0xe9,
+  0x32,0xe8,0xf5,0x9f,0x39,0x6c,0xfa,0x0a,0xbe,0x80,0x67,0x8a,0xc4,0x25,0xdd,0x47,
+  0x41,0x33,0x5b,0xe9,0xc1,0x4e,0x30,0xb3,0xf1,0x82,0x78,0x8f,0x68,0xdb,0x94,0xf0,
+  0x9a,0x92,0x12,0xbf,0x64,0xdf,0xbb,0x56,0x50,0x72,0x05,0x85,0xb4,0x1a,0xd7,0x22,
+  0x6d,0x1b,0x58,0x60,0x90,0x63,0xf1,0x8c,0x71,0x9d,0xc1,0x92,0x9e,0x6b,0x40,0xa5,
+  0xd5,0x6d,0x5a,0xc8,0x65,0xcc,0x8d,0x54,0x19,0x06,0x21,0x58,0xa5,0x8d,0x9a,0x45,
+  0x83,0x12,0x13,0xd1,0x0b,0xfc,0x22,0x80,0x3e,0x99,0xaa,0xe7,0x61,0xf9,0x12,0x0e,
+  0x81,0x91,0xc1,0xc4,0x69,0xe8,0xef,0x39,0xae,0x32,0xfd,0xe2,0x79,0xf0,0xe6,0x10,
+  0x04,0x0b,0xd1,0x7b,0xe9,0x82,0x89,0x44,0x21,0xe3,0x80,0x12,0xa3,0xa7,0xed,0x72,
+  0x4b,0x94,0x7f,0x54,0x92,0xcc,0xbe,0x38,0x88,0x83,0x43,0x92,0x95,0x58,0x48,0x4b,
+  0x81,0x72,0x45,0x07,0x6e,0x32,0xb1,0x64,0x67,0xd6,0x89,0x7e,0x8c,0xa8,0xb4,0xdd,
+  0x0b,0x23,0xa9,0x66,0x48,0xad,0xda,0xe8,0xb5,0xac,0xa4,0xc8,0xfb,0xba,0x0b,0x76,
+  0xc1,0x3e,0x31,0x0b,0x80,0x43,0x44,0xbb,0x56,0xed,0x77,0xd2,0x15,0xc5,0x51,0xbc,
+  0x0f,0x46,0xe5,0x49,0x90,0x04,0xa7,0x24,0xb3,0x4c,0x3b,0xc4,0xda,0xb6,0x8e,0xb7,
+  0x72,0xbd,0x61,0x54,0xc5,0xcf,0xb1,0x24,0xbd,0xb0,0x27,0xcc,0x7b,0x5b,0xa6,0x52,
+  0x1c,0x07,0xdb,0x8e,0x0b,0x28,0xba,0xd6,0x0e,0xaf,0x49,0xc9,0xe8,0x4f,0xb4,0x9f,
+  0x7c,0x19,0x4d,0xd6,0xee,0x2d,0x52,0xb6,0x5f,0xb8,0x11,0xc2,0x10,0x46,0x78,0x23,
+  0x08,0x83,0x7f,0x8e,0x76,0x80,0x98,0x98,0x0a,0x88,0xd6,0x25,0xad,0x65,0xb1,0x94,
+  0xac,0x78,0xcc,0x86,0xca,0x0b,0x55,0xe1,0x4d,0x05,0xba,0x32,0x27,0x0e,0xbe,0x8d,
+  0xd6,0xf0,0x79,0x0f,0xac,0x69,0x05,0x05,0x65,0x75,0xda,0x74,0x65,0x8b,0xbd,0xa8,
+  0xf5,0x68,0x4d,0x68,0x2d,0xeb,0x2e,0x93,0xf1,0x11,0xb4,0x80,0xa5,0xf1,0xb8,0xa2,
+  0x08,0x95,0x78,0x30,0xe9,0x9f,0x47,0x7c,0x25,0x1c,0x56,0xb8,0xf5,0xf4,0xb9,0x3e,
+  0xf8,0xf6,0x20,0x9b,0xe2,0x5b,0xcf,0x54,0xe2,0xc5,0x35,0x0d,0x5f,0x63,0xeb,0xc9,
+  0x8f,0x5f,0x5d,0x57,0x54,0x20,0x9d,0xa2,0x3c,0x2c,0x8b,0xf2,0x28,0x8b,0x72,0x51,
+  0x4c,0x2a,0x9e,0x6f,0xd8,0xe4,0x17,0x90,0xa3,0xfe,0x13,0xd1,0xdd,0xca,0x97,0xdb,
+  0xf1,0x6e,0xf2,0xa2,0xa9,0x98,0x95,0x26,0x20,0xa8,0x28,0xf1,0x3b,0xed,0xa0,0x0b,
+  0x46,0x70,0x09,0x39,0x84,0xf1,0x2a,0xed,0x9a,0x06,0xf3,0x02,0xb6,0x78,0xa3,0x4f,
+  0x3e,0xa2,0xcd,0x97,0xd2,0x4b,0xd8,0xb4,0x34,0x97,0x9a,0xdd,0xe2,0xce,0x7e,0x0d,
+  0x5a,0xba,0x56,0x59,0x83,0x4b,0x5c,0x88,0xb4,0x66,0x35,0x7e,0x53,0xb5,0xe9,0x1d,
+  0xa7,0xf9,0x56,0x07,0x3c,0x5f,0xb0,0xf3,0xd9,0x89,0x50,0xa8,0x02,0xa4,0xa3,0x41,
+  0x75,0xc9,0x4d,0x81,0xf1,0xfc,0xa8,0xbd,0xa9,0x11,0xa3,0x49,0xd4,0x1c,0x49,0xce,
+  0x64,0x21,0xe1,0x3b,0x70,0x0a,0x10,0x3e,0xdf,0xdb,0x67,0xf5,0x45,0xa0,0xec,0x23,
+  0x25,0x7b,0x4e,0x2f,0xb2,0x40,0xa4,0xc7,0x96,0x52,0x05,0xd5,0x43,0x97,0x78,0xfe,
+  0xae,0xf5,0xb0,0xcc,0x06,0x90,0x78,0x90,0xcd,0xef,0x15,0xbc,0x07,0x6e,0xf4,0x95,
+  0xd0,0xd9,0x9e,0xde,0xda,0x1b,0xdc,0xbc,0x91,0xfc,0x33,0xa7,0x68,0x6a,0x58,0xf5,
+  0x90,0xa9,0x3f,0xb2,0xf6,0x2b,0xf9,0x46,0x60,0x99,0x9c,0xb2,0xab,0xea,0x36,0xe5,
+  0xb8,0xc1,0x50,0xdc,0xed,0x1e,0x42,0xc2,0xef,0xb3,0x33,0x6c,0xd2,0x64,0xd2,0x9e,
+  0x8b,0x7a,0xc2,0x4c,0xab,0xa9,0xdf,0xc5,0xcb,0xe4,0x93,0x78,0x99,0xac,0xe1,0xd2,
+  0x0e,0x1a,0x2c,0x4b,0xcf,0x0f,0xe3,0x76,0xb6,0xea,0x73,0xf8,0x29,0x0f,0xf8,0xb0,
+  0x10,0xf4,0x09,0x3b,0x27,0xf6,0xbb,0x5d,0x52,0xc0,0xd1,0x74,0x73,0xd0,0xbc,0x34,
+  0x4f,0x48,0x0a,0xc1,0xb6,0x18,0x46,0xc8,0x96,0xa8,0xfc,0x14,0x16,0x61,0xb1,0x10,
+  0x35,0xbc,0x34,0x87,0x31,0x21,0xb2,0xba,0x81,0x3a,0xa0,0x2e,0x6c,0xa7,0xd9,0xe6,
+  0x74,0xdb,0xbb,0x40,0x09,0x73,0x5c,0xda,0x2d,0x7e,0x58,0xb7,0xb8,0x2b,0x49,0xc1,
+  0xc6,0x47,0x9b,0xde,0x8f,0x27,0xad,0xad,0xcc,0xa4,0x4a,0x1e,0x7b,0x1e,0x2d,0x13,
+  0xac,0x19,0xae,0x0b,0x93,0xfd,0xf9,0x85,0x71,0x51,0x3f,0xdf,0xba,0x30,0x06,0x71,
+  0x83,0xf9,0x9f,0x00,0x06,0x1b,0xcc,0x62,0xcb,0xd5,0x63,0x70,0x0c,0x92,0xa5,0xab,
+  0xc9,0xd2,0xfa,0x27,0x58,0xf6,0x2e,0x7f,0x5a,0xb0,0x8c,0x61,0x3b,0xad,0x9b,0x4e,
+  0xfc,0x2b,0xae,0x0d,0xfe,0x5b,0xc6,0xe8,0x8c,0xff,0xeb,0xc7,0xfb,0x4b,0xde,0x50,
+  0xa6,0xab,0xd6,0xb7,0x69,0xb4,0x28,0x68,0x53,0xf5,0x52,0x7a,0xfe,0x48,0x85,0x22,
+  0x7b,0x18,0x4a,0x71,0x05,0xd6,0xf0,0xb5,0x79,0xf3,0xaf,0x14,0xa7,0xe9,0x78,0xdc,
+  0x78,0x20,0x2e,0x5d,0x95,0xf7,0xb7,0x64,0x1a,0x33,0x0f,0xd6,0x35,0x7b,0xd8,0xbc,
+  0x66,0x6d,0x3b,0x0f,0xbb,0xc3,0x81,0x84,0x26,0x50,0x12,0xb5,0x74,0x8e,0x9d,0x94,
+  0xa8,0x86,0xb7,0x6e,0x9b,0x9f,0x4b,0xfc,0x06,0xa6,0xbb,0x3a,0x3d,0x99,0xe9,0xba,
+  0xff,0x58,0x82,0x07,0x7e,0x60,0x51,0x57,0x25,0xc3,0x46,0xa2,0x3f,0xcd,0xde,0x8e,
+  0x37,0xc9,0x9b,0xb1,0xe4,0x77,0x80,0x89,0xa2,0x22,0x9f,0x69,0x8e,0xd1,0x79,0x59,
+  0xf7,0xde,0xc4,0x1d,0x46,0x00,0x59,0xe5,0x63,0x81,0xad,0x96,0xce,0xb4,0x84,0xad,
+  0x00,0xc5,0x85,0x96,0x92,0xad,0x0c,0xf1,0xb3,0x6e,0x5c,0xb5,0xc3,0x34,0xae,0x93,
+  0x1b,0x7b,0x59,0x35,0xda,0x92,0xc0,0x3b,0x8d,0x37,0x5e,0x40,0x8c,0xa1,0x51,0x4a,
+  0x14,0x15,0x71,0x8c,0x5f,0xfd,0x1c,0x4e,0xaf,0x30,0xd9,0xcb,0x9f,0x19,0x5a,0x01,
+  0x52,0x5d,0xe1,0x62,0xfa,0x91,0x84,0x28,0x44,0x8b,0xa0,0x9e,0x4e,0x61,0x1e,0xe6,
+  0xa3,0x4a,0x52,0xc0,0x18,0xc6,0xd9,0xef,0xc0,0xad,0xd9,0x88,0x8d,0xeb,0x65,0xa1,
+  0x15,0x93,0x88,0x44,0xe6,0x1c,0x61,0x4c,0x96,0xc8,0x1b,0xf4,0x5c,0x1b,0xb0,0x1e,
+  0x0f,0x6c,0x20,0x1f,0x47,0x29,0xda,0xce,0x55,0xe1,0xd2,0xeb,0x19,0x9e,0x4e,0xc1,
+  0x92,0xc7,0xef,0xc3,0x7d,0x74,0x58,0x57,0xbd,0x61,0xcb,0x15,0x46,0x14,0xde,0xa9,
+  0x01,0x72,0x90,0x75,0x54,0xfc,0xe2,0xbe,0xd7,0x8b,0x66,0x74,0x75,0x0a,0x71,0x83,
+  0xa0,0x2d,0x6b,0x73,0x63,0xfe,0x78,0x35,0xf2,0x86,0x91,0x74,0xd0,0x74,0xd2,0xac,
+  0x7f,0x1c,0x4e,0x93,0x99,0xd7,0xac,0xc6,0xc2,0xb9,0x4a,0xd7,0x83,0x9e,0xbb,0x36,
+  0xcc,0x42,0xa3,0xe6,0x5d,0x64,0x69,0xde,0xa6,0xf7,0x91,0x7d,0x5c,0xb3,0xf4,0xc9,
+  0x6c,0xcb,0x9e,0x1b,0xac,0x5a,0x33,0x93,0xf5,0x18,0x35,0x9d,0x72,0x18,0xd2,0x22,
+  0xcd,0xa7,0xd8,0x31,0xdc,0xbe,0x15,0x6d,0x0d,0xce,0xae,0x5b,0x78,0xb9,0xde,0x65,
+  0x6b,0x56,0xa0,0xa0,0x6f,0x83,0xb7,0xa2,0xd6,0x2f,0x4d,0x9b,0xeb,0x33,0x52,0xa0,
+  0x32,0x6d,0x36,0xf5,0xbc,0x44,0xeb,0x69,0xfd,0x1d,0x92,0x32,0xef,0xbd,0x51,0x7f,
+  0x61,0xe4,0x14,0xa0,0x5d,0x30,0x89,0x53,0x30,0xa7,0x9b,0x05,0x13,0xad,0x4b,0x62,
+  0x95,0x76,0xdf,0xd9,0xa4,0xc2,0xe5,0xce,0x02,0xb7,0x82,0x13,0x2e,0xec,0x57,0xf4,
+  0xbf,0x6f,0x98,0xe1,0xa2,0x1c,0x4b,0xf6,0x2c,0xc1,0x3f,0x7b,0x63,0x16,0xde,0x5b,
+  0xb3,0xb0,0xfe,0x20,0xb3,0x79,0x99,0x48,0xb1,0x20,0xb7,0x24,0xc3,0x5c,0x82,0x52,
+  0x27,0x27,0x5f,0x85,0x51,0x6a,0xfc,0x24,0x8a,0xdf,0x73,0xc3,0xf3,0x4d,0xf1,0x2d,
+  0xc7,0x46,0x2d,0xde,0xa2,0xca,0x33,0x2c,0x58,0x53,0x8d,0xd2,0xf4,0x58,0xb3,0x7c,
+  0x43,0x97,0x4d,0x25,0x2c,0x86,0x61,0xb4,0x2d,0x69,0x0f,0x21,0x64,0x83,0x70,0x58,
+  0xea,0x95,0xd1,0x83,0xe2,0x2f,0x7e,0xc5,0x90,0x9c,0x94,0x15,0x90,0xca,0x30,0x4d,
+  0x08,0xa3,0xb9,0xcc,0x64,0x07,0xa1,0x2f,0x18,0xbd,0xe7,0xf0,0x6c,0x00,0x3f,0xe7,
+  0xf0,0x2e,0x78,0x50,0xbf,0xfe,0xf1,0x3e,0xfb,0x01,0x68,0x8d,0xf0,0x8b,0x9e,0x98,
+  0x7e,0x02,0xb5,0xc2,0x91,0x18,0x20,0xce,0x1a,0x40,0x68,0x29,0x17,0x25,0xe8,0x76,
+  0xfc,0x4e,0x36,0xb2,0x9c,0xea,0x5c,0x0f,0xfc,0xf6,0xb2,0xe0,0x4e,0xe3,0x8e,0x8f,
+  0x4d,0xfd,0x9b,0xd4,0xc4,0x99,0xfa,0xf5,0x57,0x9c,0xb9,0xfa,0x77,0x87,0x60,0x4e,
+  0x8a,0x82,0x7f,0xfd,0x49,0xf2,0x02,0x91,0x1c,0x2c,0x03,0x4f,0xb5,0xbc,0x02,0x3f,
+  0xcf,0x8e,0x49,0x3c,0x5b,0xbd,0x44,0xb2,0x70,0xeb,0xbb,0x9b,0x33,0x2c,0x6d,0x7e,
+  0x02,0x30,0xd2,0xe6,0xef,0x9b,0x16,0x1c,0x2d,0x3e,0x57,0xea,0x36,0x18,0xeb,0xc9,
+  0x8f,0x17,0xe2,0x74,0xa1,0x3e,0x5f,0x64,0x7e,0xf4,0x04,0x82,0xd3,0x86,0x63,0xa0,
+  0x8e,0x4c,0x3a,0x0c,0xec,0xac,0xd8,0xa9,0x1e,0x3c,0x97,0xa9,0x54,0xab,0x00,0xd7,
+  0x68,0xb6,0x70,0x31,0xaa,0x7a,0xd1,0x9f,0x9c,0x57,0xe3,0x8f,0x0e,0xac,0xb3,0x75,
+  0x1f,0x1e,0x59,0xe7,0x23,0x7e,0xc3,0xa9,0x8c,0xe2,0xf5,0xb3,0x44,0x13,0x4b,0x9a,
+  0x49,0x36,0x25,0x6d,0x18,0x11,0x47,0xfb,0x04,0x9d,0x9c,0xcd,0xbf,0xc2,0xc4,0x36,
+  0x04,0x7d,0x98,0x4d,0xfd,0x0f,0x79,0x9e,0xb9,0x52,0x7b,0x17,0x00,0x00,
+};
+
+// MODAL_JS, DASHBOARD_JS: 25673 -> 7159 bytes
+#define ASSET_DASHBOARD_JS_PATH "/assets/dashboard.299843e0.js"
+#define ASSET_DASHBOARD_JS_INDEX 1
+static const uint8_t ASSET_DASHBOARD_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x3d,0xed,0x72,0xdb,0x46,
+  0x92,0xff,0xfd,0x14,0xa3,0xa4,0xa2,0x01,0x2c,0x08,0xa4,0x24,0xcb,0xab,0x90,0x81,
+  0x55,0x96,0x2d,0x9f,0x7d,0xb1,0xad,0x9c,0xa5,0xdc,0xd6,0x95,0xe3,0xda,0x02,0x81,
+  0x21,0x89,0x08,0x04,0xb0,0x00,0x28,0x8a,0x47,0xb1,0x6a,0x9f,0x65,0x9f,0xe0,0xfe,
+  0xdc,0x0b,0xec,0xa3,0xec,0x93,0x5c,0x77,0xcf,0x00,0x18,0x80,0xe0,0x87,0xbc,0xc9,
+  0xdd,0x8f,0x3d,0x57,0x4a,0x04,0xe6,0xa3,0xa7,0xa7,0xa7,0xbf,0x67,0x30,0x79,0x72,
+  0xe7,0xa6,0x6c,0x12,0xfb,0x6e,0xf8,0xca,0x0d,0xc3,0x81,0xeb,0xdd,0x3a,0xd1,0x34,
+  0x0c,0xfb,0x4f,0x86,0xd3,0xc8,0xcb,0x83,0x38,0x62,0xd9,0x38,0x9e,0x7d,0xc0,0x06,
+  0x46,0x9c,0xe4,0x99,0xb9,0x78,0xc2,0x98,0x17,0x47,0x59,0xce,0x26,0x8e,0x1f,0x7b,
+  0xd3,0x89,0x88,0x72,0x7b,0x24,0xf2,0xcb,0x50,0xe0,0xe3,0xc5,0xfc,0x9d,0x6f,0x70,
+  0x02,0xc8,0xcd,0x7e,0xd9,0x36,0x0f,0xf2,0x50,0x6c,0x69,0x7f,0x83,0x6d,0xf4,0x4e,
+  0x83,0xd8,0x9f,0x6f,0xe9,0x73,0x01,0x4d,0xf4,0x2e,0xc3,0x38,0xce,0x45,0xba,0xa5,
+  0xd3,0x1b,0x6a,0x24,0xbb,0xc1,0x7f,0x9d,0x0e,0xbb,0x16,0x39,0x02,0xc8,0xa1,0x1d,
+  0x14,0x10,0xb2,0x76,0x2e,0xee,0xf3,0x57,0xb2,0xcc,0xc1,0x99,0xdb,0x54,0xfc,0xf0,
+  0xc0,0x79,0xbf,0x6c,0x93,0xe5,0x73,0xf8,0xeb,0x07,0x59,0x12,0xba,0x73,0xad,0xd5,
+  0x39,0x1f,0x84,0xb1,0x77,0xcb,0x7b,0x3c,0x8a,0x23,0x41,0x1d,0x70,0x32,0xab,0x30,
+  0x27,0x22,0xcb,0xdc,0x51,0x09,0x55,0x62,0x73,0x31,0x0d,0x42,0x9f,0x0d,0xa6,0x79,
+  0x0e,0x73,0x82,0x22,0x39,0x29,0x3b,0x88,0x22,0x91,0xbe,0xbd,0xf9,0xf0,0xde,0x91,
+  0x8d,0x83,0x21,0xad,0x88,0xad,0x1a,0xd2,0xca,0x30,0xa6,0x17,0xd9,0xc3,0x38,0xbd,
+  0x74,0xbd,0xb1,0x31,0xc8,0x23,0xe7,0x85,0xac,0x2f,0x89,0x5b,0x11,0xc9,0x4b,0x85,
+  0x9b,0x0b,0x45,0x27,0x83,0xcb,0xce,0x92,0x3c,0xf8,0x6f,0x60,0x7b,0xa1,0x9b,0x65,
+  0x1f,0xdd,0x89,0x70,0x24,0x01,0x0f,0x01,0x1e,0x3f,0x40,0xa8,0xb2,0xea,0x9c,0x33,
+  0x7e,0x50,0xbe,0xf5,0xb8,0xde,0x57,0x9f,0x32,0x36,0xc1,0xf7,0xaa,0x36,0x8e,0xbc,
+  0x30,0x00,0x9e,0x2b,0xb8,0xcd,0x30,0x0b,0x2c,0x0b,0x3c,0xbd,0x81,0x53,0x63,0xcf,
+  0xbe,0x5c,0x30,0xf7,0x4e,0x30,0x4f,0x15,0xb1,0x81,0x80,0x89,0x0a,0x36,0x0e,0x7c,
+  0x41,0x9c,0xca,0x90,0x85,0x33,0x16,0xe4,0x25,0xac,0xb2,0xca,0x28,0x51,0x23,0x02,
+  0x22,0x46,0x2e,0x8d,0x6c,0x56,0x8f,0x8d,0x36,0xde,0xc0,0xf4,0x06,0xd4,0xf2,0xce,
+  0x0d,0xa7,0xa2,0xac,0x5c,0x16,0x0f,0x6a,0x7d,0xdc,0x24,0x11,0x91,0xff,0x6a,0x0c,
+  0x8b,0x67,0x0c,0x54,0xab,0x25,0xfd,0x2e,0xe5,0xd2,0xd6,0xc5,0x8c,0x16,0xaa,0x98,
+  0xc2,0xc3,0x83,0x94,0x3a,0x68,0x24,0x89,0xf8,0x3e,0xc8,0x72,0xdb,0xf5,0x81,0x65,
+  0x51,0xfe,0x74,0x5e,0x7d,0x15,0xc6,0x99,0x60,0x20,0x98,0xf1,0x9d,0x48,0x81,0xed,
+  0x18,0x51,0x90,0x21,0x2f,0x00,0xee,0x6e,0x68,0x6a,0xac,0xe1,0x61,0xdb,0xab,0xe8,
+  0x4a,0xb6,0xdc,0x73,0x9c,0xa1,0x1b,0x66,0x42,0xd1,0x78,0xb2,0x4a,0x7d,0xa8,0x82,
+  0xae,0xc0,0xfb,0x6e,0x0a,0x92,0xe3,0x38,0xce,0xc4,0xd4,0x29,0xb7,0xa4,0xb9,0x2c,
+  0x2b,0xdd,0xa0,0x55,0x22,0xcc,0x6d,0xfa,0x40,0x9b,0x5a,0x2a,0x26,0x80,0xbf,0x3e,
+  0xbb,0x36,0x25,0xb4,0xac,0xab,0xa1,0x97,0xa1,0x48,0x73,0x43,0xc9,0x8c,0x55,0xaa,
+  0x23,0x7c,0x20,0x72,0x3e,0x3c,0x2c,0x68,0x51,0x2a,0x95,0x25,0x67,0x4a,0x32,0xd9,
+  0xab,0x0b,0xb1,0x25,0x69,0x20,0x61,0xf5,0x0a,0x98,0x54,0xa8,0xa4,0xa7,0xf7,0x79,
+  0x81,0xcc,0xda,0xe3,0x57,0x3f,0x72,0x4b,0x71,0x76,0x92,0x06,0x13,0x37,0x9d,0x73,
+  0x8b,0x58,0xa1,0x97,0xa7,0x53,0xb1,0xfc,0x22,0x7b,0x15,0x4b,0xd9,0xab,0x2d,0xec,
+  0x13,0xc9,0x03,0x8d,0x89,0x5c,0x4f,0x3d,0x0f,0x46,0x2c,0xa7,0x42,0x58,0xd1,0x5c,
+  0xda,0x51,0x2f,0xb0,0x56,0xfd,0x7e,0x4b,0xe4,0xdb,0x11,0xbc,0x4c,0xd3,0x38,0x7d,
+  0x34,0x7a,0xd4,0xeb,0xf7,0x47,0x0e,0xd4,0xc9,0x30,0x48,0x27,0xbf,0x0d,0x23,0x28,
+  0x60,0x3b,0x61,0xad,0xe4,0x5d,0x22,0xaf,0x96,0x39,0xf2,0x44,0x78,0x03,0xef,0x08,
+  0x8a,0x5e,0x8a,0x19,0x90,0xa8,0x2d,0xad,0x96,0x3e,0x72,0x44,0xd5,0xa9,0x22,0x01,
+  0x55,0xfa,0x6e,0x34,0x12,0xe9,0x39,0x97,0xbf,0xbc,0x9d,0x2e,0x04,0x73,0x23,0xdb,
+  0xa9,0xba,0x9a,0xf8,0x4b,0x8c,0x4a,0x92,0x52,0x0b,0x69,0xfb,0xf2,0x20,0x1a,0x65,
+  0x6c,0x14,0xb3,0x78,0x9a,0x33,0x37,0x03,0xe5,0x22,0xd8,0x4f,0x57,0xd7,0x37,0xac,
+  0xe3,0x26,0x41,0x27,0x2b,0x1a,0x0c,0xdc,0xdc,0x1b,0xdb,0xec,0x3a,0x04,0xa9,0x4f,
+  0x99,0xb8,0x03,0xf1,0xc6,0xb6,0xe1,0xbc,0x00,0x35,0x4d,0x7c,0x30,0x24,0x0c,0xd5,
+  0x60,0x9f,0xb9,0xe0,0x21,0xc4,0xa0,0xc0,0x11,0x58,0x2a,0xfe,0x3c,0x15,0xf0,0x9c,
+  0x40,0xbf,0xa3,0xd3,0x2e,0x9b,0x64,0xcc,0x8d,0x7c,0xaa,0x0a,0x22,0x36,0x0c,0x83,
+  0xd1,0x38,0xb7,0xb0,0xa8,0x80,0x94,0x8f,0x05,0x03,0xa2,0xe4,0x8c,0x66,0xcd,0xdc,
+  0x70,0xe6,0xce,0x33,0x28,0x89,0xfc,0xcc,0x06,0xfb,0x48,0xeb,0xc1,0x32,0x18,0x87,
+  0xa5,0xd8,0x97,0xb9,0x50,0x6f,0x53,0xe7,0x50,0xe4,0x84,0x80,0xb3,0x58,0x5a,0xf8,
+  0x7b,0x13,0x4c,0xc0,0x21,0xe8,0xd2,0xf3,0xc5,0x34,0x9b,0x4b,0x15,0x28,0xb5,0x73,
+  0xc5,0x55,0x22,0x37,0x6e,0xad,0x3b,0x2b,0x8a,0x67,0xe6,0x02,0x5b,0x7e,0xbe,0xfd,
+  0xe2,0x1c,0xdc,0xf5,0x41,0x19,0x52,0x91,0x17,0x0a,0x37,0x45,0x48,0x40,0x20,0xa3,
+  0x84,0x6a,0xf6,0xb5,0x01,0xfa,0xc3,0x70,0x9a,0x8d,0x0d,0x73,0x29,0x00,0x3c,0x2a,
+  0xe0,0xbd,0xaa,0x5d,0xd5,0x0c,0x06,0x2a,0xc0,0x50,0x7b,0x0b,0xa8,0x61,0x2e,0xeb,
+  0xc8,0x28,0x40,0x0b,0x1d,0x38,0xc0,0x2b,0x26,0xf0,0xf0,0xb0,0x77,0x35,0xf8,0x55,
+  0x78,0xb9,0x7d,0x2b,0xe6,0x19,0x15,0x9b,0x76,0x28,0xa2,0x51,0x3e,0x36,0x53,0x91,
+  0x4f,0xd3,0xa8,0x5f,0x37,0xf4,0xe8,0x45,0xd1,0x92,0x28,0xb2,0xf4,0x4b,0x52,0x20,
+  0x33,0x95,0x46,0x4c,0xc0,0xe2,0x1a,0xbc,0xb6,0xe2,0xdc,0x5a,0x4c,0x44,0x3e,0x8e,
+  0xfd,0x1e,0x47,0x76,0xe0,0xd6,0x58,0xb8,0xb0,0xf4,0x59,0x6f,0xc1,0x95,0x49,0x3f,
+  0xbc,0x99,0x27,0x02,0xb8,0x14,0x6c,0x1f,0x58,0x12,0x17,0xf1,0xef,0xfc,0x9a,0x81,
+  0xf7,0xb0,0xb4,0x70,0xdc,0xde,0xbf,0x5e,0x5f,0x7d,0x04,0x2f,0x29,0x05,0x68,0xc1,
+  0x70,0x6e,0x60,0x99,0x69,0x81,0xbf,0xe1,0x43,0xdf,0x00,0x16,0xa2,0xc7,0x33,0x70,
+  0x2b,0x0e,0x63,0x58,0xc5,0x00,0x3a,0x99,0xa5,0xdd,0xb5,0x81,0x03,0x22,0x23,0x75,
+  0x5e,0xa4,0x36,0xc2,0x33,0x4c,0x53,0x96,0xf8,0xe0,0xc7,0xa0,0xdd,0x46,0x6f,0x4a,
+  0x0c,0x87,0x40,0x86,0x3d,0xb2,0x15,0x66,0x46,0x5c,0x99,0x19,0xbe,0xa9,0x43,0xf1,
+  0x90,0x65,0x0d,0x91,0x02,0x20,0xa4,0x46,0x0c,0xde,0xda,0xcc,0x4d,0x23,0x83,0x97,
+  0x5c,0x2f,0x50,0x67,0xf5,0xb8,0x05,0xbf,0xa6,0xd6,0x71,0x18,0x80,0x29,0x0d,0xe7,
+  0x86,0x61,0xc2,0x80,0x0d,0xde,0x81,0xf1,0xd7,0xad,0xc0,0xfe,0xbe,0xb6,0xec,0x05,
+  0x47,0x34,0x17,0xb8,0x42,0x75,0xb1,0xd6,0x62,0x0e,0xee,0xc0,0x5c,0xea,0xbe,0x93,
+  0x6f,0x0f,0x88,0xd5,0x23,0xd0,0x4c,0x07,0xbc,0x73,0xda,0xe5,0xfd,0xb5,0x9d,0xb3,
+  0xd5,0xce,0x59,0x22,0x84,0x7f,0xc0,0xbf,0xd3,0x7a,0x81,0x48,0xa6,0xf3,0x6b,0x11,
+  0xc2,0x44,0x40,0xd7,0xf3,0x20,0x4a,0xa6,0xf9,0xe7,0x38,0xa2,0xdf,0xa7,0xce,0x37,
+  0x17,0xc6,0x37,0x5f,0x00,0x0c,0x09,0x60,0x6d,0xf4,0x9d,0x21,0x5c,0xd7,0x21,0x10,
+  0x0a,0xcb,0x42,0xc2,0x5f,0xb2,0x48,0xcc,0x98,0x5c,0x42,0x36,0x48,0x69,0x2d,0x02,
+  0xd4,0x27,0xb3,0x88,0x55,0x63,0x75,0xa8,0x93,0xc5,0xb2,0x98,0xf9,0x69,0x9c,0x90,
+  0x64,0x43,0x53,0xd4,0x1c,0x59,0x9d,0xa8,0x97,0xe8,0xbc,0xf8,0x80,0x8b,0x52,0x40,
+  0x35,0x84,0xb5,0x62,0x02,0xd8,0x47,0x81,0xe7,0x72,0x70,0x58,0x7a,0x0b,0x05,0xc1,
+  0x5c,0x33,0xaf,0x97,0x61,0x68,0x70,0x7b,0x94,0x06,0x3e,0xb3,0xd1,0xef,0x35,0x2b,
+  0xaf,0x1a,0x58,0x43,0xca,0x58,0xe4,0x24,0x6e,0x9a,0x89,0x77,0xe0,0x3e,0x0f,0x70,
+  0x35,0x5e,0xe6,0xc0,0xf2,0x60,0x36,0xc0,0xc1,0x51,0x3e,0x16,0x74,0x9b,0x10,0x2f,
+  0x76,0x7e,0xf1,0x0f,0x3a,0xe6,0xe7,0xee,0x17,0xb3,0x3f,0xd0,0xfc,0xa1,0x3c,0x1e,
+  0x8d,0x42,0x68,0x8e,0x1e,0xe8,0x9d,0xe0,0x56,0x04,0xce,0x97,0x58,0x65,0x9d,0x0b,
+  0xe3,0xee,0x31,0x4c,0x73,0xa7,0x38,0x85,0xa6,0x5b,0x11,0x04,0x8c,0x49,0x13,0xf0,
+  0xf5,0x46,0xc0,0x59,0x0b,0xe0,0xef,0x14,0x58,0x22,0x68,0x0b,0xc4,0x4f,0x46,0x6a,
+  0x2e,0xa8,0x45,0x1a,0xe7,0xa4,0x19,0xb8,0x95,0xee,0x40,0x69,0x68,0x8d,0xf1,0x45,
+  0x2f,0x8a,0x73,0xc3,0x1e,0x03,0x6d,0xf0,0xcd,0xd4,0xc8,0x6e,0x0c,0xac,0x00,0xa4,
+  0x72,0x13,0xf5,0x02,0xa0,0x1e,0x88,0x73,0x03,0xa3,0x1b,0x23,0x00,0x91,0x53,0x01,
+  0xe9,0xda,0x18,0x31,0x00,0x31,0xb9,0xe1,0xa6,0x35,0xd8,0xd8,0xe2,0x02,0x9c,0x56,
+  0xd0,0x03,0xf9,0xfe,0xfe,0xc0,0x5c,0xe4,0x2d,0xa8,0x78,0x71,0x18,0xba,0x49,0x06,
+  0xa4,0x69,0x5f,0x68,0xbd,0x1e,0x62,0x45,0x37,0xbc,0x06,0x0a,0x80,0xcb,0x61,0x03,
+  0xc9,0xde,0xe5,0x62,0x02,0xa3,0x58,0x3a,0x5c,0x0c,0x4f,0xdd,0x20,0xca,0x6a,0x3d,
+  0xcf,0xf9,0x11,0x28,0xdf,0x2e,0x37,0x97,0x8d,0xa9,0x86,0xf1,0x08,0x6d,0x8c,0xb9,
+  0x28,0xd4,0xba,0x2c,0x00,0x85,0xbe,0x41,0xf9,0x4a,0x0d,0x8b,0x1a,0x6f,0x16,0x44,
+  0x7e,0x3c,0xb3,0x11,0x2f,0x04,0xe7,0xf0,0x0e,0x97,0xde,0xbf,0x6e,0xa6,0x5c,0x5c,
+  0xb3,0xf9,0x27,0x81,0x6b,0x5c,0x86,0x6d,0xba,0x7f,0xc6,0x6f,0x60,0xf9,0xd8,0x2c,
+  0x08,0x43,0x46,0x06,0x94,0xbd,0x7c,0xff,0x9e,0x15,0xb6,0xa5,0xf7,0x4b,0xf4,0x4b,
+  0xf4,0xf7,0xbf,0xfc,0x95,0xfd,0x31,0x78,0x13,0x80,0x2e,0xc8,0x67,0x71,0x7a,0xcb,
+  0xf6,0x59,0x02,0x13,0x86,0x47,0x5f,0x56,0xbe,0x76,0xb3,0xf1,0x20,0x76,0x53,0xbf,
+  0x2c,0x67,0x46,0x8a,0x23,0xb2,0x3c,0xee,0x31,0xd7,0x9f,0x04,0x91,0x29,0x5b,0x5e,
+  0x94,0xdc,0x6d,0x29,0xad,0x02,0x5a,0x43,0x2a,0x8f,0x82,0xff,0x64,0xc3,0x0f,0xff,
+  0x76,0x73,0xc3,0xc8,0x07,0x1b,0x4d,0x53,0x55,0xfe,0x4b,0xf4,0x5a,0xdc,0x05,0x9e,
+  0x90,0xc8,0xa6,0x62,0x00,0x11,0x1d,0x78,0x26,0x79,0x8c,0xe8,0x4e,0x13,0x8c,0x4d,
+  0x84,0x0d,0xc4,0x2b,0xed,0x83,0x74,0x24,0xf9,0x1b,0x49,0x03,0x46,0x44,0xe0,0x96,
+  0x1e,0xba,0x16,0x2e,0x5e,0x8f,0x53,0x25,0xbb,0x04,0x27,0x6c,0x9e,0x8f,0x61,0xea,
+  0x7a,0xbb,0xd2,0x7d,0xec,0x95,0xde,0x63,0x59,0x29,0x5d,0x40,0xf2,0xf8,0xf4,0x1e,
+  0xca,0xdd,0x2b,0x63,0x36,0x35,0x96,0xf0,0xb5,0xd0,0x59,0xc6,0xad,0xad,0x15,0x95,
+  0xa5,0x57,0x0b,0x78,0x98,0x4a,0xe4,0xb7,0x73,0x46,0xbb,0x35,0xae,0xc1,0x5e,0x75,
+  0xb9,0xf5,0x7f,0x8a,0x6a,0xa5,0xed,0x7d,0x85,0x5c,0x81,0xca,0x63,0xa5,0x65,0xe1,
+  0x87,0xf3,0x9b,0x18,0x96,0xa3,0x58,0x2d,0x41,0x4c,0x73,0x64,0x33,0xe0,0xb0,0x08,
+  0xed,0x06,0x2c,0x10,0xb2,0x4f,0x8f,0xf1,0x03,0xd0,0xec,0x19,0x0a,0xe6,0x2f,0xd1,
+  0xb1,0xcd,0xfe,0x25,0x26,0xfe,0x18,0xe7,0x79,0xd2,0xeb,0x74,0x8e,0xbe,0x3f,0xb6,
+  0x8f,0x9e,0x9f,0xd9,0xcf,0xec,0xa3,0x5f,0xa2,0x13,0x9b,0xbd,0x8f,0x61,0x56,0xb0,
+  0xd4,0xf9,0xb8,0xe4,0x2a,0xc5,0x4b,0x08,0xfe,0x13,0xad,0x3e,0x1a,0x19,0x70,0xfd,
+  0x6c,0xdb,0x6e,0xc1,0x6e,0x87,0x30,0x86,0x62,0x17,0xfd,0xdf,0x52,0x4b,0x2a,0xc8,
+  0x77,0xe5,0x9c,0xa0,0xbc,0x55,0xc1,0x2d,0x2f,0x87,0xc7,0xa1,0xcd,0x5a,0xa7,0xe5,
+  0x93,0xe6,0x53,0x01,0xb4,0x29,0x9a,0x13,0x88,0x92,0x21,0x24,0x42,0x5f,0x38,0x73,
+  0x3e,0xb8,0xf9,0xd8,0x1e,0x86,0x31,0x06,0x74,0x59,0xe7,0xa8,0xdb,0xed,0x9a,0xd6,
+  0x44,0x2f,0xcd,0x3a,0xcf,0xa1,0x68,0x5c,0x6b,0x48,0x45,0xbe,0x5e,0x34,0xee,0x1c,
+  0x3f,0x03,0x55,0x05,0x20,0x53,0x4c,0x40,0x01,0x83,0xf9,0x66,0x7a,0xe0,0x00,0xc9,
+  0x7d,0x46,0xaf,0xe3,0xef,0xa0,0x01,0x94,0xc8,0x87,0x03,0x3e,0x96,0xc5,0x93,0xef,
+  0x00,0x14,0x16,0xd3,0xc3,0x01,0x9f,0x40,0x31,0xbe,0x66,0xf2,0x35,0x83,0x37,0xf2,
+  0x5a,0x59,0x2a,0x67,0xa1,0xd2,0x3e,0x71,0x18,0xa7,0x99,0xb3,0x78,0xd6,0xe3,0xdf,
+  0x1e,0x1f,0x7b,0xa7,0xa7,0xa0,0xd5,0x4f,0xe1,0x79,0x78,0xfa,0xbd,0xe8,0x0e,0xb8,
+  0xf5,0x1c,0x9e,0xc5,0xf0,0x19,0xfc,0xe3,0xd6,0x1f,0xf0,0xf9,0xe8,0xc8,0x7f,0x76,
+  0xc6,0xad,0x33,0x78,0xf6,0xbf,0x7f,0xf6,0x5c,0x0c,0xb9,0x75,0xa2,0xb5,0x39,0x86,
+  0x67,0xaf,0x7b,0xfc,0xdc,0x3f,0xe1,0x56,0x17,0x9e,0x4f,0x06,0x67,0xc7,0xc3,0xe7,
+  0xdc,0x3a,0xaa,0x9e,0x97,0x8d,0xa0,0x00,0x3c,0x61,0x63,0x6a,0x2e,0x14,0x76,0x52,
+  0x6a,0xa6,0xbb,0x89,0x09,0xba,0xa8,0x7b,0xa9,0x1d,0xdf,0x9a,0x8b,0x16,0x55,0xda,
+  0xcf,0xc7,0x69,0x3c,0x03,0x1a,0x2e,0x8b,0x99,0x2b,0xa9,0x5a,0x31,0xf7,0x10,0x50,
+  0x81,0x6a,0x45,0x44,0x78,0x27,0x03,0x25,0x96,0x71,0x35,0x06,0xbd,0xe8,0x1c,0xb4,
+  0x28,0xfa,0x82,0x6b,0xf5,0x1e,0x6c,0xa0,0x8a,0xc5,0xb2,0x9e,0x8c,0xe1,0x42,0x2c,
+  0x4a,0xc0,0x1d,0x15,0x19,0xf3,0xc6,0xa8,0x58,0x7c,0x36,0x0c,0x44,0xe8,0x83,0xb6,
+  0x04,0x57,0x15,0x5f,0x49,0xdd,0x79,0xd3,0xd4,0xae,0xa2,0xb9,0x1c,0xdc,0xd8,0xce,
+  0x34,0xf7,0x18,0x48,0x69,0xc4,0x73,0x09,0x00,0xc3,0x36,0x8c,0xcf,0x82,0x14,0x7d,
+  0x35,0x72,0xcd,0xe0,0x6d,0x0e,0x02,0x74,0x87,0x1a,0x8c,0x91,0x31,0x0b,0xb5,0x68,
+  0x0c,0x60,0x62,0x30,0x36,0x70,0x33,0xe1,0x14,0x59,0x2e,0x6d,0x8e,0x34,0x3c,0xfa,
+  0xc2,0xca,0xa7,0x06,0x31,0x0a,0x46,0xa0,0xd6,0xa6,0xa9,0xe5,0x93,0x8d,0xf5,0x6d,
+  0x89,0x89,0x72,0xf4,0x09,0xce,0x62,0x9a,0xf4,0x8a,0x72,0x0b,0x30,0xc4,0x97,0xdc,
+  0xb3,0xdc,0xbc,0xf7,0x1a,0x66,0x6d,0x83,0xe4,0x02,0x35,0xfb,0x44,0x25,0x84,0xa4,
+  0xe0,0x4c,0xfe,0x9c,0xe7,0x26,0xfe,0x41,0x0a,0x15,0xef,0x0d,0x92,0xe7,0xe0,0xac,
+  0x19,0x94,0x06,0xdb,0xc3,0x91,0x8a,0x90,0x4a,0x72,0xa5,0x9f,0x3b,0x15,0xfc,0x43,
+  0xac,0xb7,0xdd,0xbc,0x8f,0x44,0x93,0xa8,0x38,0x54,0x34,0x4d,0x0e,0xfc,0x1c,0x47,
+  0x94,0x6f,0xb9,0xf7,0xa2,0x6b,0x52,0x9b,0xdc,0x73,0x8a,0xa2,0x03,0x4d,0xb2,0xfc,
+  0x5c,0x4a,0xa5,0x86,0x6f,0x03,0xa9,0x04,0x4c,0xbe,0x41,0xde,0x14,0xb8,0x98,0x22,
+  0x05,0x8f,0xda,0x80,0xf5,0xb5,0x8e,0x65,0xaf,0x7a,0xe9,0x07,0x98,0x94,0x75,0x8a,
+  0x35,0x4d,0x9f,0x00,0x27,0x5d,0xda,0x02,0x9c,0xa0,0xe2,0xcd,0x4b,0x8c,0xe4,0xaf,
+  0xe3,0x69,0xea,0x81,0x0b,0x2d,0x87,0x52,0x32,0xb9,0xac,0x45,0x92,0x22,0x73,0xd0,
+  0x67,0xd7,0x9a,0xab,0x78,0x11,0x21,0x57,0x39,0x5f,0x91,0x61,0xe2,0x92,0x5a,0xa1,
+  0xe7,0x22,0x22,0x01,0xb1,0x81,0xe4,0x5e,0x4b,0x38,0x2f,0xe4,0x7a,0x53,0x60,0x48,
+  0x4e,0xb3,0x21,0x6c,0xe0,0x54,0xd7,0xac,0x74,0x5d,0x91,0xe4,0x04,0x16,0x8d,0x53,
+  0x36,0x8a,0x63,0x30,0xfa,0xa7,0xdd,0x93,0x1e,0xe8,0xf4,0x98,0x4d,0xdc,0x68,0xce,
+  0x20,0xa2,0x14,0xee,0x04,0x78,0xf7,0x59,0xf7,0xc8,0xec,0x81,0x2b,0x02,0x56,0x9b,
+  0x32,0xc1,0xc0,0xc2,0x38,0x01,0x50,0x9f,0x15,0x32,0x10,0x2b,0x60,0x8c,0xe7,0x90,
+  0x98,0x60,0x7a,0x33,0xb3,0xa1,0xb7,0x3f,0xbf,0x06,0x94,0x04,0x38,0x8a,0xda,0x7c,
+  0xec,0x57,0xef,0xaf,0xae,0x2f,0x5f,0x97,0x54,0x20,0xf9,0x5b,0x96,0x89,0x5e,0x9d,
+  0xd2,0xc8,0x27,0x96,0x5c,0xb6,0x36,0x15,0x2c,0x97,0xb2,0x32,0xbd,0x6b,0x5d,0xeb,
+  0x69,0xd2,0x70,0xad,0x51,0x79,0x17,0xac,0x5d,0x92,0x64,0x6d,0x77,0x6f,0x7c,0xbb,
+  0x12,0xeb,0x79,0x63,0xe1,0xdd,0x66,0xf5,0x2c,0x40,0x8a,0x73,0x5d,0x0b,0x05,0x6b,
+  0x61,0x01,0xf1,0xa7,0x01,0x0b,0x8b,0xc8,0xd7,0xa7,0x3a,0x6d,0x23,0x00,0x27,0x78,
+  0x08,0x84,0x00,0xd3,0x6b,0xc8,0x66,0x2f,0xbe,0x3f,0x3d,0xe7,0xb8,0x5a,0xe0,0x92,
+  0x0e,0x5c,0xbf,0x62,0x08,0xb5,0x35,0xe3,0x06,0xe1,0x7a,0x0c,0xb0,0x16,0x7a,0xe0,
+  0x4f,0x03,0x03,0x2c,0x82,0x88,0x8d,0x6a,0xd6,0x8e,0x2f,0x1b,0xbd,0xe8,0x9e,0xd3,
+  0xc8,0xfa,0x0e,0xc4,0xda,0x11,0x31,0xbd,0xb4,0x42,0x3a,0x2c,0xbc,0x9a,0xe6,0xe0,
+  0x7a,0x00,0x2c,0xb9,0x12,0x55,0x91,0xd9,0xe3,0x1f,0x8b,0xed,0x9c,0x8d,0xa0,0x41,
+  0xa8,0xa2,0xd6,0x55,0xc5,0x8a,0xda,0xba,0x4a,0xd2,0xfc,0x79,0xea,0x6e,0x20,0x0d,
+  0xd6,0xca,0x68,0x03,0x9f,0xf6,0xf7,0x7d,0x1b,0x7f,0x83,0x7c,0xae,0x14,0xe2,0x02,
+  0x5f,0x1b,0xf3,0x50,0x2d,0xfa,0x54,0xb5,0x96,0x6a,0xaa,0xd5,0x0b,0xe7,0xac,0x5c,
+  0xb9,0xaa,0xf4,0x87,0x33,0x8d,0x9a,0x85,0xf7,0x5f,0x60,0x0c,0xe2,0x99,0xad,0xc7,
+  0x18,0x6b,0x25,0xc6,0xf8,0x84,0x18,0xe3,0x6f,0x81,0x2e,0x3e,0x37,0xc9,0x1e,0x63,
+  0x52,0x03,0xb8,0x8c,0xea,0xd6,0xe2,0x8b,0xb5,0x2f,0x8e,0xb5,0x35,0xae,0x23,0xf5,
+  0x6b,0xb0,0x3e,0xaa,0xe3,0x50,0x29,0x51,0x82,0x07,0xc4,0x08,0x7e,0x40,0x92,0x15,
+  0x4e,0xf0,0xd2,0xc0,0x48,0x56,0x1f,0x70,0x36,0xc9,0x78,0x43,0x92,0xc0,0x3e,0x6d,
+  0x90,0x24,0xa8,0x45,0x49,0x82,0x9f,0xa6,0x24,0x41,0x11,0xc0,0xf3,0x2f,0x26,0x5c,
+  0x56,0xaf,0x17,0x26,0xa8,0x7d,0x71,0xf8,0xbc,0x5b,0x4a,0x53,0x53,0x94,0x46,0xb3,
+  0xf5,0x08,0x8c,0x66,0x72,0x9a,0xa3,0x19,0xce,0x72,0x04,0x72,0x39,0x73,0x4b,0x4e,
+  0x19,0xcd,0x1a,0x48,0xa9,0xfa,0x73,0x70,0x61,0x99,0x81,0x4e,0xb4,0x2a,0xf8,0x94,
+  0xe7,0x34,0x77,0x93,0x23,0xcf,0x83,0x0b,0x9e,0x84,0x73,0xde,0x87,0xee,0x6b,0x91,
+  0x2e,0x21,0xd5,0x34,0x40,0x7d,0x81,0xfc,0x70,0xc3,0x9e,0x31,0x54,0x4a,0xcc,0xe1,
+  0x01,0x51,0x47,0x59,0xf9,0x30,0x48,0x0a,0xb6,0x81,0xd2,0x06,0xee,0x79,0x32,0xcd,
+  0x3f,0x4d,0xa3,0x08,0x94,0xfd,0x39,0xbf,0x11,0x59,0xe1,0x34,0xf7,0xaa,0xbe,0x30,
+  0x07,0xfc,0x69,0xac,0xe0,0x74,0x13,0x1a,0xd3,0x02,0x8d,0xa9,0x44,0x63,0x9a,0x68,
+  0x48,0x4c,0x1f,0x83,0x84,0xec,0xd9,0x8e,0x82,0x17,0xde,0xae,0x47,0x01,0x2a,0x25,
+  0x0a,0xf0,0x40,0x28,0xe4,0x5e,0xb1,0x80,0x50,0xd2,0x40,0x80,0xdc,0x8b,0x73,0xb4,
+  0xcb,0xe8,0x99,0x18,0x54,0xf0,0x94,0xec,0x92,0x9d,0xc7,0xef,0xd1,0x17,0x13,0xd7,
+  0x94,0x7f,0x35,0x48,0x7d,0x41,0x40,0x30,0x07,0x2f,0xcd,0xe7,0x7d,0x04,0xb5,0x76,
+  0x35,0x3d,0xdc,0xbe,0x76,0x1c,0x3e,0x8e,0x43,0x1f,0xf7,0x19,0xf9,0x5a,0xa1,0xf3,
+  0xa3,0x0d,0x8a,0x00,0x2a,0xd5,0x9a,0x46,0xa4,0x06,0xe0,0xa7,0x98,0x09,0x3c,0x36,
+  0x66,0x02,0x25,0xc8,0x87,0x92,0xe3,0xdc,0x28,0x9b,0xc1,0xb0,0x7d,0x6c,0xb6,0x16,
+  0x4b,0xea,0xd1,0xca,0x6f,0x6b,0x31,0x1a,0x0b,0xb7,0x69,0x70,0x75,0x4f,0xcc,0xc6,
+  0x7a,0xf0,0xc6,0x28,0x80,0x61,0x3f,0x5e,0x34,0x96,0x0d,0x42,0x44,0x6c,0xb0,0xe1,
+  0x7c,0x81,0x6c,0x20,0x27,0xad,0x5e,0x70,0xe2,0xf0,0xf8,0x16,0x1e,0xd5,0xe4,0x55,
+  0xc5,0x7a,0x2c,0x54,0xf3,0x36,0x44,0xd6,0x0e,0x9d,0x8b,0x49,0xb2,0x62,0xcf,0xb0,
+  0xf0,0x80,0xff,0xed,0xbf,0x5e,0x35,0xf9,0xcf,0x91,0x01,0xd6,0x67,0x08,0x9b,0xd1,
+  0x0d,0xfa,0xf2,0xf0,0x50,0xc6,0x41,0x3b,0x98,0x37,0x34,0x9c,0xf2,0xec,0x03,0x7a,
+  0x5d,0xa3,0x34,0x9e,0x46,0xbe,0xe3,0xf5,0x77,0xeb,0x11,0xdf,0x5f,0x8f,0x5d,0x90,
+  0x50,0x87,0x77,0x59,0x97,0x9d,0x25,0xf7,0xb0,0x98,0xde,0xd6,0x41,0xb3,0xfc,0xbe,
+  0x82,0x41,0xc8,0x6f,0x1a,0x50,0xb5,0x6e,0xe4,0xc0,0x71,0xa6,0x37,0xda,0xf9,0x03,
+  0x70,0x34,0x7f,0x12,0x29,0x38,0x99,0x13,0x8a,0x5c,0xc8,0x67,0x63,0x06,0x25,0x06,
+  0x70,0x9d,0x98,0x74,0xa4,0xcc,0xba,0x1b,0x93,0x6c,0xe0,0x77,0xa8,0x94,0x4b,0x0f,
+  0x0f,0x64,0xf6,0x84,0xff,0xa6,0x54,0x1e,0x0b,0x28,0x6c,0xda,0x3d,0xaa,0x07,0x41,
+  0x7d,0x13,0xdc,0x0b,0xdf,0x38,0x02,0x07,0x28,0xd9,0x64,0xff,0xa8,0xf9,0x8b,0x53,
+  0xdd,0x5a,0xab,0xb2,0x13,0xb0,0x16,0x85,0x14,0x34,0x45,0x74,0x98,0x02,0xac,0xe9,
+  0x26,0xb4,0x65,0x03,0x85,0xba,0x7c,0x29,0xd0,0xc7,0xb7,0x9f,0x8b,0x29,0xa8,0xba,
+  0x96,0x59,0xc8,0x66,0xc0,0xaa,0x7f,0xfb,0xef,0xa6,0xae,0xcb,0x48,0x97,0xac,0x5f,
+  0x2a,0x3a,0x29,0x43,0x43,0xd3,0x23,0x0e,0x4c,0x2b,0x05,0xca,0xeb,0xf6,0x83,0x7b,
+  0xff,0x31,0x2b,0x77,0x78,0xa0,0xa0,0x6d,0x49,0xcb,0x86,0x30,0x7c,0xb4,0xa2,0x69,
+  0x93,0xe9,0x06,0x4d,0x9b,0x4c,0x95,0xa6,0x4d,0xa6,0x38,0x6e,0xf5,0x03,0x2c,0x96,
+  0x8a,0xcc,0xc4,0xa7,0x86,0x73,0x5d,0xd4,0x7d,0xee,0x7e,0xb1,0xdd,0xbb,0x11,0xb8,
+  0x2d,0xac,0x43,0xf9,0xa7,0xaa,0xe6,0xa8,0xa8,0x69,0xe0,0x82,0xf9,0xa8,0xd0,0xdd,
+  0xe0,0xa4,0xa8,0x06,0x12,0x27,0xf5,0x82,0x08,0xe1,0x63,0xf1,0x6b,0xab,0xcd,0xd4,
+  0xcc,0x54,0x0d,0x1a,0x08,0x52,0x9b,0xe4,0xb4,0xfb,0x01,0xc9,0x21,0x31,0x93,0x45,
+  0xdf,0x9f,0x52,0xd1,0x8a,0x43,0x33,0x71,0xef,0x87,0x1b,0x34,0x1a,0xd4,0xea,0xec,
+  0x81,0xef,0x8a,0x37,0x80,0xe6,0x75,0xf6,0x58,0x60,0xe5,0x2a,0x73,0x54,0xed,0x0a,
+  0xfe,0xa0,0x76,0x9b,0xd8,0xbc,0xea,0xf2,0x03,0xda,0xb2,0x6e,0x9d,0xe1,0xf5,0xda,
+  0xe7,0x54,0xbb,0x8e,0xf5,0xa1,0x31,0xc0,0xde,0xc4,0x7e,0x45,0x0b,0xe5,0xaf,0xaa,
+  0x37,0x35,0xc3,0x6b,0x7c,0x56,0x93,0x2b,0xaa,0x56,0xe7,0x47,0xad,0x60,0x6a,0x83,
+  0x79,0x2e,0x9a,0xc4,0x8d,0x44,0xbe,0x05,0x81,0xa2,0x85,0x44,0xa0,0x78,0x43,0x04,
+  0xe0,0x59,0x47,0xa0,0xa8,0x6a,0x20,0x50,0xb4,0x5a,0x41,0x60,0x13,0xd7,0x0f,0x81,
+  0x89,0x56,0xe3,0xc6,0x64,0xfa,0x06,0xca,0xd1,0x63,0x79,0xfb,0x9f,0x5c,0x0f,0x6b,
+  0x41,0x51,0x56,0xf9,0x6b,0xda,0x9c,0x4f,0x20,0x1e,0xa2,0x5c,0x6f,0x06,0x13,0x9d,
+  0x88,0x0c,0x94,0x4c,0x3c,0x91,0xb9,0x26,0xbf,0xcc,0xd9,0xcb,0x34,0x15,0x3b,0x28,
+  0x93,0xfe,0x56,0x01,0x4d,0xed,0xfb,0x85,0x41,0x96,0x5b,0xcc,0x97,0xb9,0xf7,0x20,
+  0x1a,0xc6,0x96,0x9e,0x9e,0x37,0xfb,0x34,0x14,0x1e,0x79,0xc3,0xad,0x41,0x11,0x0e,
+  0x59,0x90,0x91,0x96,0x0e,0xbc,0x46,0xd2,0x26,0x1e,0xe1,0x7e,0x49,0x1c,0xad,0xdf,
+  0xc3,0x0a,0xfc,0x62,0x27,0x32,0x8e,0x8a,0x6d,0x93,0xfe,0xc6,0x1d,0x9e,0x51,0x9b,
+  0x91,0xc3,0xce,0xdf,0x3e,0x3b,0x39,0x39,0xf3,0x5c,0x8e,0xa9,0xc3,0xee,0x49,0xf7,
+  0xd9,0xd9,0x66,0x40,0x3f,0x46,0xf1,0xa0,0x04,0x15,0x8a,0x61,0x4e,0x40,0x8e,0x8f,
+  0x93,0x7b,0x80,0x80,0x7f,0x9b,0x19,0xa8,0xfb,0x1c,0x27,0x73,0xb7,0x79,0x2e,0xb5,
+  0xdd,0xb8,0x06,0x84,0x54,0x44,0xbe,0x48,0xb5,0xec,0x83,0x52,0xc4,0xa8,0x30,0xd5,
+  0x4a,0x6c,0x65,0x92,0xe1,0x3d,0xe0,0x5c,0x1d,0x39,0xf4,0xd5,0x6e,0x3b,0xed,0x45,
+  0x4d,0xdc,0xc4,0x30,0x22,0xda,0x85,0xe3,0x3f,0xc8,0x64,0x38,0x23,0x69,0x76,0xbe,
+  0x91,0x27,0x03,0x03,0x92,0x48,0x16,0x0f,0x87,0xdc,0x84,0x37,0xc7,0x71,0x32,0xd5,
+  0xff,0x9c,0x33,0xb5,0x49,0x87,0xbe,0xe4,0x01,0xff,0x86,0x15,0x87,0xd0,0xbe,0xb9,
+  0x84,0x00,0x04,0x22,0x24,0xf3,0x9b,0x17,0xfc,0x20,0x3a,0xe0,0x3f,0x74,0x24,0xe4,
+  0x17,0x80,0xc7,0xaf,0x71,0x10,0x19,0x5a,0x18,0x84,0x24,0xc2,0xdd,0x4e,0x2b,0x5b,
+  0xd9,0x15,0x37,0xbf,0x6e,0x83,0x5b,0x07,0x54,0x1b,0x25,0xa3,0x51,0xca,0xed,0x73,
+  0xf3,0xeb,0x76,0xbf,0x15,0x84,0x15,0xaa,0xff,0x8e,0xfb,0x9f,0x99,0x5d,0xec,0x7b,
+  0x99,0x8d,0xf0,0xf1,0x0e,0x9d,0x6d,0x92,0xb9,0xfa,0x4c,0xb3,0x00,0xf7,0x71,0x69,
+  0x1f,0xc5,0xec,0x53,0x51,0x90,0x60,0x41,0x90,0xa8,0xd7,0x89,0xeb,0xe1,0x3b,0xfc,
+  0xa8,0x02,0x4c,0x25,0x63,0x09,0xfe,0x46,0x22,0xac,0xaf,0xcf,0x10,0xd0,0x1b,0x63,
+  0x2d,0x3d,0x7c,0x18,0xa0,0x5e,0xc1,0x6d,0x53,0x39,0xd8,0x2d,0xe6,0xd3,0x69,0x38,
+  0x7a,0xfa,0x71,0x20,0xdd,0x5c,0x55,0x3d,0x9c,0x71,0x8b,0xdf,0xa1,0xed,0x02,0xb5,
+  0x93,0xe1,0x1c,0x1a,0x36,0xcb,0x91,0xd9,0xdb,0xad,0x6c,0x8c,0x8d,0x2e,0xd2,0xf8,
+  0x16,0xcf,0xfb,0xaa,0xb5,0x98,0xc0,0x52,0x63,0xc1,0x4e,0x7d,0x7f,0x8a,0xd3,0x5c,
+  0xeb,0x99,0xc0,0xeb,0x4e,0xfd,0x7e,0xce,0x6a,0x23,0x4e,0xe1,0x35,0x02,0x8b,0xb5,
+  0xdb,0x98,0x2e,0xa6,0x4f,0x6c,0xb0,0xed,0x9e,0xc0,0x00,0x4c,0xa4,0x00,0x61,0xec,
+  0x66,0x3f,0xa9,0xcd,0xaa,0x73,0xfe,0xf7,0xbf,0xfc,0xb5,0xf5,0x3f,0x10,0xaa,0xea,
+  0x1c,0x28,0xdf,0x69,0xb0,0x9b,0x38,0x09,0x3c,0x0d,0xd3,0x1c,0xdf,0x77,0xea,0xf9,
+  0x2e,0xd2,0x29,0x13,0xa8,0xc4,0x68,0x8d,0x05,0x68,0x36,0xd3,0x81,0x1c,0xc3,0x52,
+  0xc0,0x0f,0xe4,0x5e,0x86,0x96,0x31,0x46,0xf5,0x4d,0x6d,0x2f,0x23,0x6c,0x25,0x22,
+  0x77,0x00,0x66,0x15,0x58,0xa1,0x28,0x7f,0xfb,0x12,0xcb,0xc7,0xee,0x9f,0xfc,0x20,
+  0xf3,0x30,0x1e,0x9d,0x37,0xf8,0x21,0xdb,0xe0,0x54,0x21,0x00,0xcc,0xf5,0x92,0x07,
+  0x93,0xd5,0xdd,0xa5,0x09,0x79,0x90,0xd3,0x0c,0xcb,0xf5,0xd0,0x62,0x82,0xfb,0xed,
+  0xb8,0xc5,0x28,0x80,0xda,0xc5,0x06,0x54,0xcf,0x28,0x71,0x3b,0x2f,0x77,0xa2,0xc0,
+  0x08,0xfc,0xa1,0xfb,0x87,0xee,0xd9,0x59,0x35,0x1d,0x39,0x20,0x78,0x82,0x57,0xb4,
+  0x31,0xa4,0x1f,0x3a,0x06,0xd3,0xf7,0x6e,0xc8,0xdc,0x90,0x12,0xd0,0xac,0x1c,0xc3,
+  0x62,0x39,0x1e,0x8f,0x03,0xeb,0x16,0x4c,0xf0,0x20,0x55,0x90,0x87,0x73,0xda,0x9b,
+  0x14,0xbe,0x06,0x13,0xd3,0x0b,0x3f,0x51,0xa1,0x8e,0x9f,0x3e,0xea,0xcf,0xb4,0xe9,
+  0xf3,0xf3,0xbb,0x6a,0xc0,0x22,0x0f,0xdd,0xb0,0xe6,0x9f,0x00,0x14,0x1e,0x99,0x2e,
+  0xcf,0x12,0x50,0x43,0x21,0xad,0xb8,0x7e,0x1c,0x81,0x19,0x52,0x6f,0x67,0x60,0xa5,
+  0x87,0xee,0x34,0xc4,0x13,0x3a,0x89,0xc0,0x6d,0x9f,0x79,0xd6,0xf1,0x03,0x77,0x54,
+  0x94,0x57,0xa0,0x64,0xbc,0xf4,0x59,0x1d,0xaf,0xc9,0xf8,0x97,0x52,0x73,0x05,0xea,
+  0xf4,0x56,0xed,0xbc,0xc3,0xa8,0x3c,0xef,0x60,0x82,0xd6,0x02,0xcb,0xfc,0xbb,0x1f,
+  0xd1,0xa0,0x63,0xd5,0xeb,0xce,0x67,0x34,0x2b,0x97,0xcb,0x62,0x93,0xf5,0x33,0x87,
+  0x39,0x83,0x5a,0xc2,0x59,0xc3,0x0f,0xd2,0xfb,0x91,0x73,0xeb,0xfe,0xfe,0x73,0x2b,
+  0xce,0x55,0xaf,0x9b,0x5e,0x4b,0x7d,0x35,0x43,0xb9,0xd1,0x58,0xf3,0xe1,0xb8,0xb6,
+  0xd3,0x5f,0xba,0x15,0x7d,0xb9,0x95,0xb4,0x6c,0x6c,0x40,0x4a,0x20,0x05,0x8b,0xbd,
+  0x0d,0x32,0x3a,0x1b,0x31,0x4a,0xdd,0x64,0xdc,0x63,0x03,0x37,0xa5,0xe3,0x9f,0x09,
+  0x98,0xf2,0x9c,0x19,0xa3,0x54,0x88,0x88,0x39,0x0c,0x77,0x6e,0x24,0xa3,0x5b,0xcc,
+  0x9d,0x0c,0xa0,0x81,0xc3,0x32,0x70,0x28,0x99,0xcc,0xe8,0x97,0x0e,0x63,0x0a,0x2c,
+  0xea,0xd0,0x81,0x52,0x90,0x0c,0x59,0x67,0x5a,0xe0,0x3f,0x46,0x02,0x8b,0x85,0x1b,
+  0xc9,0x60,0x9d,0x61,0x76,0xbd,0xdc,0x79,0x44,0xeb,0xf9,0x09,0x37,0x3b,0x9d,0x13,
+  0x08,0x13,0x1a,0xfb,0x8e,0x6f,0xf1,0x7c,0x12,0xd0,0x30,0x35,0xab,0x66,0xe9,0xc6,
+  0x93,0x49,0x85,0x31,0xae,0x1f,0x01,0xdb,0x64,0x87,0x0f,0x06,0xb4,0xb7,0x05,0x4e,
+  0x97,0x9d,0x02,0x03,0x94,0x03,0x55,0x16,0xb9,0x38,0x8c,0x31,0x96,0xd4,0x3a,0x4f,
+  0x09,0x0f,0x7e,0x50,0x36,0xfd,0xba,0x73,0x19,0xa9,0x3b,0x43,0xfa,0xb7,0xee,0x10,
+  0x97,0x14,0x28,0x5a,0x19,0xe5,0xa9,0x28,0x6f,0x43,0x68,0x1a,0x64,0x2a,0x2e,0xdd,
+  0xf3,0x5a,0xcf,0x99,0xce,0x1c,0xcf,0x9e,0x05,0x7e,0x3e,0x86,0x5f,0xf0,0xe8,0xa0,
+  0xe3,0x1f,0xf1,0xed,0xe9,0xb1,0x85,0x25,0x63,0x81,0xde,0x55,0x59,0xf5,0x96,0x5e,
+  0xa1,0xee,0x1e,0x8a,0x60,0x28,0xd2,0xc7,0x68,0x31,0x8e,0x57,0xf6,0x8d,0xf2,0x2e,
+  0x06,0x39,0xf1,0xec,0x10,0x77,0x99,0x90,0x20,0x83,0x99,0x4c,0x96,0x41,0x10,0x69,
+  0x1c,0x5b,0xb3,0xa7,0x98,0x05,0x10,0x49,0x47,0x55,0x1f,0x1e,0xc9,0x43,0x0a,0xc0,
+  0x58,0x4e,0xd7,0x82,0xa0,0x10,0xfe,0xa6,0x19,0xfe,0x89,0xe0,0xcf,0xe4,0xde,0x39,
+  0x2a,0x8d,0x9b,0x4d,0xbc,0x58,0x7d,0x25,0x93,0x00,0x91,0xa0,0xdb,0x81,0x93,0x40,
+  0x04,0xdf,0x87,0xae,0xf8,0x74,0xfc,0xa5,0x9f,0x66,0xf8,0x70,0xf2,0xe5,0xa9,0x81,
+  0x15,0x87,0x58,0x66,0xf6,0xd3,0x48,0xb6,0xa3,0x57,0x3a,0x9f,0xfb,0xf9,0xd9,0x97,
+  0x17,0x93,0x7b,0x13,0x86,0xc0,0xc7,0xea,0xbc,0x47,0xeb,0x38,0x74,0x40,0x18,0xba,
+  0xd7,0xf7,0x97,0x87,0x34,0x60,0x87,0xc6,0xbf,0xb7,0x87,0x41,0x08,0x9a,0x04,0x8c,
+  0x92,0x33,0x04,0xe6,0xe9,0x96,0x86,0xe8,0xf4,0x14,0x4c,0xd1,0xf0,0x07,0xfb,0xb4,
+  0xb4,0x42,0x83,0x2e,0x2f,0xcf,0x3a,0xf8,0xe8,0x03,0xcb,0xce,0x9f,0x80,0x79,0x0d,
+  0x40,0xac,0xfb,0xe5,0x30,0xef,0x9a,0x05,0x85,0x9e,0xce,0x2c,0x20,0xcc,0xcc,0x1a,
+  0x9b,0x15,0x8e,0xf7,0x78,0x48,0x17,0x9c,0x22,0x39,0x1c,0xff,0xf6,0xec,0xe8,0xcc,
+  0x1b,0x42,0x5c,0x73,0x6f,0xa3,0x88,0xd1,0x42,0x3a,0xc7,0xf0,0x36,0x10,0xc0,0x78,
+  0x3f,0x01,0xf5,0x0d,0x49,0xe5,0x61,0x90,0x82,0xe9,0xd5,0xcf,0x11,0xaf,0x9b,0x2d,
+  0xce,0xe9,0x07,0x9a,0x5e,0x7d,0xca,0xc9,0xbd,0xd3,0x82,0xe1,0xc1,0x60,0xd6,0x39,
+  0xb6,0x92,0xb9,0x33,0x3e,0x7c,0x76,0x68,0x20,0xf1,0x3b,0x40,0xda,0xa7,0xc6,0xf8,
+  0xf0,0x4c,0x26,0xa9,0x70,0x5c,0x73,0x71,0x6f,0xa3,0x36,0xbb,0x89,0x8d,0xe4,0x1e,
+  0x1a,0x9b,0x7d,0x89,0x8e,0x3c,0x79,0x4f,0xe7,0xb0,0x25,0xfe,0x65,0x83,0x25,0x52,
+  0x46,0xce,0xd4,0xd8,0xbe,0x43,0x88,0x2c,0xff,0x0e,0x82,0xd2,0x46,0xa0,0x0c,0x2c,
+  0x72,0x6e,0x18,0x47,0xdd,0xee,0x53,0x03,0x1e,0x0f,0x81,0x4f,0xcc,0x0e,0x3c,0x98,
+  0x65,0x1a,0xef,0xd8,0xc4,0xa4,0xd0,0x34,0x61,0x78,0xdc,0x8c,0xcb,0x9d,0x7e,0x8a,
+  0x1e,0x8d,0x34,0xeb,0x94,0xac,0x9b,0x46,0xd6,0x91,0x69,0x52,0x42,0x86,0xb9,0x77,
+  0x10,0x6c,0x52,0xde,0x1b,0xd5,0x05,0x9b,0x8b,0x5c,0x05,0x85,0xfa,0x8e,0xf3,0x5b,
+  0x0b,0x73,0x1d,0x5d,0xb3,0xff,0xd6,0x68,0xa8,0x5a,0x8a,0x99,0x69,0x3b,0xbb,0x54,
+  0x7d,0x0d,0x7f,0x41,0x3b,0xf4,0x5e,0xd4,0x16,0xce,0x09,0x9d,0xd6,0x1b,0x39,0x8b,
+  0x65,0x1d,0x26,0x39,0x30,0x2c,0x56,0x8d,0x54,0x44,0x8e,0x47,0x3f,0x28,0xf2,0x0f,
+  0x63,0xd7,0x6f,0x1c,0xe3,0x58,0x75,0x7a,0x16,0x9a,0x67,0xd2,0x1c,0xad,0x3c,0xca,
+  0x24,0x7d,0xf1,0xde,0x23,0x1c,0xf8,0xea,0x3c,0x16,0x7a,0xe3,0xbd,0x9d,0xdd,0xf7,
+  0xaa,0x1f,0x7a,0xe3,0xbd,0x9d,0xdd,0xf7,0xaa,0x1f,0xb9,0xaf,0xbd,0xdd,0xdd,0xe9,
+  0xaa,0x67,0xe1,0x1d,0xf7,0x76,0xf5,0xa8,0xab,0xae,0x63,0x77,0x73,0x27,0xf0,0x8d,
+  0x55,0x9f,0xfa,0x77,0x69,0xcb,0xda,0x72,0xbe,0x22,0xeb,0x18,0x0c,0xd9,0xab,0xab,
+  0x8f,0x1f,0x2f,0x5f,0xdd,0xbc,0xbb,0xfa,0x58,0x66,0x65,0xca,0x13,0x41,0x06,0xa6,
+  0x16,0x83,0x14,0xbf,0xd7,0x38,0x44,0x87,0xd4,0x5c,0x5d,0x62,0x75,0xf2,0x0e,0x5e,
+  0x5f,0xc9,0x4e,0x46,0x23,0xc9,0xe0,0x39,0xab,0xcb,0x5d,0x48,0x9a,0x3a,0xee,0xe4,
+  0xa9,0x00,0x6c,0xcf,0x71,0x1e,0xb1,0xec,0x0f,0x0f,0xf5,0x13,0x75,0x1e,0x05,0x63,
+  0xdb,0x60,0xe8,0x0c,0xb0,0x0a,0x01,0x19,0x61,0x1b,0x04,0x9d,0x15,0x34,0x37,0xfe,
+  0x63,0x9c,0x8b,0x5e,0x75,0x2a,0x15,0xa2,0x75,0x96,0xa7,0xae,0x77,0x8b,0x64,0xc4,
+  0xbc,0x58,0x84,0x1f,0xd2,0xac,0x8b,0xd3,0xcc,0x4d,0x2b,0xf4,0xf2,0xe3,0x7f,0xb4,
+  0x2c,0x0d,0x1e,0x85,0xc9,0xf0,0xab,0x47,0x99,0x15,0x69,0x59,0x9a,0x97,0xd1,0xfc,
+  0x9f,0x71,0x4d,0x56,0x21,0x90,0x98,0x6e,0x03,0x51,0x13,0xd4,0x55,0x18,0x85,0xc0,
+  0x6e,0x03,0xa3,0x89,0xec,0x2a,0x90,0xb1,0xbb,0xad,0x7b,0x25,0xbc,0xcd,0xde,0xbb,
+  0x64,0x08,0xa8,0xa3,0xfa,0xf2,0xe4,0x45,0xb7,0x8f,0x5c,0x54,0x32,0xa4,0xc0,0x09,
+  0xa8,0xf0,0xb1,0xce,0x68,0x6f,0x45,0x88,0x8e,0x38,0x1e,0x6e,0x46,0x6b,0xaf,0x18,
+  0x0a,0xd9,0x55,0x05,0xb7,0x10,0xd7,0x65,0xf4,0xb0,0xf2,0x91,0xd4,0x45,0x1e,0x91,
+  0x99,0xc1,0xaf,0x61,0xad,0x22,0x4c,0xd7,0x4f,0x94,0x61,0xaa,0xaa,0xee,0x1c,0xe2,
+  0x77,0xb3,0x05,0x3c,0x67,0x4f,0xf5,0xe9,0x57,0x5d,0x9a,0x50,0x64,0x0f,0x19,0x8b,
+  0xc7,0x89,0x0b,0xa1,0xf0,0x1c,0x83,0xc2,0x7e,0x4b,0xb5,0x37,0x4d,0x33,0x88,0xd5,
+  0x39,0x39,0x1c,0xb8,0x59,0x5c,0x28,0x40,0x34,0xfd,0x1b,0xe1,0x75,0xed,0x93,0xd3,
+  0x8d,0x20,0x41,0x9c,0x0f,0xc1,0xa6,0xc7,0x33,0xdc,0x29,0x7f,0xa2,0x1f,0xba,0xad,
+  0xd3,0x52,0x06,0xdc,0x8a,0x84,0x1d,0xe9,0xfe,0xcb,0x50,0x3a,0x5b,0x15,0xd0,0x2a,
+  0x3a,0x6f,0x7c,0x8a,0x4d,0x32,0xf5,0x18,0xb9,0xb3,0xf3,0x34,0x98,0x18,0x0d,0x47,
+  0x79,0xec,0x66,0xb2,0x95,0x23,0x01,0x56,0x8c,0x51,0x6b,0x16,0x64,0x97,0x92,0xe4,
+  0x9b,0x07,0xbc,0x8c,0xca,0xe4,0x8e,0xa3,0x2f,0x40,0x39,0x96,0xb2,0xe4,0xab,0x9a,
+  0x45,0x69,0x92,0xfd,0xfd,0xb5,0x55,0x6b,0x30,0xc3,0x94,0x86,0xd2,0x60,0xce,0x1a,
+  0x5b,0x53,0x74,0xa8,0xf4,0x30,0x3a,0x39,0xbd,0x82,0x73,0x51,0x7d,0xca,0x21,0x6a,
+  0xfc,0xcf,0x6a,0xbc,0xbb,0x59,0x2d,0x00,0xb8,0x0b,0x0c,0xf1,0xac,0x92,0x9c,0x2d,
+  0x83,0xe2,0xe7,0xe7,0xb5,0x41,0x29,0x7d,0x53,0xc4,0xb1,0x57,0x9f,0xb0,0x08,0x95,
+  0xb5,0x5f,0xf8,0x4d,0xe2,0x1e,0x7c,0xc9,0xe2,0xa3,0x47,0x88,0x60,0xa3,0x38,0x3a,
+  0xf4,0xca,0xe9,0xad,0xa8,0xfb,0x3a,0x59,0xdc,0x08,0xc7,0x73,0xea,0x2e,0xdd,0xc3,
+  0x83,0x51,0x2e,0xc2,0xfe,0xfe,0x9e,0x46,0x3b,0x49,0x78,0xdd,0x1a,0x98,0xfd,0xc7,
+  0x92,0x01,0x07,0x94,0x64,0x50,0xa3,0xb7,0x10,0x81,0xbe,0x6b,0xa8,0x51,0xa1,0x65,
+  0xca,0x8f,0x1d,0x98,0x80,0x96,0x0b,0xf0,0x4a,0xed,0x03,0xad,0x8c,0x2d,0x59,0x98,
+  0x49,0x81,0xeb,0x21,0x89,0x18,0x99,0xb1,0xab,0x37,0x6f,0x80,0xc8,0x73,0x3a,0x16,
+  0x4c,0xa5,0x44,0x6d,0x59,0xf5,0x11,0x51,0xbc,0x7e,0xf9,0xef,0x97,0xaf,0x5b,0x51,
+  0x54,0xd1,0x26,0x41,0xdc,0x26,0x1a,0x37,0xd4,0x6a,0x25,0x52,0xa5,0xd2,0x8b,0xd1,
+  0xb6,0xde,0xb8,0xb3,0xa4,0x69,0x40,0xd9,0x6d,0xf5,0xe2,0x03,0x57,0x0d,0xe3,0x94,
+  0x12,0xfb,0xf0,0x50,0xd2,0xa4,0xaf,0x39,0xa5,0xd8,0xa8,0xa1,0xe1,0xca,0xce,0x6a,
+  0xab,0xcb,0x3e,0xe1,0x6b,0x7a,0x28,0xe5,0x49,0x87,0x60,0x33,0xbd,0x9f,0x3b,0xcd,
+  0x63,0xfd,0x02,0x8b,0x92,0xf6,0xaf,0x83,0x09,0xab,0x76,0xc4,0xd8,0x6c,0x2c,0x22,
+  0x56,0x68,0x78,0xe2,0x70,0x58,0x04,0x0b,0xfc,0x0a,0x99,0x61,0xa4,0x6a,0xc5,0x23,
+  0xfa,0xad,0x0a,0x05,0xb1,0x9a,0x5f,0xad,0xec,0x95,0x28,0x34,0x3e,0x5b,0x29,0x3a,
+  0xac,0xee,0xc9,0xf1,0x6f,0x8f,0xdc,0x23,0xf7,0x58,0x47,0x53,0x19,0x01,0x02,0x58,
+  0x92,0xef,0x11,0x00,0x8b,0x7d,0xbd,0xd6,0xaf,0x2f,0x8a,0x34,0xae,0x9a,0x95,0x05,
+  0x21,0x15,0x3a,0x66,0x01,0x7e,0x3b,0x7d,0x18,0x64,0xcc,0x48,0xa6,0x69,0x02,0xf8,
+  0xaf,0x7e,0xae,0xd1,0xe6,0xf6,0x55,0x5a,0x80,0x0e,0xe4,0x2b,0x15,0x00,0x1a,0x36,
+  0xf2,0x43,0xd0,0x63,0x87,0x4c,0x7d,0xef,0x24,0x28,0xcd,0x5d,0xc4,0x78,0x35,0xc3,
+  0x72,0x15,0x35,0x55,0x65,0x3d,0xf8,0x6a,0x0f,0x04,0xdb,0x53,0xc6,0x75,0xec,0x3e,
+  0xd6,0xf5,0xd4,0x1a,0x0c,0x7f,0x9d,0xe2,0xa9,0x3a,0x69,0x0a,0x7f,0x7e,0xd7,0x8a,
+  0x5f,0x0b,0x56,0x9b,0x47,0x26,0xff,0xac,0x3e,0xe0,0x21,0x03,0xe4,0xe3,0xf2,0x2b,
+  0xf3,0x54,0xdc,0x05,0x62,0xc6,0x30,0x34,0x6f,0x1b,0x92,0x00,0x34,0xc7,0x2d,0x04,
+  0x15,0xaa,0x1e,0xe5,0x1e,0x72,0x12,0x92,0x48,0xe4,0x7f,0x9a,0xc4,0x51,0x00,0x8c,
+  0xdd,0xb0,0x87,0x0a,0x99,0x2d,0x7e,0x6f,0xb1,0x13,0xa2,0x4b,0xbf,0xea,0x69,0xaa,
+  0xdf,0x5a,0xa6,0xa1,0xbe,0x5d,0xb2,0xfb,0xaa,0xbd,0xcc,0x73,0xd7,0x1b,0x17,0x64,
+  0x0b,0xd5,0x21,0xfc,0x4c,0x65,0xb1,0x35,0x77,0xc2,0xaa,0xfc,0x71,0xab,0x72,0xac,
+  0xad,0xca,0xc7,0x6c,0xe4,0xb7,0xeb,0x9f,0x03,0x84,0x1b,0x52,0xd4,0xfa,0x14,0x45,
+  0x68,0x2e,0x44,0xd8,0xf2,0x51,0x00,0x6d,0x95,0x72,0xab,0x9d,0x85,0xcd,0x7e,0x6b,
+  0x1f,0x39,0xa9,0xf5,0x9d,0x96,0x4f,0xf4,0x0f,0xa3,0x4a,0x46,0x02,0xc5,0x89,0x9f,
+  0x03,0x7a,0x81,0x1b,0x96,0x8c,0x8b,0x21,0x95,0x22,0xfb,0x93,0x06,0x73,0x5c,0x86,
+  0x3b,0xb1,0x87,0x1c,0x84,0xb4,0x19,0x75,0x32,0x17,0xea,0x61,0xdb,0x64,0x35,0xe6,
+  0xc4,0x6d,0xae,0x75,0x7d,0xea,0x93,0xad,0x75,0x2a,0xb7,0x72,0x8a,0xfc,0x10,0x66,
+  0x35,0x32,0x50,0x16,0xa3,0x69,0xe8,0xa6,0xc5,0x1c,0xb5,0x79,0x01,0x07,0x6f,0x9b,
+  0x15,0x05,0x33,0xe5,0x9c,0xa8,0x83,0xb9,0xa0,0x9f,0xad,0x8b,0xa7,0xb0,0x5a,0xd7,
+  0xb8,0xb1,0x6a,0xb5,0x39,0xd4,0xb2,0x58,0x6f,0x94,0x10,0xb7,0xb8,0xcf,0xd2,0x2a,
+  0x34,0x65,0x19,0xd0,0xd8,0xee,0xc8,0x36,0xfc,0xcc,0x69,0x9a,0x42,0x93,0x70,0x5e,
+  0x38,0xc2,0x00,0xe3,0x7f,0xcd,0xd5,0xd5,0xbe,0x71,0x69,0x71,0x4f,0xd6,0x7b,0x50,
+  0x64,0x1a,0x1b,0x88,0x83,0xdf,0x57,0x39,0x49,0xf5,0xb0,0xab,0x2e,0xa9,0x91,0xb3,
+  0xd2,0xb7,0x94,0xcf,0x72,0xee,0xa2,0x3a,0x17,0xb3,0xcb,0xf6,0xaf,0xf4,0x63,0x56,
+  0x8d,0xa7,0x68,0x3f,0x21,0xb3,0x1b,0xc8,0xd5,0xb3,0x32,0xa2,0x7e,0x56,0xa6,0xdd,
+  0x17,0x67,0xc1,0x64,0x22,0xfc,0x00,0x54,0x22,0x90,0x93,0x3c,0x0e,0x32,0xee,0x78,
+  0x58,0xc9,0x20,0x12,0x17,0x4e,0x2a,0x69,0xd2,0xfa,0x81,0x4e,0x9f,0x3e,0x6a,0x7a,
+  0x13,0xa7,0x93,0xd7,0x6e,0xee,0x82,0x42,0xf5,0xd5,0x4d,0x4e,0x06,0x57,0xbd,0xb8,
+  0x55,0x91,0x66,0x65,0xe3,0x06,0xf1,0xee,0xc8,0x05,0x5b,0xb9,0x2e,0x83,0xae,0xc0,
+  0xf0,0xad,0xaf,0xd8,0xc0,0x49,0xf5,0x0f,0x6b,0xcb,0xd3,0x3b,0x3b,0xed,0x70,0xe3,
+  0x39,0x4a,0x73,0x51,0x3f,0xa3,0x99,0x96,0xdb,0xdc,0xb5,0x5d,0xee,0xb4,0x7d,0x97,
+  0x9b,0x56,0xb0,0x65,0x7b,0xbb,0xf2,0x80,0xda,0xf7,0x9a,0xcb,0xfd,0xc0,0x96,0xfb,
+  0x36,0x48,0xb8,0x55,0x7c,0x5c,0xbb,0x72,0xa3,0xf5,0xeb,0x29,0x68,0xf8,0xf6,0xe5,
+  0xa3,0x25,0x1d,0x93,0x29,0xfd,0x26,0xe3,0x97,0xfc,0xbd,0x57,0x93,0xed,0xaf,0x66,
+  0xfb,0xb7,0x2f,0x7f,0x73,0xb6,0x7f,0xfb,0x72,0x67,0xb6,0xaf,0x7b,0x53,0xad,0xb4,
+  0x2b,0xc2,0xb7,0x26,0xf9,0xfe,0xaf,0x43,0xf6,0xaf,0x0b,0x66,0x75,0x3f,0x62,0xaf,
+  0x88,0x45,0x17,0xd5,0x15,0x55,0xfc,0x27,0x70,0xbe,0xc1,0xd1,0x27,0xf7,0xb8,0xe6,
+  0xa9,0xa6,0x19,0x3a,0x35,0xa0,0x64,0x31,0x35,0x8b,0xdd,0x78,0xf1,0x55,0x63,0xf3,
+  0x0b,0x86,0xa6,0x02,0x28,0x77,0xb2,0x56,0xf4,0xc0,0x8e,0x19,0x93,0x16,0x10,0x03,
+  0xe5,0x70,0x3d,0x22,0xc9,0xd3,0x02,0x25,0x21,0x4f,0x6d,0xe7,0xe4,0x6a,0x0b,0x84,
+  0xe2,0x20,0xd2,0x16,0x28,0x7a,0x82,0xb5,0x0d,0x0f,0x95,0x65,0xdc,0x86,0x8b,0x96,
+  0xa6,0x6c,0x81,0x92,0xcb,0x63,0x41,0xbb,0xfb,0xe1,0x2d,0x30,0x8a,0x3c,0xed,0x16,
+  0x30,0x5a,0x9a,0xb6,0x05,0x88,0x7e,0xb0,0x68,0x0b,0xa0,0x2a,0x61,0xfb,0x4f,0x60,
+  0x09,0x4a,0x2b,0xa0,0xa9,0x7e,0x3c,0x31,0x61,0x67,0xf2,0x1e,0xba,0x5a,0x40,0xad,
+  0xdf,0x6b,0x27,0xd5,0x7d,0x99,0xd5,0x22,0xaf,0x66,0x0f,0xa4,0xb1,0xbc,0xf9,0x01,
+  0xe5,0x51,0xdb,0xe9,0x5f,0x77,0x6a,0xaa,0xca,0xb0,0x96,0x1b,0x91,0x79,0x4c,0x17,
+  0x07,0x49,0x47,0x89,0x16,0x22,0x6b,0x00,0x59,0x35,0x4c,0x45,0x36,0x40,0x53,0x1b,
+  0xf4,0x83,0x50,0xd0,0x47,0xa8,0xee,0xbb,0xe2,0xe4,0x4d,0xbc,0xa1,0xf3,0x25,0x7c,
+  0xd5,0xb0,0x15,0x77,0x35,0xb4,0x01,0xa9,0x4d,0xb9,0x09,0x69,0xbd,0xaa,0x46,0x25,
+  0x68,0xac,0x1e,0xd4,0xdd,0x69,0x81,0x2b,0xd5,0xb8,0xb2,0xce,0xfa,0xb7,0x68,0x8d,
+  0xb5,0x5e,0x5d,0xd5,0x5d,0xf5,0xe0,0xff,0x2b,0xb1,0x56,0x99,0x47,0xdb,0xf3,0x7b,
+  0x49,0x7c,0x23,0x7d,0x53,0x8a,0x5e,0xed,0x86,0xd2,0x36,0x29,0x97,0xcd,0xe4,0x37,
+  0x89,0x4c,0xf6,0x06,0x81,0xa6,0x37,0xc5,0x94,0x2b,0x2a,0xa0,0xec,0xa3,0x29,0x00,
+  0x75,0x7f,0xc6,0x3a,0x05,0xa0,0x0b,0x7d,0x5a,0xdc,0x66,0x6b,0x71,0x2d,0xa9,0x85,
+  0x23,0xea,0x82,0xde,0x10,0xc4,0xdd,0x3a,0x6d,0xf1,0x37,0xe9,0x78,0xd3,0x3a,0x92,
+  0xd5,0x32,0x5e,0x6b,0x84,0x45,0x5e,0x5c,0xb9,0x22,0x27,0xab,0x93,0xd7,0x84,0x5f,
+  0x43,0x97,0x9c,0x0f,0x79,0x28,0x0d,0x04,0x5f,0xa7,0xf1,0x0e,0x73,0x58,0xab,0x19,
+  0x36,0xdd,0xac,0x44,0x37,0xe7,0xd0,0xe1,0xb9,0x9a,0xda,0x39,0x07,0x36,0x54,0x97,
+  0xec,0xc8,0x5b,0x87,0xb0,0x16,0xf8,0x5b,0xbb,0x49,0x68,0xf5,0x02,0x21,0xbc,0xa5,
+  0x44,0x27,0xcf,0x1e,0x14,0xd4,0x83,0xc9,0x06,0xbf,0x17,0x17,0x06,0xd5,0x19,0xfe,
+  0x1f,0xe5,0xf4,0x0d,0xa6,0xa5,0xcd,0xb8,0xd4,0x6e,0x70,0x92,0xf7,0x4b,0x11,0xf5,
+  0xe5,0xbc,0x5f,0xc5,0x93,0x04,0xef,0x7c,0xe3,0x8d,0x5b,0x77,0xe8,0x6a,0x09,0x24,
+  0x1d,0x7e,0xf4,0xa7,0x6e,0x40,0x79,0xb2,0xf3,0xb6,0x6b,0xe3,0x20,0x39,0xe7,0xfd,
+  0xdd,0xfb,0xd6,0x0e,0x92,0xf3,0xa3,0xb3,0xb3,0x93,0xc7,0xf4,0xae,0x1d,0x27,0x6f,
+  0x8e,0xab,0x52,0x90,0xc0,0xee,0xdb,0x12,0x3c,0x52,0x97,0xd5,0x7b,0xcb,0x7e,0x6b,
+  0x40,0xab,0x4a,0xfd,0x28,0x7a,0xdb,0x09,0xf3,0x47,0x9f,0x33,0x5f,0x9f,0x4f,0x7d,
+  0xe4,0xc1,0x73,0x7e,0xd2,0x7d,0x4c,0xd7,0xca,0x7d,0x73,0xf8,0x23,0x3b,0xb6,0x87,
+  0x7d,0xad,0x5b,0x05,0x5f,0x11,0xef,0xd5,0xa2,0xbc,0x9d,0x52,0x25,0x5f,0x39,0x91,
+  0x75,0x69,0x9b,0xaf,0x99,0x48,0x5b,0xbe,0xa6,0x65,0x22,0xbf,0x9d,0xd7,0xfa,0xf0,
+  0xc0,0x5f,0xab,0x9d,0xa6,0x55,0x6d,0xad,0xf2,0x14,0xfd,0x65,0x9b,0x70,0xec,0x9c,
+  0x99,0xc7,0x94,0xbc,0x59,0xff,0x34,0x7b,0x85,0x59,0x1b,0x09,0xf9,0x5d,0xcc,0xce,
+  0x96,0xef,0x02,0x36,0x7b,0xaf,0x6b,0xfd,0x57,0xd2,0xc4,0x79,0xe1,0x7d,0x96,0xda,
+  0x6f,0xd5,0xf8,0x6c,0xf6,0x60,0xb7,0x80,0xa9,0x8c,0xd5,0xb2,0xf9,0x1d,0x81,0xb4,
+  0x3e,0xb4,0x36,0xda,0x17,0x80,0x78,0x3c,0xdc,0x62,0x98,0x5d,0x8f,0x43,0xcc,0xba,
+  0x51,0x46,0x4e,0xde,0xd9,0x83,0x83,0x04,0x19,0x5e,0x26,0xe5,0xde,0x01,0x78,0x5c,
+  0xca,0x95,0x2b,0xaf,0xf0,0x06,0x23,0xed,0xea,0x42,0xb2,0x39,0x72,0x8c,0xaf,0xbb,
+  0xa5,0xae,0xb8,0xf1,0x69,0xf3,0x69,0xe8,0xea,0x5e,0xa8,0x7f,0xcc,0x1b,0x07,0xaa,
+  0x5c,0x61,0xca,0x51,0x6d,0x53,0x29,0xe2,0x04,0x43,0x3a,0x22,0x16,0xc0,0x38,0x81,
+  0xef,0x87,0x10,0xd0,0xc8,0x43,0x03,0x9a,0x0b,0xbf,0xbf,0x5f,0x63,0x7a,0xcc,0x57,
+  0x69,0x4e,0xbc,0x66,0x10,0xb3,0x96,0x8f,0xa0,0x57,0x22,0x3a,0xbf,0x3d,0xb7,0xe7,
+  0xef,0xf4,0x05,0xcb,0x52,0x4b,0xaf,0xce,0x23,0xaf,0x4c,0x9f,0xaa,0x04,0x1e,0x4c,
+  0x26,0xc8,0xcb,0xa3,0x69,0x80,0x0b,0xba,0xe3,0xa1,0xba,0x07,0xfa,0xab,0x12,0xf3,
+  0xb4,0xdd,0x90,0xec,0xef,0x1b,0x46,0x23,0x17,0x6f,0xe2,0x09,0xaa,0xf2,0x8b,0x20,
+  0xdd,0x51,0x29,0xdb,0x69,0x53,0xaa,0xe7,0xf1,0xca,0xf3,0x35,0x3b,0xed,0xc8,0x5b,
+  0xb7,0xa0,0xcb,0x9c,0x9d,0xf4,0x5d,0xfd,0x7f,0x21,0x30,0x32,0x07,0x2d,0x7b,0xc8,
+  0x3a,0xa1,0xd7,0xa6,0x05,0x09,0x00,0x8e,0x6b,0xe2,0x1f,0x5d,0x8d,0x6a,0xdd,0x5b,
+  0xd2,0x80,0xcb,0xda,0xe7,0x44,0x8f,0xf8,0x8c,0x88,0xae,0x41,0x2b,0xdb,0xef,0xef,
+  0xef,0xad,0x49,0xda,0x99,0x0d,0x6d,0xa6,0x9f,0xf0,0x6e,0xdf,0x7f,0xfc,0x1f,0xa7,
+  0xa4,0x62,0xa9,0x49,0x64,0x00,0x00,
+};
+
+// PORTAL_CSS: 2281 -> 953 bytes
+#define ASSET_PORTAL_CSS_PATH "/assets/portal.74b3967c.css"
+#define ASSET_PORTAL_CSS_INDEX 2
+static const uint8_t ASSET_PORTAL_CSS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x85,0x55,0xed,0x8e,0xab,0x36,
+  0x10,0xfd,0x9f,0xa7,0x48,0xb5,0xaa,0xd4,0x56,0xd7,0x91,0x49,0x80,0x65,0x8d,0x2a,
+  0xf5,0x3d,0xaa,0xfe,0x30,0x78,0x48,0xdc,0x18,0xdb,0xb2,0xcd,0xcd,0xa6,0x28,0xef,
+  0xde,0x31,0x81,0x00,0xd9,0xb4,0x37,0x2b,0x25,0x2b,0x3c,0x9e,0x8f,0x33,0xe7,0x1c,
+  0x36,0xbf,0xf5,0x95,0xf9,0x24,0x5e,0xfe,0x23,0xf5,0x91,0x55,0xc6,0x09,0x70,0x04,
+  0x9f,0x94,0x2d,0x77,0x47,0xa9,0x19,0x2d,0x2d,0x17,0x22,0x9e,0xd1,0xdb,0xa6,0x32,
+  0xe2,0xda,0x37,0x46,0x07,0xd2,0xf0,0x56,0xaa,0x2b,0x23,0xdc,0x5a,0x05,0xc4,0x5f,
+  0x7d,0x80,0xf6,0xdb,0xfd,0x87,0x74,0xf2,0x9b,0xe7,0xda,0x13,0x0f,0x4e,0x36,0x65,
+  0xc5,0xeb,0xf3,0xd1,0x99,0x4e,0x0b,0xf6,0x46,0x1b,0xda,0x24,0xbc,0xac,0x8d,0x32,
+  0x8e,0xbd,0x55,0x45,0x55,0xd4,0xc5,0x23,0x7f,0x92,0x5b,0xac,0x2a,0x35,0x39,0x81,
+  0x3c,0x9e,0x02,0x4b,0x28,0xfd,0x7e,0xba,0x6d,0x76,0x17,0xc7,0x6d,0xdf,0xf2,0x4f,
+  0x72,0x91,0x22,0x9c,0x58,0x4a,0xa9,0x9d,0xbb,0xdb,0xf2,0x2e,0x98,0xdb,0xe6,0x94,
+  0xdc,0xdb,0xc2,0x31,0x80,0x25,0xbb,0xd4,0x41,0x5b,0x0e,0x0f,0x2e,0xf7,0x5c,0x39,
+  0xa5,0xe3,0x15,0x9c,0x2d,0x04,0xd3,0xb2,0x14,0x93,0x8c,0x7d,0xd4,0xd8,0x85,0x28,
+  0xca,0x00,0x9f,0x81,0x70,0x25,0x8f,0x9a,0xd5,0xa0,0x03,0x38,0xac,0xed,0xbb,0x6a,
+  0x91,0x78,0xf7,0x1e,0xf3,0x8e,0xb7,0x32,0x9a,0xd1,0xbc,0x28,0x15,0x04,0x0c,0x25,
+  0xde,0xf2,0x7a,0x18,0x02,0xd3,0x7e,0x49,0xf4,0x54,0x7a,0x8f,0x03,0x60,0xee,0x9a,
+  0x3b,0xd1,0x2f,0xd1,0x49,0x78,0xc2,0xf7,0x50,0xde,0x77,0x10,0x33,0x6d,0xbd,0x51,
+  0x52,0x6c,0xdf,0xf6,0xd9,0x3e,0x4b,0xe9,0x78,0x40,0x1c,0x17,0xb2,0xf3,0x2c,0xd9,
+  0x63,0xa9,0x35,0x76,0xab,0x2a,0xf1,0x7c,0xac,0x42,0x82,0x0c,0x0a,0x7e,0x30,0xc8,
+  0xd0,0x75,0x70,0xb8,0xb8,0xc6,0xb8,0x96,0x75,0xd6,0x82,0xab,0xb9,0x87,0x57,0x13,
+  0xbe,0xac,0xa4,0x21,0x5c,0x8c,0x3b,0xf7,0x42,0x7a,0xab,0xf8,0x95,0x35,0x0a,0x3e,
+  0xcb,0xbf,0x3b,0x1f,0x64,0x73,0x25,0x35,0xd6,0x46,0x2c,0x58,0xcc,0x02,0xa4,0xc2,
+  0x50,0x00,0x5d,0x0e,0x20,0x11,0x89,0xa4,0xf1,0x13,0x54,0x8f,0x89,0xf6,0xf3,0x96,
+  0x71,0x57,0x5b,0xba,0x22,0xd2,0x4b,0x44,0x8a,0xb8,0xd2,0xce,0x79,0x1c,0xca,0x1a,
+  0x39,0x64,0x1b,0xb1,0xdc,0x3f,0xb0,0x1c,0x06,0xb4,0xdc,0x61,0xb1,0x72,0xf8,0x5f,
+  0x06,0x69,0x34,0xe3,0x4a,0x6d,0x77,0x49,0xe6,0xe7,0x31,0xd8,0xc9,0x7c,0x07,0xb7,
+  0xda,0xcf,0x81,0x1e,0x10,0xaa,0x39,0x64,0xe7,0x41,0x41,0x1d,0x00,0xb7,0x78,0xef,
+  0x63,0x04,0x34,0x3f,0xe4,0x79,0x93,0x94,0x2f,0xaf,0x7a,0x2f,0xc5,0x72,0x11,0x1f,
+  0x8b,0x45,0x8c,0x3c,0xc4,0xd4,0x82,0x54,0x0e,0xf8,0x99,0x0d,0xdf,0x48,0x25,0x85,
+  0x37,0x5b,0x08,0x7c,0x8d,0xed,0x91,0xdb,0x61,0xe6,0x17,0x28,0xc6,0x73,0xe2,0x4f,
+  0x4e,0xea,0x33,0x7b,0x30,0x5f,0x41,0x13,0xe2,0x85,0xd8,0x86,0x3c,0xae,0x74,0xdc,
+  0x1a,0x6d,0x86,0xd5,0x4c,0xbd,0xec,0xf7,0x75,0x96,0x41,0xb9,0xe8,0xb4,0xc0,0x4e,
+  0xf1,0xa6,0x32,0xf5,0xb9,0x1f,0x83,0x9a,0xec,0x03,0x68,0x55,0x3e,0xf1,0x2a,0x02,
+  0x64,0xc8,0x88,0x91,0xef,0xbf,0xaa,0x61,0x5a,0x71,0xd4,0xc1,0x54,0xef,0x9d,0xbe,
+  0xd3,0xa2,0xb8,0x6d,0xa4,0xb6,0x5d,0xf8,0x33,0x5c,0x2d,0xfc,0x6e,0xb9,0xf7,0x11,
+  0x8b,0xbf,0xfa,0xbb,0xf0,0xd1,0x0f,0x7e,0x5e,0xd3,0xe3,0xab,0x52,0x22,0xce,0x69,
+  0xf1,0x82,0x17,0x2f,0xc8,0xb3,0x46,0x7d,0x61,0x1f,0x71,0x25,0x23,0xf3,0x8a,0xc8,
+  0xbc,0xb1,0x2b,0xd6,0x98,0xba,0xf3,0xbd,0xe9,0x82,0x92,0x1a,0x98,0x36,0x7a,0xd2,
+  0xea,0x7a,0xf1,0x53,0x38,0x7a,0x4f,0x75,0x96,0x38,0x3b,0x3a,0x54,0x23,0x95,0xea,
+  0xa7,0x07,0x83,0xdf,0x9e,0xb8,0x30,0x17,0xf4,0xaf,0xf8,0x87,0x93,0x21,0x14,0x93,
+  0xce,0xb7,0x52,0x7b,0x08,0x3f,0xc9,0xd6,0x1a,0x17,0x38,0xf2,0x74,0xba,0x37,0x20,
+  0x19,0x33,0x91,0x55,0xeb,0x73,0x24,0x22,0x5f,0x05,0xfd,0x23,0xb8,0x96,0x8d,0x2f,
+  0x10,0x7a,0x26,0xe5,0xb3,0x7d,0x3e,0x29,0x6b,0x21,0x9e,0x19,0xdb,0x41,0x43,0x13,
+  0xdd,0x82,0xb1,0x23,0xdb,0xb0,0xa9,0x9d,0xaf,0xb9,0xfe,0xa2,0x26,0x5c,0xd5,0x38,
+  0x4a,0x41,0x0b,0xfa,0x51,0x2c,0x62,0x5f,0xe8,0x2f,0xa5,0x29,0xcd,0xe9,0x18,0x83,
+  0x86,0xa2,0x51,0x7c,0xeb,0x80,0xc3,0xa1,0xa8,0x1f,0xaf,0x17,0x81,0xd8,0x40,0xb1,
+  0x0e,0x7f,0x91,0x35,0x4b,0xd2,0x4c,0xe4,0xf7,0x30,0x86,0xfa,0xe2,0x95,0x42,0x45,
+  0x9b,0xe8,0x76,0xe1,0xca,0x76,0xd9,0x34,0xb8,0x36,0x91,0xc6,0xca,0x5c,0x40,0x44,
+  0x01,0x05,0x1e,0xba,0xff,0x23,0xf7,0xe0,0xc8,0x4b,0xf9,0x64,0x0b,0xa5,0x4f,0x6c,
+  0x1f,0xd3,0xec,0xc0,0x39,0xe3,0x26,0x55,0x41,0x93,0xe2,0x67,0x3e,0xf4,0x5d,0x5d,
+  0x83,0xf7,0xfd,0x4a,0x99,0xb7,0xcd,0x1b,0xba,0xcf,0xe0,0x26,0x6b,0x1e,0xaf,0xad,
+  0x39,0x2e,0xf6,0x3f,0xfc,0xc4,0x5b,0x89,0x90,0xb8,0x87,0xa5,0x48,0x1d,0x69,0x4d,
+  0xaa,0x28,0xf0,0x72,0xa4,0x50,0x9c,0x61,0x7a,0x1b,0xe7,0x33,0x83,0x66,0x3b,0x9d,
+  0x5e,0x1e,0x23,0x9d,0x70,0xe5,0xcf,0x26,0xb8,0xe2,0x59,0x86,0x94,0xe4,0x5a,0xb6,
+  0x7c,0xe0,0x4d,0xec,0x60,0x9b,0xf8,0x6d,0xac,0xcb,0x1d,0xd2,0xbe,0x91,0x1a,0x5d,
+  0xac,0xc4,0x0d,0x05,0x59,0x73,0x35,0x02,0xdb,0x4a,0x21,0x14,0x4c,0x83,0xb9,0xa1,
+  0x9b,0x81,0x57,0x7f,0x9c,0xe1,0xda,0x38,0xde,0x82,0xdf,0xc6,0x54,0x7d,0x30,0xfd,
+  0xfc,0xfe,0x72,0x06,0xd1,0x83,0x5f,0x0e,0x39,0x15,0x70,0xfc,0xf5,0x76,0xdb,0xfc,
+  0x0b,0xd1,0x90,0x36,0xa5,0xe9,0x08,0x00,0x00,
+};
+
+// PORTAL_JS: 3379 -> 1039 bytes
+#define ASSET_PORTAL_JS_PATH "/assets/portal.d7d32600.js"
+#define ASSET_PORTAL_JS_INDEX 3
+static const uint8_t ASSET_PORTAL_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xc5,0x57,0x51,0x53,0xe3,0x36,
+  0x10,0x7e,0xcf,0xaf,0x10,0xf7,0x10,0xd9,0x93,0xc4,0xa1,0x0f,0x7d,0x49,0x70,0x6e,
+  0xee,0x28,0x37,0x65,0x86,0x1e,0x4c,0x49,0xa7,0xcf,0x8a,0xb5,0x21,0x2a,0x8e,0xe4,
+  0x4a,0x32,0x21,0x03,0xf9,0xef,0x5d,0xc9,0xb2,0x71,0x28,0x84,0xe4,0xd2,0x99,0x32,
+  0x03,0x89,0x25,0xed,0x6a,0xbf,0xdd,0x6f,0xbf,0xc5,0x9d,0x1c,0x2c,0x31,0x46,0xf0,
+  0x94,0xd2,0xbe,0x30,0xd7,0x05,0xc8,0xf4,0xb4,0x6f,0x32,0x26,0xbf,0x5a,0x99,0xca,
+  0x32,0xcf,0xc7,0x9d,0x79,0x29,0x33,0x2b,0x94,0x24,0x06,0xf2,0xc8,0xf4,0x55,0x1f,
+  0xe2,0xa7,0x0e,0xa9,0xac,0xcc,0x38,0x18,0xa9,0x31,0x2e,0x71,0x95,0x95,0x4b,0x90,
+  0x36,0xf9,0xbb,0x04,0xbd,0xbe,0x85,0x1c,0x32,0xab,0xf4,0x97,0x3c,0x8f,0x68,0x22,
+  0xc1,0xae,0x94,0xbe,0xa7,0x71,0x32,0x57,0xfa,0x82,0x65,0x8b,0x48,0xa6,0x13,0x99,
+  0x64,0x39,0x33,0xe6,0x4a,0x18,0x9b,0x68,0x58,0xaa,0x07,0x88,0xa8,0xf1,0x66,0xc0,
+  0x69,0x1c,0x3b,0x9f,0x62,0x1e,0x41,0xb7,0x0b,0x49,0x56,0x6a,0x8d,0xae,0xa7,0x4c,
+  0xdf,0x81,0x8d,0x5f,0x3d,0xb7,0xdc,0x30,0xce,0xdb,0x3e,0x82,0x0b,0xe5,0x43,0x6e,
+  0x45,0x88,0x46,0x17,0x39,0xb8,0xaf,0x5f,0xd7,0x97,0x68,0x51,0xac,0x32,0xa6,0xf1,
+  0x7c,0x62,0xec,0x3a,0x87,0x84,0x0b,0x53,0xe4,0x6c,0x9d,0x52,0xa9,0x24,0xd0,0xf1,
+  0x6e,0x5b,0x63,0x99,0x2d,0x0d,0xda,0x5a,0x78,0xb4,0xe7,0x4a,0x5a,0xdc,0x49,0xe9,
+  0x6d,0x88,0x81,0x28,0xcc,0x0f,0x09,0xf0,0x47,0x84,0xf6,0x8c,0x73,0xb7,0x81,0xdc,
+  0xc0,0x0f,0xc6,0x34,0xcb,0x55,0x76,0xff,0x61,0x50,0x78,0x01,0x56,0xe8,0x75,0x54,
+  0xdf,0x5f,0xc5,0xb1,0xf3,0x7a,0x34,0x7e,0x60,0x79,0x09,0x48,0x8e,0x7d,0xce,0xce,
+  0x71,0xd7,0x44,0x3e,0xe5,0x9b,0xce,0xa6,0xc5,0x1b,0xa4,0x53,0x54,0x91,0x26,0x53,
+  0xd2,0x58,0x32,0x43,0x6e,0xc1,0xe7,0x57,0x35,0x1c,0x05,0xd6,0x85,0x8a,0x9d,0xe0,
+  0xa1,0x58,0x83,0x2d,0xb5,0x5f,0xa9,0x29,0x39,0xab,0x0e,0xe0,0x87,0xcb,0x07,0x9b,
+  0xe5,0xc0,0x53,0xab,0x4b,0xa8,0x17,0x85,0x94,0xa0,0x7f,0x9d,0xfe,0x76,0x95,0xd2,
+  0x33,0x53,0x30,0x49,0x3c,0x33,0xd2,0x4f,0xa6,0xf0,0x3b,0x9f,0x26,0x67,0x43,0xb7,
+  0x3c,0xb9,0x45,0x7f,0x52,0xc8,0xbb,0x24,0x49,0xe8,0x16,0x75,0xf7,0x2b,0xae,0xb7,
+  0x69,0x00,0x16,0x0a,0x29,0x1e,0x18,0x36,0x07,0x8b,0xdc,0xa6,0x43,0x17,0xb0,0xb3,
+  0x5a,0x80,0x8c,0x74,0x3a,0xd1,0xde,0x3e,0x8a,0xc3,0xca,0x22,0x9d,0x54,0xc7,0x77,
+  0xdc,0x1c,0x28,0xe3,0xee,0x7e,0x41,0xb5,0x18,0x07,0xb3,0xe1,0x90,0x9c,0x2f,0x20,
+  0xbb,0x27,0xd8,0x4e,0x3e,0x3b,0x0e,0x0d,0x11,0x92,0x8b,0x8c,0x61,0xd3,0x91,0x28,
+  0x20,0xae,0x12,0x40,0x70,0x45,0xaa,0x9a,0x85,0x04,0xef,0xd0,0x02,0x4c,0x1c,0x7c,
+  0x55,0x55,0x31,0x56,0xe4,0x79,0x9d,0x97,0x74,0x81,0x97,0x72,0x78,0xbc,0x9e,0x63,
+  0x0a,0x2a,0x4f,0x34,0x9e,0x0c,0x7e,0x7a,0x7e,0x6e,0x6d,0xd4,0x87,0xfd,0x4e,0x1d,
+  0x18,0xd6,0x6e,0xcb,0x53,0x5c,0x03,0xc5,0x22,0x82,0x9d,0x8a,0x25,0xa8,0xd2,0x46,
+  0x2e,0x65,0xfd,0x9f,0x4f,0x4f,0xe3,0xda,0xac,0xd5,0x10,0xee,0x67,0xab,0xc0,0x73,
+  0x86,0x7b,0xe3,0xad,0xbd,0xed,0x56,0xc3,0xab,0xc8,0x97,0x3b,0x26,0x24,0x7d,0x39,
+  0x15,0x54,0xad,0x16,0xa8,0xd3,0x97,0x9d,0x63,0x44,0xc0,0x51,0xdb,0xff,0x8d,0x13,
+  0xcc,0x33,0x56,0x3a,0x8a,0xf7,0x28,0xe5,0x3b,0x0a,0xe1,0xc2,0x9e,0x33,0x81,0x10,
+  0x1b,0xef,0x1f,0xbb,0xf0,0xf5,0xfc,0xce,0x96,0xd8,0x95,0xd5,0x1a,0x01,0xad,0x95,
+  0x6e,0x3c,0xbc,0x9f,0xb9,0x8f,0xf3,0xb6,0x09,0xcd,0x4b,0x02,0xa5,0xc7,0xed,0x36,
+  0x46,0x96,0x48,0x54,0xb4,0x8a,0xe8,0xae,0x43,0x5d,0x86,0xe3,0xa7,0x1f,0x92,0x45,
+  0xc2,0x1a,0x2e,0xce,0x85,0x36,0x96,0x8e,0x8f,0x00,0x1e,0x54,0x62,0xd3,0xe8,0x4b,
+  0xb1,0x4a,0x77,0x2a,0xd5,0xe7,0x4a,0xd6,0x9e,0x9f,0xab,0x3e,0x76,0x58,0x2a,0x96,
+  0x74,0xbb,0x27,0xc5,0xea,0x60,0x48,0x17,0xf8,0xa9,0xc9,0x9f,0xe2,0x9b,0x20,0x05,
+  0x86,0x88,0xa8,0xf8,0x7f,0x8b,0x87,0xf1,0xa5,0x90,0x37,0x3b,0x40,0xf9,0x03,0xdb,
+  0xc8,0xfc,0x92,0x87,0xf7,0xa2,0xb9,0x6f,0xcf,0x67,0x1c,0xce,0x8e,0x19,0xa1,0xbc,
+  0xd5,0xc8,0x3c,0x5a,0x5f,0xcf,0x2b,0x6f,0x07,0x29,0xec,0xe1,0xbe,0x89,0x55,0x6e,
+  0x90,0x21,0x0f,0x7b,0x74,0xff,0x7b,0xfe,0x95,0xf8,0x4a,0xcd,0x83,0x70,0xd7,0x79,
+  0xe8,0x57,0x5d,0xbd,0x04,0xbb,0x50,0x7c,0x44,0x6f,0xae,0x6f,0xa7,0xb4,0xef,0x97,
+  0x16,0xc0,0x38,0x68,0x33,0x7a,0xa2,0x81,0x02,0x83,0xe9,0xba,0x00,0x3a,0xa2,0xac,
+  0x28,0x72,0x27,0xbf,0xd8,0x2d,0xc3,0xc7,0xc1,0x6a,0xb5,0x1a,0xa0,0x38,0x2f,0x07,
+  0xa5,0xce,0x41,0x66,0x8a,0x63,0x9b,0x6f,0x2a,0x0f,0x33,0xc5,0xd7,0x23,0x5a,0x29,
+  0x54,0xaf,0xda,0xfb,0xe3,0xf7,0xcb,0x73,0xb5,0x2c,0x50,0x69,0xa4,0x8d,0x7c,0x67,
+  0xf5,0x68,0xb7,0xa6,0xd3,0xdb,0xa7,0x90,0xaa,0x78,0x26,0xd4,0xfe,0xed,0x23,0x81,
+  0x39,0x4e,0xe8,0x37,0xed,0x61,0xf4,0x97,0x51,0xb2,0x19,0x46,0xbc,0x56,0x30,0x6c,
+  0x04,0x9e,0x98,0x32,0xcb,0xc0,0x98,0x78,0x7f,0x51,0x6b,0xd5,0x2d,0x94,0x06,0xf8,
+  0xc9,0xd9,0x4c,0x4f,0x2e,0x6f,0xdc,0xff,0x19,0x3c,0x11,0x45,0x8f,0xba,0x67,0xf7,
+  0xfb,0x0b,0x3c,0x88,0x0c,0xc8,0x0a,0x27,0x04,0xd1,0x80,0x3e,0xb4,0xc5,0xca,0xd5,
+  0xbb,0x57,0xea,0x4e,0x48,0xdc,0xb4,0x8b,0xa6,0x95,0x9c,0x8b,0x1a,0x47,0xc3,0xeb,
+  0xf8,0x18,0xbd,0x0c,0x08,0xe9,0xbb,0xba,0xf8,0x82,0xa2,0xd6,0xc5,0xf6,0x70,0x3a,
+  0x50,0x1d,0xbe,0x79,0x81,0xf7,0x28,0x78,0xe2,0x3b,0x1c,0x51,0xd4,0x14,0x56,0xcd,
+  0x00,0x88,0xff,0x97,0x09,0x10,0xe2,0xa8,0x61,0x76,0xde,0x1c,0x6c,0x07,0x02,0x6e,
+  0x61,0x6b,0xc7,0x75,0x2c,0xae,0xf7,0x50,0xed,0xc4,0xb4,0xf1,0x23,0xac,0xb9,0x1a,
+  0x5f,0x0e,0x2e,0x1e,0xf0,0x8b,0x7b,0x53,0x00,0x24,0x6d,0x44,0xef,0x61,0x5d,0x16,
+  0xb4,0x0f,0x88,0xd5,0xbd,0x69,0x24,0xf8,0x9c,0xa6,0x41,0xd2,0x69,0xb7,0xeb,0x1b,
+  0xb1,0x19,0x7c,0x63,0xe7,0xee,0x1f,0x03,0xb5,0x40,0xd2,0x33,0x0d,0x00,0x00,
+};
+
+// DASHBOARD_HTML: 10195 -> 2114 bytes
+#define ASSET_DASHBOARD_HTML_PATH "/"
+#define ASSET_DASHBOARD_HTML_INDEX 4
+static const uint8_t ASSET_DASHBOARD_HTML_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xe5,0x5a,0x5d,0x52,0xeb,0xca,
+  0x11,0x7e,0x67,0x15,0x13,0xa5,0x52,0x17,0xaa,0x8e,0x41,0x36,0x18,0x8c,0xb1,0x5d,
+  0x65,0x30,0x5c,0x48,0xe0,0x1c,0x5f,0x6c,0x2a,0x3f,0x6f,0x23,0x69,0x64,0xcd,0xf5,
+  0x58,0xa3,0x33,0x33,0xc2,0x26,0x4f,0x59,0x45,0x16,0x90,0x15,0x64,0x01,0x79,0xca,
+  0x52,0xee,0x4a,0xd2,0x33,0x92,0x2c,0xd9,0x18,0x2c,0x23,0x1e,0x92,0x9b,0x87,0x73,
+  0x90,0x5a,0xdd,0xfd,0x4d,0xb7,0x7a,0x7a,0xba,0x5b,0xee,0xfc,0x66,0xf0,0xed,0x6a,
+  0xfc,0xe7,0xe1,0x35,0x0a,0xd4,0x8c,0xf5,0x3a,0xe9,0xff,0x04,0x7b,0xbd,0xbd,0xce,
+  0x8c,0x28,0x8c,0xdc,0x00,0x0b,0x49,0x54,0xd7,0x7a,0x1a,0xdf,0xd4,0x5a,0x56,0x46,
+  0x0e,0xf1,0x8c,0x74,0xad,0x67,0x4a,0xe6,0x11,0x17,0xca,0x42,0x2e,0x0f,0x15,0x09,
+  0x81,0x6d,0x4e,0x3d,0x15,0x74,0x3d,0xf2,0x4c,0x5d,0x52,0x33,0x37,0x5f,0x10,0x0d,
+  0xa9,0xa2,0x98,0xd5,0xa4,0x8b,0x19,0xe9,0xd6,0xb5,0x12,0x45,0x15,0x23,0xbd,0x3b,
+  0x10,0x12,0x21,0x51,0xe8,0x81,0x03,0x0b,0x17,0x9d,0xa3,0x84,0xbe,0xd7,0x61,0x34,
+  0x9c,0x22,0x41,0x58,0xd7,0x92,0xea,0x85,0x11,0x19,0x10,0x02,0x28,0x81,0x20,0x7e,
+  0xd7,0x3a,0xc2,0x12,0x56,0x24,0x8f,0x3c,0x2c,0x03,0x87,0x63,0xe1,0x1d,0x9e,0x93,
+  0x26,0x6e,0xf8,0x7e,0xfd,0xd0,0x95,0x52,0x6b,0x3f,0x32,0x16,0x74,0x1c,0xee,0xbd,
+  0xf4,0x3a,0x1e,0x7d,0x46,0x2e,0x03,0x19,0x58,0x9c,0xc0,0x91,0x7e,0x5e,0x20,0x05,
+  0x9e,0xb0,0x7a,0x6b,0x84,0x1a,0x23,0xbe,0xd2,0x7c,0x41,0x7d,0xc3,0x12,0x81,0xb8,
+  0xd7,0x89,0x32,0x76,0x19,0x3b,0x56,0xef,0x7a,0x34,0x3c,0x6e,0xd4,0x46,0xc7,0xe8,
+  0xa1,0x3f,0x7e,0xbc,0xfb,0x13,0xfa,0xe5,0x6f,0xff,0x40,0x83,0xa7,0xfe,0x3d,0xba,
+  0xfa,0xf6,0x78,0xdd,0x39,0x8a,0xf4,0x92,0x00,0x02,0x56,0x14,0x2b,0xc5,0xc3,0x4c,
+  0x96,0xf1,0x09,0x8f,0xc1,0x2c,0x1e,0xba,0x8c,0xba,0xd3,0x8c,0xb0,0x7f,0x60,0xf5,
+  0xee,0xcd,0x55,0xe7,0x28,0x11,0xe8,0x25,0xe2,0x2b,0x0b,0x97,0x0a,0xab,0xd8,0x58,
+  0x2b,0x23,0x1c,0xae,0x52,0x6b,0x1e,0x07,0xb5,0xd4,0xeb,0x5a,0xe6,0xc2,0xb8,0xb0,
+  0x6b,0x39,0xd8,0x9d,0x4e,0x04,0x8f,0x43,0xaf,0xfd,0xdb,0x63,0xa7,0xd5,0xf0,0x4f,
+  0x2f,0x1c,0xbe,0xa8,0xc9,0x00,0x7b,0x7c,0xde,0xb6,0x91,0x8d,0x5a,0xd1,0x02,0xa5,
+  0x8f,0xc0,0x29,0x47,0x5a,0x71,0x6f,0x93,0x7a,0x45,0x16,0xa9,0x7e,0xa9,0x16,0x39,
+  0x80,0xcb,0x19,0x17,0xed,0xa5,0x82,0xd1,0xb8,0xff,0x38,0xbe,0xfb,0xfa,0x63,0xaa,
+  0x68,0x6f,0x83,0x11,0x2e,0xbc,0xbd,0x55,0xf7,0x6b,0x4a,0xcd,0x44,0x01,0xc4,0x14,
+  0x63,0x38,0x92,0xd4,0x61,0x24,0x01,0x23,0xbe,0x4f,0x5c,0x25,0xc7,0x05,0x8f,0x8d,
+  0xf7,0x7f,0x48,0xa9,0x3f,0x80,0xd7,0xcc,0x5a,0x7b,0xd7,0x09,0x61,0xd3,0xfa,0x15,
+  0x9f,0x4c,0x40,0x5b,0xef,0x97,0xbf,0xff,0x2b,0x7b,0xbc,0x79,0x51,0x35,0x1d,0x3b,
+  0x2b,0xa8,0x97,0xab,0xeb,0x9c,0x08,0xea,0x25,0xcf,0xfd,0x85,0xb5,0xf1,0xfd,0x30,
+  0xea,0x11,0x51,0x13,0x7c,0xbe,0x2a,0x98,0xd2,0x19,0x76,0x08,0xcb,0x56,0x7c,0x29,
+  0xe8,0x24,0x50,0x21,0x91,0x72,0xe9,0xab,0x15,0xaf,0x27,0x22,0xcf,0x98,0x25,0x88,
+  0xce,0xb3,0xd5,0xab,0xad,0xad,0x9f,0x86,0x51,0xac,0x90,0x7a,0x89,0xe0,0x3d,0x08,
+  0x1c,0x4e,0xc0,0x65,0x33,0x1a,0x76,0xad,0x26,0xfc,0xc5,0x0b,0xf8,0x6b,0x5b,0x08,
+  0x14,0xc4,0xc4,0x90,0x20,0x96,0x35,0x7f,0xd7,0xba,0xdc,0x57,0x01,0x95,0x87,0xe6,
+  0xc9,0x41,0x65,0x3b,0x46,0x11,0x21,0x5e,0x29,0x13,0xe4,0x0e,0x26,0xd4,0xed,0xd4,
+  0x86,0xba,0x9d,0x1b,0xa1,0x89,0x4b,0x2b,0x46,0x5b,0xad,0x10,0x5c,0xa5,0x26,0x18,
+  0xc8,0x47,0x0e,0x81,0x4c,0x79,0xb8,0x5c,0xeb,0xea,0xc6,0xd4,0xdc,0x8e,0x0a,0x0b,
+  0x71,0xf6,0xb8,0x6f,0x83,0x62,0xfb,0xdf,0xff,0x5c,0x6e,0xc9,0x32,0x32,0x75,0x90,
+  0x39,0xdf,0x55,0xa8,0x01,0x42,0xf5,0xd6,0xae,0x52,0xc7,0x20,0xd5,0x38,0x5b,0x95,
+  0x4a,0x72,0x4e,0xe1,0xff,0xd2,0x7b,0x0f,0x36,0xaf,0x76,0x90,0x54,0xd4,0x95,0x6f,
+  0xe4,0x1e,0xeb,0x75,0x66,0xc8,0x82,0xe1,0x29,0x52,0x74,0x46,0xde,0xca,0x1f,0x79,
+  0x10,0xc4,0xd1,0xeb,0x20,0x28,0x8f,0x72,0x15,0x10,0x77,0x2a,0xb7,0xa3,0xb8,0xc1,
+  0xb4,0x0a,0xcc,0x28,0x76,0x5d,0xd8,0x98,0xe8,0x11,0xab,0x12,0x26,0x09,0xe0,0xaa,
+  0x82,0x76,0x83,0x29,0x5b,0x6e,0xa1,0x77,0x70,0x7c,0xe0,0xab,0x82,0x73,0x8f,0xa5,
+  0x42,0xdf,0x62,0x85,0x27,0x25,0x8c,0x02,0x9a,0xaa,0x02,0x36,0x86,0xdd,0xc6,0xd0,
+  0x80,0xcf,0xc3,0x72,0x71,0x01,0xc7,0x51,0x58,0xc9,0x38,0x5d,0x3c,0xfc,0x14,0x63,
+  0x46,0xd5,0xcb,0x76,0xb4,0xef,0xc0,0x58,0x05,0x6d,0x08,0xc7,0x2a,0xd4,0x07,0xf7,
+  0x5c,0x96,0x08,0x46,0xc6,0x75,0x85,0xf2,0x71,0xb0,0xdf,0x53,0x05,0xf5,0xc8,0x76,
+  0x9c,0x9f,0xe9,0x86,0x37,0xb6,0x6b,0x0e,0xb8,0x85,0x04,0xc0,0xc5,0x4b,0x26,0xe7,
+  0xe2,0xf0,0x19,0xcb,0x65,0x9d,0x04,0x0f,0x13,0x2c,0x73,0x05,0x20,0xc9,0xf3,0xf7,
+  0xf2,0xee,0x92,0xfd,0x2e,0xf4,0x79,0xbe,0xbe,0x37,0xf2,0x1b,0xd2,0x9c,0xe6,0x02,
+  0xbb,0x8a,0x3e,0xc3,0x71,0xe0,0x61,0x85,0x6b,0xa2,0x6b,0x1d,0x9f,0xda,0x76,0x21,
+  0xfb,0xdd,0xee,0x6b,0x82,0x4e,0x9b,0xc1,0xb6,0x9c,0xb9,0xd4,0x99,0x2b,0x6b,0x9d,
+  0x9e,0xac,0x69,0x33,0x14,0x9d,0x4f,0x4f,0x3e,0xa2,0xef,0xd4,0x3e,0x69,0xad,0x29,
+  0x4c,0x48,0xa0,0xf1,0xcc,0xfb,0x80,0xc2,0xb3,0xb3,0x33,0x30,0x6f,0x55,0x63,0x4a,
+  0x33,0xe7,0x8b,0xb7,0x39,0xe5,0xef,0xf0,0xa2,0xbf,0x12,0x35,0xe7,0x62,0xfa,0x81,
+  0xe4,0x38,0xba,0x1b,0x6c,0x0f,0x46,0x29,0xa1,0x56,0xaa,0x10,0xf4,0x77,0xc3,0xed,
+  0x18,0xb4,0xd2,0x59,0x32,0xa2,0x93,0x10,0xb3,0x12,0xe9,0x1d,0x4c,0xa9,0x82,0xf3,
+  0x23,0x1c,0x0f,0x73,0x5c,0x22,0x29,0x4d,0xe6,0x55,0x60,0x06,0x5f,0x47,0x25,0xb2,
+  0x6c,0x58,0x29,0x13,0xe9,0x74,0xce,0x38,0x2e,0x71,0x56,0x79,0x6c,0x56,0x05,0xe8,
+  0x29,0x2a,0x07,0x13,0x57,0x83,0x79,0xe8,0x5f,0x6d,0xc7,0x98,0x61,0xb7,0x5a,0xc9,
+  0x82,0xc3,0x90,0xb0,0x32,0x35,0x0b,0xae,0x74,0x02,0x5e,0x31,0xee,0x4e,0x4b,0xc0,
+  0xb0,0x69,0xd5,0x53,0xa2,0xd8,0xa5,0x65,0xd7,0x24,0xed,0x8c,0x66,0xdf,0x95,0x5a,
+  0x6b,0xd6,0x34,0x29,0xef,0xd4,0x1e,0x7e,0x1a,0x8f,0xab,0xb7,0x69,0x9b,0x60,0x2f,
+  0xad,0xdd,0xf6,0xbf,0xe9,0x6b,0x4b,0xbc,0x7f,0x50,0x9d,0xf0,0xae,0x37,0xbd,0x67,
+  0xf6,0x99,0xdd,0x6a,0x55,0x79,0x67,0xd7,0x21,0x76,0x58,0xa1,0x7d,0x32,0xe4,0x82,
+  0x47,0xf2,0x15,0x5c,0x87,0xe3,0xc4,0x41,0xb9,0x6b,0x8d,0xab,0x0d,0x71,0xff,0xc0,
+  0x7a,0xe5,0xcc,0x9a,0xb3,0x22,0x7d,0x39,0xd9,0x3c,0x13,0xb0,0x8f,0xe1,0x9c,0xda,
+  0xdc,0xf8,0x6b,0x25,0xd3,0x90,0x3b,0x45,0x35,0x7f,0x30,0xf7,0xa9,0x22,0x3d,0x32,
+  0x69,0x37,0xa2,0x45,0x2e,0x5e,0x6c,0xe7,0x02,0xea,0x79,0x24,0x2c,0x0a,0x2f,0x1b,
+  0x39,0x5b,0x4b,0x18,0x5b,0xdf,0xf4,0x59,0x86,0xe1,0x33,0xb2,0xa8,0xe9,0x19,0x4e,
+  0x3b,0x19,0xe4,0xbc,0xe9,0xca,0x4b,0xc1,0xa7,0xcb,0x2a,0x69,0xb5,0xb1,0xcc,0x47,
+  0x17,0x26,0x4c,0x0c,0xe3,0x72,0x2d,0x16,0x8a,0x18,0x76,0x49,0xc0,0x19,0x34,0xab,
+  0x09,0xc7,0x21,0x59,0xe0,0x59,0xc4,0xc8,0xa1,0xcb,0x67,0x2b,0x0b,0x69,0xd7,0x2f,
+  0xa0,0x3b,0x4d,0x46,0x5c,0xed,0x7a,0xc3,0x8e,0x16,0x17,0x33,0x2c,0x26,0x40,0x32,
+  0xae,0x68,0xc1,0x7d,0x84,0x3d,0x8f,0x86,0x93,0xf6,0x69,0xb4,0xd0,0xa3,0x95,0x8b,
+  0xa2,0xb3,0x1b,0xcd,0x46,0xf3,0xc4,0xbe,0x70,0xb8,0x00,0xa8,0x76,0x1d,0x38,0x24,
+  0x87,0x1e,0x19,0xa5,0x6f,0x21,0x7d,0x50,0x13,0xd8,0xa3,0xb1,0x6c,0x9f,0x80,0x74,
+  0x1a,0x68,0x4e,0xcb,0x69,0xb9,0xad,0x0b,0x9f,0x87,0xaa,0x26,0xe9,0x5f,0x49,0xfb,
+  0xb0,0x25,0xc8,0xcc,0xfa,0x48,0xe1,0xca,0x85,0xda,0xe8,0xa3,0x30,0x9e,0x39,0xda,
+  0x2b,0x99,0x97,0x86,0x66,0xc4,0x97,0x35,0xde,0xad,0xd6,0xf1,0xd2,0x11,0x89,0xf5,
+  0x67,0xff,0xb5,0xc6,0xef,0x1c,0x39,0x4f,0x92,0x08,0x3d,0xdb,0x2c,0x11,0x3b,0x9a,
+  0xf5,0xad,0xc8,0xd9,0xe7,0x91,0x1e,0x2f,0x60,0x76,0xf0,0x4e,0xcc,0xd8,0xbf,0x1e,
+  0xb7,0x0d,0x81,0x02,0x15,0xa4,0xb7,0xd1,0x6d,0x51,0xfa,0xb0,0x10,0x50,0x40,0xf9,
+  0x3f,0xf7,0xd8,0x25,0x96,0x04,0x8d,0x79,0x44,0xdd,0x12,0xa1,0x66,0xf8,0x0a,0xb1,
+  0xf6,0xab,0x4a,0x43,0x66,0xc2,0x0e,0xa6,0xa1,0x7d,0x49,0xdc,0x83,0x52,0x09,0x09,
+  0x44,0x96,0xde,0x38,0xb6,0xd7,0x26,0x9d,0x49,0x73,0xf8,0x3f,0x92,0xa0,0xde,0x76,
+  0xcb,0x6d,0x1f,0x0d,0xa8,0x74,0xf9,0x33,0x11,0x2f,0xef,0xd4,0x04,0xcb,0x0a,0x00,
+  0xee,0x6e,0xfb,0x5b,0x0f,0xff,0xdb,0xfe,0xa7,0x1c,0xfe,0xb7,0xfd,0x0a,0x87,0xff,
+  0x6d,0x7f,0xdb,0xe1,0x9f,0xaa,0xf5,0xa8,0x84,0x1c,0xf1,0xd2,0xd6,0x71,0x7e,0x31,
+  0x81,0x3d,0xd5,0xca,0x5f,0xa3,0xe2,0x11,0x84,0xbb,0x86,0x5c,0x6f,0xa4,0x4d,0xef,
+  0xbc,0xb2,0x43,0x0a,0x1b,0x89,0x48,0x75,0xb9,0x32,0x39,0xcd,0xa8,0xda,0x73,0xfa,
+  0xef,0x9b,0xfd,0xf9,0x7b,0x6a,0x47,0xf8,0x99,0xbc,0x56,0xab,0xa9,0xa0,0x16,0x81,
+  0x19,0xa6,0xb2,0xeb,0x69,0xc2,0x0e,0xfa,0x57,0x22,0xf2,0xcc,0xaf,0x7b,0x75,0x2f,
+  0x0b,0x33,0xdf,0xc5,0x4d,0xdc,0xcc,0x17,0xf0,0x48,0x24,0xd9,0x60,0x98,0x21,0x6b,
+  0xcb,0xcc,0xc5,0xfa,0x98,0x40,0x7f,0xc5,0xca,0x00,0xf3,0x78,0x3d,0x85,0x78,0xcd,
+  0x60,0x9a,0x76,0xd3,0x3e,0x6d,0x15,0x5d,0xde,0xd2,0x1e,0x1f,0xc6,0x0e,0xa3,0x32,
+  0x20,0x12,0x29,0xde,0x46,0xf9,0x64,0xc7,0xa4,0xf6,0xd8,0x49,0xb2,0x55,0xa1,0x12,
+  0x8e,0x3e,0x38,0x98,0x78,0xaf,0xb7,0x90,0x2f,0xeb,0xdf,0x81,0x80,0x92,0x77,0x16,
+  0xa3,0x17,0xa9,0xc8,0xec,0xf3,0x7b,0x0b,0x00,0xd9,0xb1,0xb5,0xe8,0x0b,0x37,0xa0,
+  0x8a,0xb8,0x2a,0x16,0xef,0x8f,0x3e,0x7b,0x83,0x18,0x92,0xe0,0x15,0x17,0x04,0x65,
+  0xdf,0x13,0x3f,0xde,0xff,0x0d,0x9f,0xd0,0x8d,0x20,0xdf,0x4b,0xb4,0x80,0x51,0xec,
+  0x03,0x63,0xa5,0x99,0xb5,0x20,0x04,0xdd,0x12,0x1c,0x6d,0x47,0x0b,0x08,0xae,0x34,
+  0xa7,0x79,0xa0,0x21,0xda,0x01,0x0e,0xce,0x85,0xaa,0x88,0x37,0x40,0x0a,0xd0,0x08,
+  0xb6,0x46,0x89,0xa1,0xbc,0xe6,0xad,0x34,0x86,0x9a,0x12,0xe5,0x96,0x45,0x93,0x86,
+  0xb9,0xda,0x38,0x82,0x46,0x68,0x4c,0x66,0x25,0x3c,0x09,0x9b,0xa9,0x92,0x1b,0xbf,
+  0x8d,0xfb,0xe8,0x29,0xf2,0xb0,0x22,0xef,0x76,0xd9,0x68,0xc2,0xb9,0xb7,0xde,0x0a,
+  0x7f,0xe0,0xa5,0x51,0x31,0x9b,0x63,0x51,0xe6,0x95,0xcd,0xdf,0x18,0x80,0x7c,0x62,
+  0xaa,0xf2,0x28,0x9e,0xac,0xe5,0x2a,0x4d,0xca,0x93,0xd5,0x00,0xee,0x42,0x9e,0x7e,
+  0x6c,0xfb,0xec,0x8c,0xa5,0xa1,0x76,0x4c,0x59,0xf7,0xd7,0x03,0x74,0x33,0x2c,0x31,
+  0x42,0xf4,0x23,0x59,0x2d,0x71,0x40,0xa7,0x85,0xc6,0xa5,0xbe,0x09,0xf9,0x9a,0x37,
+  0xae,0x04,0xf7,0x80,0x17,0x68,0x17,0x48,0xa8,0x26,0x3f,0x01,0x55,0x3b,0x73,0xa4,
+  0xe0,0x24,0x37,0x89,0xab,0xc4,0x17,0x22,0xe2,0x49,0xcd,0x5e,0x05,0xf3,0x2b,0x51,
+  0x3b,0x61,0x86,0x44,0x55,0xc6,0xd4,0x63,0x31,0x82,0xee,0x39,0x80,0xee,0x83,0xe7,
+  0x0e,0x4a,0x24,0x30,0x3d,0xa4,0xac,0x94,0xbf,0xe0,0x94,0x33,0xe7,0xa5,0x8d,0x8e,
+  0x50,0xbd,0xd4,0x59,0x57,0x05,0xee,0x76,0x3c,0x1e,0xa2,0xa8,0xa9,0xc1,0xa2,0xf3,
+  0x66,0x89,0xc3,0x4e,0x29,0x28,0x5f,0xd5,0xe7,0x24,0x18,0x28,0x0f,0xf4,0x4f,0x22,
+  0x04,0xfa,0x0b,0x0f,0x49,0x26,0xfb,0xaa,0x82,0x44,0xf0,0xaf,0xe6,0x19,0xc6,0xb5,
+  0x16,0x08,0x7a,0xe7,0xdf,0x15,0x72,0x90,0x8f,0x5d,0xfd,0x69,0x6f,0x59,0x20,0xde,
+  0x24,0xf7,0x68,0xbd,0x50,0xdc,0x58,0x21,0x36,0x0b,0x25,0x62,0x32,0xf7,0x5c,0x2b,
+  0x11,0x2f,0x74,0xfb,0x5a,0xc3,0x8c,0x4e,0xc2,0xb6,0x4b,0x74,0x7f,0xa7,0x47,0xd2,
+  0x04,0x0b,0x89,0xfe,0x48,0x6f,0xe8,0x17,0x94,0x8d,0x04,0xbe,0x20,0x1c,0x7a,0x08,
+  0x33,0x86,0x00,0x56,0x41,0x37,0x26,0x5f,0x57,0x8b,0x2b,0x2e,0x9a,0x71,0x0f,0xb3,
+  0x9a,0x6e,0x8a,0xa0,0x31,0x48,0xb7,0xa9,0x26,0x41,0x82,0x43,0xe8,0x15,0xa3,0xa1,
+  0x6e,0xa0,0xa7,0x2e,0xcd,0xc5,0xc7,0x89,0x8b,0x53,0xc4,0xcd,0x32,0xf9,0x2f,0x82,
+  0xcc,0xfd,0xa5,0xbe,0x7d,0x5f,0xc2,0xe7,0x5c,0x2d,0xdb,0x56,0x4d,0xb9,0x49,0x08,
+  0xb9,0xd4,0xea,0xcc,0x7d,0xaf,0x23,0x5d,0x41,0x23,0x85,0xa4,0x70,0x37,0xfd,0xcc,
+  0xad,0x71,0x7e,0xde,0x3a,0x39,0x26,0xf6,0xe1,0xcf,0xd2,0x74,0x5a,0x86,0x19,0x2e,
+  0x92,0xdf,0xb9,0x1d,0x99,0x1f,0xef,0xed,0xfd,0x07,0x84,0xe6,0x2b,0xa2,0xd3,0x27,
+  0x00,0x00,
+};
+
+static const UiAsset uiAssets[] = {
+  {ASSET_DASHBOARD_CSS_PATH, "text/css", "\"9e5a2ff1\"", "public, max-age=31536000, immutable", ASSET_DASHBOARD_CSS_GZ, sizeof(ASSET_DASHBOARD_CSS_GZ)},
+  {ASSET_DASHBOARD_JS_PATH, "application/javascript", "\"299843e0\"", "public, max-age=31536000, immutable", ASSET_DASHBOARD_JS_GZ, sizeof(ASSET_DASHBOARD_JS_GZ)},
+  {ASSET_PORTAL_CSS_PATH, "text/css", "\"74b3967c\"", "public, max-age=31536000, immutable", ASSET_PORTAL_CSS_GZ, sizeof(ASSET_PORTAL_CSS_GZ)},
+  {ASSET_PORTAL_JS_PATH, "application/javascript", "\"d7d32600\"", "public, max-age=31536000, immutable", ASSET_PORTAL_JS_GZ, sizeof(ASSET_PORTAL_JS_GZ)},
+  {ASSET_DASHBOARD_HTML_PATH, "text/html", "\"fc16b031\"", "no-cache", ASSET_DASHBOARD_HTML_GZ, sizeof(ASSET_DASHBOARD_HTML_GZ)},
+};
+#define UI_ASSET_COUNT (sizeof(uiAssets) / sizeof(uiAssets[0]))
+
+#endif // UI_ASSETS_H
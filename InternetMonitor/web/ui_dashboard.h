@@ -7,6 +7,9 @@
  * 
  * Contains the primary dashboard UI including effect controls,
  * brightness/speed sliders, rotation buttons, and status display.
+ *
+ * DASHBOARD_HTML/CSS/JS are served gzipped from ui_assets.h; rerun
+ * tools/build_assets.py after editing them.
  */
 
 // Dashboard CSS
@@ -56,6 +59,7 @@ const char DASHBOARD_CSS[] PROGMEM = R"rawliteral(
     .btn-danger{background:#7f1d1d;border-color:#991b1b;color:#fca5a5;margin-top:14px;padding-top:14px;border-top:1px solid #252540}
     .btn-danger:hover{background:#991b1b;color:#fef2f2}
     .footer{text-align:center;padding:14px;font-size:.65rem;color:#505068}
+    .hist{display:block;width:100%;height:90px;background:#141426;border-radius:6px}
     @media(min-width:700px){
       body{display:flex;align-items:center;justify-content:center;padding:24px}
       .wrap{width:90%;max-width:800px}
@@ -87,10 +91,23 @@ const char DASHBOARD_CSS[] PROGMEM = R"rawliteral(
 
 // Dashboard JavaScript (uses cookies for auth)
 const char DASHBOARD_JS[] PROGMEM = R"rawliteral(
-    function E(e){fetch('/effect?e='+e,{credentials:'same-origin'}).then(r=>r.json()).then(d=>{document.getElementById('bv').textContent=d.brightness+'/50';document.getElementById('sv').textContent=d.speed+'%';document.querySelector('input[oninput*="B("]').value=d.brightness;document.querySelector('input[oninput*="S("]').value=d.speed}).catch(err=>console.warn('Effect error:',err));document.querySelectorAll('.grid .btn').forEach(b=>{const n=parseInt(b.getAttribute('onclick').match(/\d+/)[0]);b.classList.toggle('active',n===e)})}
-    function B(v){const el=document.getElementById('bv');el.textContent=v+'/50';fetch('/brightness?b='+v,{credentials:'same-origin'}).catch(()=>{el.textContent='Error';setTimeout(upd,500)})}
-    function S(v){const el=document.getElementById('sv');el.textContent=v+'%';fetch('/speed?s='+v,{credentials:'same-origin'}).catch(()=>{el.textContent='Error';setTimeout(upd,500)})}
-    function R(r){fetch('/rotation?r='+r,{credentials:'same-origin'}).catch(err=>console.warn('Rotation error:',err));document.querySelectorAll('.rot-btn').forEach((b,i)=>b.classList.toggle('active',i===r))}
+    // Settings go out as one POST /api/settings batch. Slider events only
+    // update pend; at most one request per 150 ms and one in flight, and
+    // the last value always lands. Buttons send right away.
+    let pend={},pendTimer=0,pendBusy=false;
+    function set(k,v,now){pend[k]=+v;if(now){clearTimeout(pendTimer);pendTimer=0;flush()}else if(!pendTimer)pendTimer=setTimeout(flush,150)}
+    function flush(){pendTimer=0;if(pendBusy||!Object.keys(pend).length)return;
+      const body=pend;pend={};pendBusy=true;
+      fetch('/api/settings',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body),credentials:'same-origin'})
+        .then(r=>r.json()).then(d=>{if(body.effect!=null)sliders(d)})
+        .catch(err=>console.warn('Settings error:',err))
+        .finally(()=>{pendBusy=false;if(Object.keys(pend).length&&!pendTimer)flush()})}
+    function sliders(d){document.getElementById('bv').textContent=d.brightness+'/50';document.getElementById('sv').textContent=d.speed+'%';document.querySelector('input[oninput*="B("]').value=d.brightness;document.querySelector('input[oninput*="S("]').value=d.speed}
+    // A new effect brings its own brightness/speed, so drop pending ones
+    function E(e){delete pend.brightness;delete pend.speed;set('effect',e,true);document.querySelectorAll('.grid .btn').forEach(b=>{const n=parseInt(b.getAttribute('onclick').match(/\d+/)[0]);b.classList.toggle('active',n===e)})}
+    function B(v){document.getElementById('bv').textContent=v+'/50';set('brightness',v)}
+    function S(v){document.getElementById('sv').textContent=v+'%';set('speed',v)}
+    function R(r){set('rotation',r,true);document.querySelectorAll('.rot-btn:not(.hist-btn)').forEach((b,i)=>b.classList.toggle('active',i===r))}
     function T(id){const t=document.getElementById(id+'T'),b=document.getElementById(id+'B');if(t&&b){t.classList.toggle('collapsed');b.classList.toggle('collapsed');localStorage.setItem(id,t.classList.contains('collapsed')?'1':'0')}}
     function logout(){fetch('/logout',{credentials:'same-origin'}).then(()=>window.location='/');}
     function factoryReset(){
@@ -113,15 +130,39 @@ const char DASHBOARD_JS[] PROGMEM = R"rawliteral(
       });
     }
     function fmt(ms){let s=Math.floor(ms/1000),m=Math.floor(s/60),h=Math.floor(m/60),d=Math.floor(h/24);let r='';if(d)r+=d+'d ';if(h%24)r+=(h%24)+'h ';if(m%60)r+=(m%60)+'m ';r+=(s%60)+'s';return r}
-    const colors={4:'#22c55e',5:'#f59e0b',6:'#ef4444',3:'#ef4444',2:'#c026d3',0:'#3b82f6',1:'#3b82f6'};
-    function upd(){fetch('/stats',{credentials:'same-origin'}).then(r=>{if(!r.ok){window.location='/';throw'';}return r.json()}).then(d=>{
+    const colors={4:'#22c55e',5:'#f59e0b',6:'#ef4444',7:'#e11d48',8:'#d946ef',3:'#ef4444',2:'#c026d3',0:'#3b82f6',1:'#3b82f6'};
+    function api(u){return fetch(u,{credentials:'same-origin'}).then(r=>{if(!r.ok){window.location='/';throw'';}return r.json()})}
+    function upd(){api('/stats').then(stats).catch(()=>{})}
+    // Live updates: /api/live pushes changed fields, merged into cur.
+    // uptime/utc aren't pushed on their own, so they advance locally.
+    let cur={},base=null;
+    function merge(d){Object.assign(cur,d);if(d.uptime!=null)base={up:d.uptime,utc:d.utc,at:Date.now()};stats(cur);if(d.mqtt)mqttLive(d.mqtt)}
+    function tick(){if(!base)return;const dt=Date.now()-base.at;cur.uptime=base.up+dt;if(base.utc>0)cur.utc=base.utc+Math.floor(dt/1000);stats(cur)}
+    function poll(){setInterval(upd,2000);setInterval(updMqtt,5000)}
+    function live(){
+      if(!window.EventSource){poll();return}
+      const es=new EventSource('/api/live');
+      es.addEventListener('stats',e=>merge(JSON.parse(e.data)));
+      // Closed for good (503: too many streams, 401): fall back to polling
+      es.onerror=()=>{if(es.readyState===EventSource.CLOSED){poll();upd()}};
+      setInterval(tick,1000);
+    }
+    function stats(d){
       document.getElementById('up').textContent=fmt(d.uptime);
       document.getElementById('chk').textContent=d.checks;
       const rate=document.getElementById('rate');rate.textContent=d.rate+'%';rate.className='stat-val '+(d.rate>95?'good':'bad');
       const fail=document.getElementById('fail');fail.textContent=d.failed;fail.className='stat-val '+(d.failed>0?'bad':'');
       document.getElementById('last').textContent=d.lastOutage>0?fmt(d.lastOutage):'None';
       document.getElementById('down').textContent=fmt(d.downtime);
+      const qual=document.getElementById('qual');if(qual&&d.quality!=null){qual.textContent=d.quality;qual.className='stat-val '+(d.quality>=85?'good':(d.quality<80?'bad':''));}
+      const loss=document.getElementById('loss');if(loss&&d.loss!=null){loss.textContent=d.loss+'%';loss.className='stat-val '+(d.loss>2?'bad':'');}
+      const jit=document.getElementById('jit');if(jit&&d.jitter!=null)jit.textContent=d.jitter+' ms';
       const rssi=document.getElementById('rssi');rssi.textContent=d.rssi+' dBm';rssi.className='stat-val '+(d.rssi>-60?'good':'');
+      const gw=document.getElementById('gw');if(gw&&d.gateway!=null){gw.textContent=d.gateway?'OK ('+d.gatewayRtt+' ms)':'No reply';gw.className='stat-val '+(d.gateway?'good':'bad');}
+      const dlm=document.getElementById('dlm');if(dlm&&d.downMbps!=null)dlm.textContent=d.tputRunning?'Testing...':d.downMbps+' Mbps';
+      const ulm=document.getElementById('ulm');if(ulm&&d.upMbps!=null)ulm.textContent=d.tputRunning?'Testing...':d.upMbps+' Mbps';
+      const clk=document.getElementById('clk');if(clk&&d.utc!=null){clk.textContent=d.utc>0?new Date(d.utc*1000).toLocaleString():'Not synced';clk.className='stat-val '+(d.clock=='holdover'?'bad':'');}
+      const dns=document.getElementById('dns');if(dns&&d.dns!=null){dns.textContent=d.dns?'OK':'No answer';dns.className='stat-val '+(d.dns?'good':'bad');}
       document.getElementById('heap').textContent=Math.floor(d.heap/1024)+' KB';
       const minheap=document.getElementById('minheap');if(minheap&&d.minHeap!=null)minheap.textContent=Math.floor(d.minHeap/1024)+' KB';
       document.getElementById('temp').textContent=d.temp+'°C';
@@ -131,14 +172,62 @@ const char DASHBOARD_JS[] PROGMEM = R"rawliteral(
       // Performance stats (with null checks)
       const fps=document.getElementById('fps');if(fps&&d.ledFps!=null){fps.textContent=d.ledFps.toFixed(1);fps.className='stat-val '+(d.ledFps>55?'good':(d.ledFps>30?'':'bad'));}
       const frameus=document.getElementById('frameus');if(frameus&&d.ledFrameUs!=null)frameus.textContent=d.ledFrameUs+' µs';
+      const slock=document.getElementById('slock');if(slock&&d.stateLockMaxNs!=null)slock.textContent=d.stateLockMaxNs+' ns';
+      const cpu=document.getElementById('cpu');if(cpu&&d.cpu&&d.cpu.cores)cpu.textContent=d.cpu.cores[0].avg+'% / '+d.cpu.cores[1].avg+'%';
+      const httplat=document.getElementById('httplat');if(httplat&&d.http&&d.http.requests)httplat.textContent=d.http.p50Ms+' / '+d.http.p95Ms+' ms';
       const maxf=document.getElementById('maxframeus');if(maxf&&d.ledMaxFrameUs!=null){maxf.textContent=d.ledMaxFrameUs+' µs';maxf.className='stat-val '+(d.ledMaxFrameUs<10000?'good':(d.ledMaxFrameUs<16000?'':'bad'));}
       const ledstack=document.getElementById('ledstack');if(ledstack&&d.ledStack!=null)ledstack.textContent=d.ledStack+' bytes';
       const netstack=document.getElementById('netstack');if(netstack&&d.netStack!=null)netstack.textContent=d.netStack+' bytes';
-    }).catch(()=>{})}
+      document.getElementById('cpufreq').textContent=d.cpuFreq+' MHz';
+    }
+    // Everything the page shows comes from /api/dashboard (stats + settings,
+    // effect list, device info, MQTT config); the HTML itself is static
+    function tog(id,on){document.getElementById(id).value=on?'1':'0';document.getElementById(id+'Bg').style.background=on?'#4338ca':'#303048';document.getElementById(id+'Knob').style.left=on?'22px':'2px'}
+    function txt(id,v){document.getElementById(id).textContent=v}
+    function render(d){
+      const s=d.settings;
+      document.getElementById('fx').innerHTML=d.effectList.map((n,i)=>'<button class="btn'+(i?'':' off')+(i===s.effect?' active':'')+'" onclick="E('+i+')">'+n+'</button>').join('');
+      txt('bv',s.brightness+'/50');document.querySelector('input[oninput*="B("]').value=s.brightness;
+      txt('sv',s.speed+'%');document.querySelector('input[oninput*="S("]').value=s.speed;
+      document.querySelectorAll('.rot-btn:not(.hist-btn)').forEach((b,i)=>b.classList.toggle('active',i===s.rotation));
+      const v=d.device;
+      txt('ssid',v.ssid);txt('ip',v.ip);txt('mac',v.mac);txt('chan',v.channel);
+      txt('flash',v.flashMb+' MB');txt('sketch',v.sketchKb+' KB');txt('fw','v'+d.version);
+      const m=d.mqtt;
+      document.getElementById('mqttBroker').value=m.broker;
+      document.getElementById('mqttPort').value=m.port;
+      document.getElementById('mqttUser').value=m.username;
+      document.getElementById('mqttPass').placeholder=m.hasPassword?'••••••••':'(optional)';
+      document.getElementById('mqttTopic').value=m.topic;
+      document.getElementById('mqttInt').value=m.interval;
+      txt('mqttPubTopic',m.topic+'/state');
+      tog('mqttEn',m.enabled);tog('mqttHA',m.ha_discovery);
+      const st=document.getElementById('mqttStatus');st.textContent=m.status;st.style.color=m.connected?'#22c55e':(m.enabled?'#f59e0b':'#707088');
+      mqttStoreOriginal();
+      // If already connected, test is implicitly passed
+      mqttTestPassed=m.connected;
+      mqttUpdateUI();
+      stats(d);
+    }
     // Restore collapsed state from localStorage (effects defaults open, sys/diag default collapsed)
     ['effects'].forEach(id=>{if(localStorage.getItem(id)==='1'){const t=document.getElementById(id+'T'),b=document.getElementById(id+'B');if(t&&b){t.classList.add('collapsed');b.classList.add('collapsed')}}});
     ['sys','diag','mqtt'].forEach(id=>{if(localStorage.getItem(id)==='0'){const t=document.getElementById(id+'T'),b=document.getElementById(id+'B');if(t&&b){t.classList.remove('collapsed');b.classList.remove('collapsed')}}});
-    setInterval(upd,2000);upd();
+    api('/api/dashboard').then(d=>{render(d);live()}).catch(()=>{});
+    
+    // History graph: bar per point (green = all passed, amber = some failed,
+    // red = mostly failed), line = mean check time
+    let histRange=3600;
+    function H(r){if(r)histRange=r;document.querySelectorAll('.hist-btn').forEach(b=>b.classList.toggle('active',+b.dataset.r===histRange));
+      fetch('/history?range='+histRange,{credentials:'same-origin'}).then(r=>r.json()).then(drawHist).catch(()=>{})}
+    function drawHist(d){const c=document.getElementById('hist');if(!c)return;
+      const w=c.width=c.clientWidth*2,h=c.height=c.clientHeight*2,x=c.getContext('2d');
+      const t0=d.now-d.range,bw=Math.max(2,w*d.step/d.range-1);let all=0,bad=0,rs=0,rn=0,mx=1;
+      d.points.forEach(p=>{all+=p[1];bad+=p[2];rs+=p[3]*(p[1]-p[2]);rn+=p[1]-p[2];if(p[4]>mx)mx=p[4]});
+      d.points.forEach(p=>{if(!p[1])return;const f=p[2]/p[1];x.fillStyle=f===0?'#22c55e55':(f<.5?'#f59e0bb0':'#ef4444d0');x.fillRect((p[0]-t0)/d.range*w,0,bw,h)});
+      x.strokeStyle='#818cf8';x.lineWidth=2;x.beginPath();let first=true;
+      d.points.forEach(p=>{if(p[1]<=p[2])return;const px=(p[0]-t0)/d.range*w+bw/2,py=h-4-(p[3]/mx)*(h-8);if(first){x.moveTo(px,py);first=false}else x.lineTo(px,py)});x.stroke();
+      document.getElementById('histInfo').textContent=all?((100*(all-bad)/all).toFixed(2)+'% up • '+Math.round(rs/Math.max(rn,1))+' ms avg'):'No data yet'}
+    setInterval(H,60000);H();
     
     // MQTT State
     let mqttTestPassed=false;
@@ -258,13 +347,6 @@ const char DASHBOARD_JS[] PROGMEM = R"rawliteral(
     const intEl=document.getElementById('mqttInt');
     if(intEl){intEl.addEventListener('input',mqttOnChange);intEl.addEventListener('change',mqttOnChange);}
     
-    // Initialize
-    mqttStoreOriginal();
-    // If already connected, test is implicitly passed
-    const initStatus=document.getElementById('mqttStatus');
-    if(initStatus&&initStatus.textContent==='Connected')mqttTestPassed=true;
-    mqttUpdateUI();
-    
     // MQTT Functions
     function mqttToggle(){
       const inp=document.getElementById('mqttEn');
@@ -368,8 +450,9 @@ const char DASHBOARD_JS[] PROGMEM = R"rawliteral(
         }).catch(()=>showError('Error resetting MQTT','Reset Failed'));
       }});
     }
-    // Update MQTT status periodically
-    function updMqtt(){fetch('/mqtt/status',{credentials:'same-origin'}).then(r=>r.json()).then(d=>{
+    // MQTT status from /api/live, or polled when streaming isn't available
+    function updMqtt(){fetch('/mqtt/status',{credentials:'same-origin'}).then(r=>r.json()).then(mqttLive).catch(()=>{})}
+    function mqttLive(d){
       const s=document.getElementById('mqttStatus');
       // Only update status if not in middle of test
       if(s&&s.textContent!=='Testing...'){
@@ -386,8 +469,124 @@ const char DASHBOARD_JS[] PROGMEM = R"rawliteral(
       // If connected, test is implicitly passed
       if(d.connected&&!mqttConnectionChanged())mqttTestPassed=true;
       mqttUpdateUI();
-    }).catch(()=>{});}
-    setInterval(updMqtt,5000);
+    }
+)rawliteral";
+
+// Dashboard page: static, filled in by DASHBOARD_JS from /api/dashboard.
+// {{cssPath}}, {{jsPath}} and {{modal}} are replaced by tools/build_assets.py.
+const char DASHBOARD_HTML[] PROGMEM = R"rawliteral(<!DOCTYPE html><html><head>
+<meta charset="UTF-8">
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<title>Internet Monitor</title>
+<link rel="stylesheet" href="{{cssPath}}">
+</head><body><div class="wrap">
+<div class="hdr"><div class="hdr-left">
+<h1>Internet Monitor</h1>
+<p class="sub">ESP32-S3 MATRIX • DUAL CORE</p>
+</div><button class="logout" onclick="logout()">Logout</button></div>
+<div class="status">
+<span class="status-dot" id="dot" style="background:#3b82f6;box-shadow:0 0 8px #3b82f6"></span><span class="status-text" id="stxt" style="color:#3b82f6">STARTING</span>
+</div>
+<div class="card"><div class="card-title collapsible" id="effectsT" onclick="T('effects')"><span>Effects</span><span class="toggle">▼</span></div>
+<div class="card-body" id="effectsB"><div class="grid" id="fx"></div>
+<div class="slider-row"><div class="slider-label"><span>Brightness</span>
+<span class="slider-val" id="bv">-</span></div>
+<input type="range" min="5" max="50" value="5" oninput="B(this.value)"></div>
+<div class="slider-row"><div class="slider-label"><span>Speed</span>
+<span class="slider-val" id="sv">-</span></div>
+<input type="range" min="10" max="100" value="10" oninput="S(this.value)"></div>
+<div class="rot-row"><span>Rotation</span>
+<button class="rot-btn" onclick="R(0)">0°</button>
+<button class="rot-btn" onclick="R(1)">90°</button>
+<button class="rot-btn" onclick="R(2)">180°</button>
+<button class="rot-btn" onclick="R(3)">270°</button>
+</div></div></div>
+<div class="card"><div class="card-title">Statistics</div>
+<div class="stat"><span class="stat-label">Uptime</span><span class="stat-val" id="up">-</span></div>
+<div class="stat"><span class="stat-label">Checks</span><span class="stat-val" id="chk">-</span></div>
+<div class="stat"><span class="stat-label">Success Rate</span><span class="stat-val" id="rate">-</span></div>
+<div class="stat"><span class="stat-label">Failed</span><span class="stat-val" id="fail">-</span></div>
+<div class="stat"><span class="stat-label">Last Outage</span><span class="stat-val" id="last">-</span></div>
+<div class="stat"><span class="stat-label">Total Downtime</span><span class="stat-val" id="down">-</span></div>
+<div class="stat"><span class="stat-label">Link Quality</span><span class="stat-val" id="qual">-</span></div>
+<div class="stat"><span class="stat-label">Packet Loss</span><span class="stat-val" id="loss">-</span></div>
+<div class="stat"><span class="stat-label">Jitter</span><span class="stat-val" id="jit">-</span></div>
+</div>
+<div class="card"><div class="card-title">History</div>
+<canvas class="hist" id="hist"></canvas>
+<div class="rot-row"><span id="histInfo">-</span>
+<button class="rot-btn hist-btn active" data-r="3600" onclick="H(3600)">1h</button>
+<button class="rot-btn hist-btn" data-r="86400" onclick="H(86400)">24h</button>
+<button class="rot-btn hist-btn" data-r="604800" onclick="H(604800)">7d</button>
+<button class="rot-btn hist-btn" data-r="7776000" onclick="H(7776000)">90d</button>
+</div></div>
+<div class="card"><div class="card-title">Network</div>
+<div class="stat"><span class="stat-label">SSID</span><span class="stat-val" id="ssid">-</span></div>
+<div class="stat"><span class="stat-label">IP</span><span class="stat-val" id="ip">-</span></div>
+<div class="stat"><span class="stat-label">Signal</span><span class="stat-val" id="rssi">-</span></div>
+<div class="stat"><span class="stat-label">Gateway</span><span class="stat-val" id="gw">-</span></div>
+<div class="stat"><span class="stat-label">DNS</span><span class="stat-val" id="dns">-</span></div>
+<div class="stat"><span class="stat-label">Download</span><span class="stat-val" id="dlm">-</span></div>
+<div class="stat"><span class="stat-label">Upload</span><span class="stat-val" id="ulm">-</span></div>
+<div class="stat"><span class="stat-label">MAC</span><span class="stat-val" id="mac">-</span></div>
+<div class="stat"><span class="stat-label">Channel</span><span class="stat-val" id="chan">-</span></div>
+<div class="stat"><span class="stat-label">Clock</span><span class="stat-val" id="clk">-</span></div>
+</div>
+<div class="card"><div class="card-title collapsible collapsed" id="mqttT" onclick="T('mqtt')"><span>MQTT</span><span class="toggle">▼</span></div>
+<div class="card-body collapsed" id="mqttB">
+<div class="stat"><span class="stat-label">Status</span><span class="stat-val" id="mqttStatus" style="color:#707088">-</span></div>
+<div class="stat"><span class="stat-label">Enabled</span>
+<label class="tog" id="mqttEnToggle" onclick="mqttToggle()"><span class="tog-bg" id="mqttEnBg" style="background:#303048"></span><span class="tog-knob" id="mqttEnKnob" style="left:2px"></span><input type="hidden" id="mqttEn" value="0"></label></div>
+<div class="stat" style="flex-wrap:wrap"><span class="stat-label">Broker</span>
+<input type="text" id="mqttBroker" value="" placeholder="mqtt.example.com" style="flex:1;min-width:120px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem"></div>
+<div class="stat"><span class="stat-label">Port</span>
+<input type="number" id="mqttPort" value="1883" style="width:70px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem"></div>
+<div class="stat" style="flex-wrap:wrap"><span class="stat-label">Username</span>
+<input type="text" id="mqttUser" value="" placeholder="(optional)" style="flex:1;min-width:100px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem"></div>
+<div class="stat" style="flex-wrap:wrap"><span class="stat-label">Password</span>
+<input type="password" id="mqttPass" placeholder="(optional)" style="flex:1;min-width:100px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem"></div>
+<div class="stat" style="flex-wrap:wrap"><span class="stat-label">Base Topic</span>
+<input type="text" id="mqttTopic" value="" style="flex:1;min-width:120px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem"></div>
+<div class="stat"><span class="stat-label">Interval (sec)</span>
+<input type="number" id="mqttInt" value="30" min="5" max="3600" style="width:70px;margin-left:8px;padding:6px 8px;background:#252540;border:1px solid #303048;border-radius:4px;color:#b8b8c8;font-size:.8rem"></div>
+<div class="stat"><span class="stat-label">HA Discovery</span>
+<label class="tog" onclick="togHA()"><span class="tog-bg" id="mqttHABg" style="background:#303048"></span><span class="tog-knob" id="mqttHAKnob" style="left:2px"></span><input type="hidden" id="mqttHA" value="0"></label></div>
+<div style="display:flex;gap:8px;margin-top:12px">
+<button class="btn" style="flex:1" id="mqttTestBtn" onclick="mqttTest()">Test</button>
+<button class="btn" style="flex:1" id="mqttSaveBtn" onclick="mqttSave()" disabled>Save</button>
+<button class="btn" style="flex:1;background:#7f1d1d;color:#fca5a5" id="mqttResetBtn" onclick="mqttReset()">Reset</button>
+</div>
+<p style="font-size:.6rem;color:#505068;margin-top:8px">Publishes to: <span id="mqttPubTopic">-</span></p>
+</div></div>
+<div class="card"><div class="card-title collapsible collapsed" id="sysT" onclick="T('sys')"><span>System</span><span class="toggle">▼</span></div>
+<div class="card-body collapsed" id="sysB">
+<div class="stat"><span class="stat-label">Architecture</span><span class="stat-val">Dual Core ESP32-S3</span></div>
+<div class="stat"><span class="stat-label">CPU Freq</span><span class="stat-val" id="cpufreq">-</span></div>
+<div class="stat"><span class="stat-label">Free Heap</span><span class="stat-val" id="heap">-</span></div>
+<div class="stat"><span class="stat-label">Min Free Heap</span><span class="stat-val" id="minheap">-</span></div>
+<div class="stat"><span class="stat-label">Flash Size</span><span class="stat-val" id="flash">-</span></div>
+<div class="stat"><span class="stat-label">Sketch Size</span><span class="stat-val" id="sketch">-</span></div>
+<div class="stat"><span class="stat-label">Chip Temp</span><span class="stat-val" id="temp">-</span></div>
+<div class="stat"><span class="stat-label">OTA Updates</span><span class="stat-val good">Enabled</span></div>
+<div class="stat"><span class="stat-label">Firmware</span><span class="stat-val" id="fw">-</span></div>
+</div></div>
+<div class="card"><div class="card-title collapsible collapsed" id="diagT" onclick="T('diag')"><span>Diagnostics</span><span class="toggle">▼</span></div>
+<div class="card-body collapsed" id="diagB">
+<div class="stat"><span class="stat-label">LED FPS</span><span class="stat-val" id="fps">-</span></div>
+<div class="stat"><span class="stat-label">Frame Time</span><span class="stat-val" id="frameus">-</span></div>
+<div class="stat"><span class="stat-label">Max Frame Time</span><span class="stat-val" id="maxframeus">-</span></div>
+<div class="stat"><span class="stat-label">LED Stack Free</span><span class="stat-val" id="ledstack">-</span></div>
+<div class="stat"><span class="stat-label">Net Stack Free</span><span class="stat-val" id="netstack">-</span></div>
+<div class="stat"><span class="stat-label">State Lock (max)</span><span class="stat-val" id="slock">-</span></div>
+<div class="stat"><span class="stat-label">CPU Core 0 / 1</span><span class="stat-val" id="cpu">-</span></div>
+<div class="stat"><span class="stat-label">HTTP p50 / p95</span><span class="stat-val" id="httplat">-</span></div>
+</div></div>
+<div class="card"><div class="card-title">Danger Zone</div>
+<button class="btn btn-danger" style="width:100%" onclick="factoryReset()">Factory Reset</button>
+<p style="font-size:.65rem;color:#707088;margin-top:8px;text-align:center">Clears WiFi, password, and all settings</p>
+</div></div>
+{{modal}}
+<script src="{{jsPath}}"></script></body></html>
 )rawliteral";
 
 #endif
@@ -7,6 +7,9 @@
  * 
  * Provides styled modal dialogs replacing browser alert/confirm dialogs.
  * Includes showModal(), showAlert(), showSuccess(), showError(), showConfirm().
+ *
+ * MODAL_JS is bundled into the dashboard script (ui_assets.h); rerun
+ * tools/build_assets.py after editing it.
  */
 
 // ===========================================
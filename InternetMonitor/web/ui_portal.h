@@ -7,6 +7,9 @@
  * 
  * UI for the captive portal shown during initial device setup.
  * Displays available WiFi networks and credential input form.
+ *
+ * PORTAL_CSS/PORTAL_JS are served gzipped from ui_assets.h; rerun
+ * tools/build_assets.py after editing them.
  */
 
 // Portal CSS - matches existing dark theme
@@ -124,4 +127,32 @@ function connect(){
 document.addEventListener('keyup',e=>{if(e.key==='Enter'&&ssid)connect();});
 )rawliteral";
 
+// Portal page (rendered by renderTemplate(), see fillPortal() in portal.h)
+const char PORTAL_HTML[] PROGMEM = R"rawliteral(<!DOCTYPE html><html><head>
+<meta charset='UTF-8'>
+<meta name='viewport' content='width=device-width,initial-scale=1'>
+<title>WiFi Setup</title>
+<link rel='stylesheet' href='{{cssPath}}'>
+</head><body><div class='wrap'>
+<h1>Internet Monitor</h1>
+<p class='sub'>WIFI SETUP</p>
+<div class='card'><div class='card-title'>Select Network</div>
+<div id='networks'>{{networks}}</div>
+<button class='btn scan' onclick='scan(event)'>Scan Again</button>
+</div>
+<div class='card' id='pwcard' style='display:none'>
+<div class='card-title'>Enter Password</div>
+<p id='selssid'></p>
+<input type='password' id='pw' placeholder='WiFi Password'>
+</div>
+<div class='card'>
+<div class='card-title'>Dashboard Password</div>
+<input type='password' id='adminpw' placeholder='Admin password (default: admin)'>
+<p style='font-size:.7rem;color:#707088;margin-top:8px'>Leave blank to use default password: admin</p>
+<button class='btn connect' onclick='connect()'>Connect</button>
+</div>
+<div class='status' id='status'></div>
+</div><script src='{{jsPath}}'></script></body></html>
+)rawliteral";
+
 #endif
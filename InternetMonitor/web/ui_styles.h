@@ -202,6 +202,7 @@ const char CSS_FOOTER[] PROGMEM = R"rawliteral(
 // ===========================================
 // MODAL DIALOG
 // ===========================================
+// Also bundled into the dashboard stylesheet (tools/build_assets.py)
 
 const char CSS_MODAL[] PROGMEM = R"rawliteral(
 .modal-overlay{display:none;position:fixed;top:0;left:0;right:0;bottom:0;background:rgba(0,0,0,.7);z-index:1000;align-items:center;justify-content:center;padding:16px;backdrop-filter:blur(4px)}
@@ -258,7 +259,7 @@ h1{font-size:2rem}
 //   server.sendContent("</style>");
 
 inline void sendCommonStyles() {
-  extern WebServer server;
+  extern HttpServer server;
   server.sendContent(FPSTR(CSS_BASE));
   server.sendContent(FPSTR(CSS_TYPOGRAPHY));
   server.sendContent(FPSTR(CSS_LAYOUT));
@@ -275,7 +276,7 @@ inline void sendCommonStyles() {
 // For pages that need effect-specific styles too:
 inline void sendDashboardStyles() {
   sendCommonStyles();
-  extern WebServer server;
+  extern HttpServer server;
   server.sendContent(FPSTR(CSS_EFFECTS));
 }
 
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""
+Build the gzipped static assets (CSS/JS bundles, pages) served by the web UI.
+
+The CSS/JS sources stay as PROGMEM raw literals in InternetMonitor/web/ui_*.h.
+This script pulls the literals listed in ASSETS out of those headers,
+concatenates each bundle, gzips it and writes InternetMonitor/web/ui_assets.h:
+
+    - one PROGMEM byte array per bundle
+    - a content hash, used in the URL (/assets/dashboard.<hash>.css) and as
+      the ETag, so the device can send long-lived Cache-Control headers and
+      a changed bundle gets a new URL
+
+A page (the dashboard HTML) keeps a fixed route instead, is revalidated
+on every view (ETag -> 304), and may use {{key}} placeholders that are
+filled here: another bundle's URL ("name.ext") or a literal.
+
+Run it after editing a ui_*.h literal and commit the result:
+    python3 tools/build_assets.py
+
+    --check   exit 1 if ui_assets.h is out of date (nothing written)
+"""
+
+import argparse
+import gzip
+import hashlib
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+WEB = ROOT / "InternetMonitor" / "web"
+OUTPUT = WEB / "ui_assets.h"
+
+# name, extension, content type, [(header, literal), ...] in page order,
+# optional page options: {"route": url, "fill": {key: "name.ext" | (header, literal)}}
+# Pages come after the bundles they link to.
+ASSETS = [
+    ("dashboard", "css", "text/css", [
+        ("ui_dashboard.h", "DASHBOARD_CSS"),
+        ("ui_styles.h", "CSS_MODAL"),
+    ]),
+    ("dashboard", "js", "application/javascript", [
+        ("ui_modal.h", "MODAL_JS"),
+        ("ui_dashboard.h", "DASHBOARD_JS"),
+    ]),
+    ("portal", "css", "text/css", [
+        ("ui_portal.h", "PORTAL_CSS"),
+    ]),
+    ("portal", "js", "application/javascript", [
+        ("ui_portal.h", "PORTAL_JS"),
+    ]),
+    ("dashboard", "html", "text/html", [
+        ("ui_dashboard.h", "DASHBOARD_HTML"),
+    ], {
+        "route": "/",
+        "fill": {
+            "cssPath": "dashboard.css",
+            "jsPath": "dashboard.js",
+            "modal": ("ui_modal.h", "MODAL_HTML"),
+        },
+    }),
+]
+
+IMMUTABLE = "public, max-age=31536000, immutable"
+REVALIDATE = "no-cache"
+
+LITERAL = r'const char {name}\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral";'
+
+
+def read_literal(header, name):
+    text = (WEB / header).read_text(encoding="utf-8")
+    match = re.search(LITERAL.format(name=re.escape(name)), text, re.S)
+    if not match:
+        sys.exit(f"{header}: no raw literal {name}")
+    return match.group(1)
+
+
+def fill(text, values, paths):
+    def value(match):
+        key = match.group(1)
+        if key not in values:
+            sys.exit(f"no value for {{{{{key}}}}}")
+        ref = values[key]
+        return paths[ref] if isinstance(ref, str) else read_literal(*ref)
+    return re.sub(r"\{\{(\w+)\}\}", value, text)
+
+
+def c_bytes(data, indent="  ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        chunk = data[i:i + per_line]
+        lines.append(indent + ",".join(f"0x{b:02x}" for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def build():
+    blocks = []
+    table = []
+    report = []
+
+    paths = {}
+
+    for index, (name, ext, content_type, parts, *options) in enumerate(ASSETS):
+        page = options[0] if options else {}
+        source = "".join(read_literal(h, lit) for h, lit in parts)
+        if page.get("fill"):
+            source = fill(source, page["fill"], paths)
+        source = source.encode("utf-8")
+        digest = hashlib.sha256(source).hexdigest()[:8]
+        # mtime=0 keeps the output identical for identical input
+        packed = gzip.compress(source, compresslevel=9, mtime=0)
+
+        symbol = f"ASSET_{name.upper()}_{ext.upper()}"
+        path = page.get("route", f"/assets/{name}.{digest}.{ext}")
+        paths[f"{name}.{ext}"] = path
+        cache = REVALIDATE if "route" in page else IMMUTABLE
+        sources = ", ".join(lit for _, lit in parts)
+
+        blocks.append(
+            f"// {sources}: {len(source)} -> {len(packed)} bytes\n"
+            f"#define {symbol}_PATH \"{path}\"\n"
+            f"#define {symbol}_INDEX {index}\n"
+            f"static const uint8_t {symbol}_GZ[] PROGMEM = {{\n"
+            f"{c_bytes(packed)}\n"
+            f"}};\n")
+        table.append(
+            f"  {{{symbol}_PATH, \"{content_type}\", \"\\\"{digest}\\\"\", \"{cache}\", "
+            f"{symbol}_GZ, sizeof({symbol}_GZ)}},")
+        report.append(f"{path:32} {len(source):6} -> {len(packed):5} bytes")
+
+    text = f"""#ifndef UI_ASSETS_H
+#define UI_ASSETS_H
+
+/**
+ * @file ui_assets.h
+ * @brief Gzipped CSS/JS bundles and pages (generated by tools/build_assets.py)
+ *
+ * Do not edit: change the literals in ui_*.h and rerun the script.
+ * Served by sendAsset() (handlers.h) with Content-Encoding: gzip;
+ * hashed /assets/ URLs by registerAssetRoutes(), pages by their handler.
+ */
+
+#include <Arduino.h>
+
+struct UiAsset {{
+  const char* path;         // Hashed /assets/ URL, or a page's route
+  const char* type;
+  const char* etag;         // Quoted content hash
+  const char* cacheControl; // Immutable for hashed URLs, revalidate for pages
+  const uint8_t* data;      // Gzipped, PROGMEM
+  size_t length;
+}};
+
+{chr(10).join(blocks)}
+static const UiAsset uiAssets[] = {{
+{chr(10).join(table)}
+}};
+#define UI_ASSET_COUNT (sizeof(uiAssets) / sizeof(uiAssets[0]))
+
+#endif // UI_ASSETS_H
+"""
+    return text, report
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--check", action="store_true",
+                        help="fail if ui_assets.h is out of date")
+    args = parser.parse_args()
+
+    text, report = build()
+    current = OUTPUT.read_text(encoding="utf-8") if OUTPUT.exists() else ""
+
+    if args.check:
+        if current != text:
+            print(f"{OUTPUT.relative_to(ROOT)} is out of date, run tools/build_assets.py")
+            return 1
+        print(f"{OUTPUT.relative_to(ROOT)} is up to date")
+        return 0
+
+    for line in report:
+        print(line)
+    if current == text:
+        print(f"{OUTPUT.relative_to(ROOT)} unchanged")
+    else:
+        OUTPUT.write_text(text, encoding="utf-8")
+        print(f"Wrote {OUTPUT.relative_to(ROOT)}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""
+Local SNTP server for testing the Internet Monitor clock service.
+
+Answers SNTP v3/v4 client requests with this machine's time, optionally
+shifted and skewed so the device's drift tracking and holdover can be
+exercised without waiting days for a real oscillator to wander:
+
+    --offset S     add S seconds to every answer (simulates a step)
+    --drift PPM    let the served clock run PPM parts per million fast
+                   (negative = slow) from the moment the server starts
+    --drop N       ignore every Nth request (exercises the fallback)
+
+Usage (port 123 usually needs root):
+    sudo python3 tools/ntp_server.py [--port 123] [--drift 50]
+
+Then point the device at it:
+    curl -X POST http://<device>/time -b <session cookie> -d '{"server":"<pc ip>"}'
+    curl http://<device>/time -b <session cookie>
+
+After two syncs at least NTP_DRIFT_MIN_MS apart, /time should report a
+driftPpm close to --drift.
+"""
+
+import argparse
+import socket
+import struct
+import time
+
+NTP_EPOCH = 2208988800  # 1900-01-01 to 1970-01-01 in seconds
+PACKET = struct.Struct("!BBbb11I")
+
+
+def to_ntp(t):
+    secs = int(t)
+    frac = int((t - secs) * (1 << 32)) & 0xFFFFFFFF
+    return (secs + NTP_EPOCH) & 0xFFFFFFFF, frac
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=123)
+    parser.add_argument("--offset", type=float, default=0.0)
+    parser.add_argument("--drift", type=float, default=0.0)
+    parser.add_argument("--drop", type=int, default=0)
+    args = parser.parse_args()
+
+    start = time.time()
+
+    def served_time():
+        now = time.time()
+        return now + args.offset + (now - start) * args.drift / 1e6
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("0.0.0.0", args.port))
+    print(f"SNTP server on :{args.port} (offset {args.offset:+.3f} s, drift {args.drift:+.1f} ppm, Ctrl+C to stop)")
+
+    count = 0
+    try:
+        while True:
+            data, addr = sock.recvfrom(512)
+            receive = served_time()
+            if len(data) < PACKET.size:
+                continue
+            count += 1
+            if args.drop and count % args.drop == 0:
+                print(f"{addr[0]}: request {count} dropped")
+                continue
+
+            first = data[0]
+            version = (first >> 3) & 0x7
+            mode = first & 0x7
+            if mode != 3:  # client
+                continue
+
+            # Originate timestamp = client's transmit timestamp (bytes 40-47)
+            orig_secs, orig_frac = struct.unpack("!II", data[40:48])
+            ref_secs, ref_frac = to_ntp(start + args.offset)
+            recv_secs, recv_frac = to_ntp(receive)
+            xmit_secs, xmit_frac = to_ntp(served_time())
+
+            reply = PACKET.pack(
+                (0 << 6) | (version << 3) | 4,  # LI none, client's version, mode server
+                1,                               # stratum 1 (primary reference)
+                6,                               # poll 64 s
+                -20,                             # precision ~1 us
+                0,                               # root delay
+                0,                               # root dispersion
+                struct.unpack("!I", b"LOCL")[0], # reference id
+                ref_secs, ref_frac,
+                orig_secs, orig_frac,
+                recv_secs, recv_frac,
+                xmit_secs, xmit_frac,
+            )
+            sock.sendto(reply, addr)
+            stamp = time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime(receive))
+            print(f"{addr[0]}: served {stamp}")
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
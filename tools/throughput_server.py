@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""
+Local endpoint for testing the Internet Monitor throughput test.
+
+    GET  /download?bytes=N   streams N bytes (default 10 MB)
+    POST /upload             reads and discards the request body
+
+Usage:
+    python3 tools/throughput_server.py [--port 8080]
+
+Then point the device at it:
+    curl -X POST http://<device>/throughput/config -b <session cookie> \
+      -d '{"download":"http://<pc>:8080/download?bytes=5242880",
+           "upload":"http://<pc>:8080/upload","uploadEnabled":true}'
+    curl -X POST http://<device>/throughput/run -b <session cookie>
+
+Each transfer is logged with the rate the server saw, to compare with
+the device's /throughput result.
+"""
+
+import argparse
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+CHUNK = 64 * 1024
+DEFAULT_BYTES = 10 * 1024 * 1024
+
+
+def mbps(nbytes, seconds):
+    return (nbytes * 8 / seconds / 1e6) if seconds > 0 else 0.0
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+
+    def do_GET(self):
+        url = urlparse(self.path)
+        if url.path != "/download":
+            self.send_error(404)
+            return
+
+        query = parse_qs(url.query)
+        total = int(query.get("bytes", [DEFAULT_BYTES])[0])
+
+        self.send_response(200)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(total))
+        self.send_header("Connection", "close")
+        self.end_headers()
+
+        block = b"\xa5" * CHUNK
+        sent = 0
+        start = time.monotonic()
+        try:
+            while sent < total:
+                n = min(CHUNK, total - sent)
+                self.wfile.write(block[:n])
+                sent += n
+        except (BrokenPipeError, ConnectionResetError):
+            pass  # Device stops reading once it has cfg.sizeBytes
+        elapsed = time.monotonic() - start
+        self.log_message("download %d bytes in %.2f s (%.2f Mbps)", sent, elapsed, mbps(sent, elapsed))
+
+    def do_POST(self):
+        if urlparse(self.path).path != "/upload":
+            self.send_error(404)
+            return
+
+        total = int(self.headers.get("Content-Length", 0))
+        received = 0
+        start = time.monotonic()
+        while received < total:
+            data = self.rfile.read(min(CHUNK, total - received))
+            if not data:
+                break
+            received += len(data)
+        elapsed = time.monotonic() - start
+
+        body = b"ok\n"
+        self.send_response(200)
+        self.send_header("Content-Type", "text/plain")
+        self.send_header("Content-Length", str(len(body)))
+        self.send_header("Connection", "close")
+        self.end_headers()
+        self.wfile.write(body)
+        self.log_message("upload %d bytes in %.2f s (%.2f Mbps)", received, elapsed, mbps(received, elapsed))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=8080)
+    args = parser.parse_args()
+
+    server = ThreadingHTTPServer(("0.0.0.0", args.port), Handler)
+    print(f"Throughput test server on :{args.port} (Ctrl+C to stop)")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+"""
+Load-test the web task on the host and profile its heap use per request.
+
+Builds tools/web_bench/web_bench.cpp (the whole sketch against the stubs
+in tools/web_bench/mock/, with the real HTTP server and handlers on a
+host socket), replays request mixes from tools/web_bench/mixes/ and
+prints, per request, the allocations and bytes the web task took, then
+requests/s, latency percentiles and the heap peak under load.
+
+Usage:
+    python3 tools/web_bench.py                        all mixes
+    python3 tools/web_bench.py dashboard sliders      named mixes
+    python3 tools/web_bench.py --save baseline.json   keep the results
+    python3 tools/web_bench.py --compare baseline.json
+
+    --compare  exit 1 if any request (or the load pass) takes more
+               allocations or bytes than the baseline, beyond --tolerance;
+               timings are printed but never fail the run
+
+Every run exits 1 if a reply failed or had a status other than the one
+its mix line expects (any 2xx/304, or "= N" under the line).
+
+Needs g++ (C++17) and ArduinoJson 7 (the library the sketch builds with):
+--arduinojson DIR, $ARDUINOJSON, or ~/Arduino/libraries/ArduinoJson/src.
+Byte counts are from a 64-bit host and run higher than on the device;
+compare runs with each other.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+SKETCH = ROOT / "InternetMonitor"
+BENCH = ROOT / "tools" / "web_bench"
+MIXES = BENCH / "mixes"
+BUILD = BENCH / "build"
+BINARY = BUILD / "web_bench"
+
+# ArduinoJson's Arduino glue: String in and out, no Stream/Print/PROGMEM
+DEFINES = [
+    "-DARDUINOJSON_ENABLE_ARDUINO_STRING=1",
+    "-DARDUINOJSON_ENABLE_ARDUINO_STREAM=0",
+    "-DARDUINOJSON_ENABLE_ARDUINO_PRINT=0",
+    "-DARDUINOJSON_ENABLE_PROGMEM=0",
+]
+
+# Slack on top of --tolerance, so a request with a tiny baseline doesn't
+# fail on one extra block
+SLACK_ALLOCS = 0.5
+SLACK_BYTES = 32
+
+
+def find_arduinojson(option):
+    candidates = [option, os.environ.get("ARDUINOJSON"),
+                  str(Path.home() / "Arduino" / "libraries" / "ArduinoJson" / "src")]
+    for path in candidates:
+        if path and (Path(path) / "ArduinoJson.h").exists():
+            return Path(path)
+    return None
+
+
+def newest_source():
+    files = [p for d in (SKETCH, BENCH / "mock") for p in d.rglob("*") if p.is_file()]
+    files.append(BENCH / "web_bench.cpp")
+    return max(p.stat().st_mtime for p in files)
+
+
+def build(args):
+    if not args.rebuild and BINARY.exists() and BINARY.stat().st_mtime >= newest_source():
+        return True
+
+    json_dir = find_arduinojson(args.arduinojson)
+    if json_dir is None:
+        print("ArduinoJson not found: pass --arduinojson DIR (the library's src/) or set $ARDUINOJSON")
+        return False
+    cxx = os.environ.get("CXX", "g++")
+    if shutil.which(cxx) is None:
+        print(f"{cxx} not found")
+        return False
+
+    BUILD.mkdir(exist_ok=True)
+    # Warnings stay on: the build is also a host compile of the sketch.
+    # Unused parameters are FreeRTOS/ESP-IDF callback signatures.
+    cmd = [cxx, "-std=gnu++17", "-O2", "-g", "-pthread", "-Wall", "-Wextra", "-Wno-unused-parameter", *DEFINES,
+           f"-I{BENCH / 'mock'}", f"-I{SKETCH}", f"-I{json_dir}",
+           *args.cxxflags.split(), str(BENCH / "web_bench.cpp"), "-o", str(BINARY)]
+    print(f"Building {BINARY.relative_to(ROOT)}")
+    return subprocess.run(cmd).returncode == 0
+
+
+def mix_files(names):
+    if not names:
+        return sorted(MIXES.glob("*.mix"))
+    files = []
+    for name in names:
+        path = Path(name)
+        if not path.exists():
+            path = MIXES / (name if name.endswith(".mix") else name + ".mix")
+        if not path.exists():
+            raise SystemExit(f"no mix {name} (have: {', '.join(p.stem for p in sorted(MIXES.glob('*.mix')))})")
+        files.append(path)
+    return files
+
+
+def run(args, mixes):
+    report = BUILD / "last.json"
+    cmd = [str(BINARY), "--clients", str(args.clients), "--seconds", str(args.seconds),
+           "--repeat", str(args.repeat), "--password", args.password, "--json", str(report)]
+    if args.no_load:
+        cmd.append("--no-load")
+    if args.verbose:
+        cmd.append("--verbose")
+    cmd += [str(m) for m in mixes]
+
+    # 1: the report is written but some replies failed or had the wrong status
+    env = dict(os.environ, WEB_BENCH_PORT=str(args.port))
+    report.unlink(missing_ok=True)
+    code = subprocess.run(cmd, env=env).returncode
+    if code not in (0, 1) or not report.exists():
+        return None, code
+    return json.loads(report.read_text(encoding="utf-8")), code
+
+
+def profile_keys(results):
+    """(mix, request, n): the nth identical line in a mix"""
+    seen = {}
+    rows = {}
+    for row in results.get("profile", []):
+        key = (row["mix"], row["request"])
+        seen[key] = seen.get(key, 0) + 1
+        rows[key + (seen[key],)] = row
+    return rows
+
+
+def worse(new, old, tolerance, slack):
+    return new > old * (1 + tolerance / 100) + slack
+
+
+def compare(results, baseline, tolerance):
+    failures = []
+    old_rows = profile_keys(baseline)
+    for key, row in profile_keys(results).items():
+        old = old_rows.get(key)
+        if old is None:
+            continue
+        label = f"[{key[0]}] {key[1]}"
+        if worse(row["allocs_per_req"], old["allocs_per_req"], tolerance, SLACK_ALLOCS):
+            failures.append(f"{label}: {old['allocs_per_req']:.1f} -> {row['allocs_per_req']:.1f} allocs")
+        if worse(row["bytes_per_req"], old["bytes_per_req"], tolerance, SLACK_BYTES):
+            failures.append(f"{label}: {old['bytes_per_req']:.0f} -> {row['bytes_per_req']:.0f} bytes")
+
+    # The load pass is one number over every mix, so only the same set compares
+    mixes = {row["mix"] for row in results.get("profile", [])}
+    old_mixes = {row["mix"] for row in baseline.get("profile", [])}
+    load, old_load = results.get("load"), baseline.get("load")
+    if load and old_load and mixes == old_mixes:
+        if worse(load["allocs_per_req"], old_load["allocs_per_req"], tolerance, SLACK_ALLOCS):
+            failures.append(f"load: {old_load['allocs_per_req']:.1f} -> {load['allocs_per_req']:.1f} allocs/request")
+        if worse(load["bytes_per_req"], old_load["bytes_per_req"], tolerance, SLACK_BYTES):
+            failures.append(f"load: {old_load['bytes_per_req']:.0f} -> {load['bytes_per_req']:.0f} bytes/request")
+        print(f"\nvs baseline: {old_load['rps']:.0f} -> {load['rps']:.0f} requests/s, "
+              f"p99 {old_load['p99_ms']:.2f} -> {load['p99_ms']:.2f} ms, "
+              f"peak {old_load['peak_live']} -> {load['peak_live']} B")
+
+    if failures:
+        print(f"\nHeap regressions (over {tolerance:g}%):")
+        for line in failures:
+            print(f"  {line}")
+        return 1
+    print(f"No heap regressions (tolerance {tolerance:g}%)")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("mixes", nargs="*", help="mix names or files (default: all in mixes/)")
+    parser.add_argument("--clients", type=int, default=4, help="connections in the load pass")
+    parser.add_argument("--seconds", type=int, default=10, help="load pass length")
+    parser.add_argument("--repeat", type=int, default=50, help="requests per mix line when profiling")
+    parser.add_argument("--no-load", action="store_true", help="profile only")
+    parser.add_argument("--password", default="admin", help="web password for /login")
+    parser.add_argument("--port", type=int, default=18080, help="local port for the server")
+    parser.add_argument("--arduinojson", help="ArduinoJson src/ directory")
+    parser.add_argument("--cxxflags", default="", help="extra compiler flags (e.g. \"-O0 -g\")")
+    parser.add_argument("--rebuild", action="store_true", help="build even if up to date")
+    parser.add_argument("--verbose", action="store_true", help="show the sketch's Serial output")
+    parser.add_argument("--save", metavar="FILE", help="write the results as a baseline")
+    parser.add_argument("--compare", metavar="FILE", help="fail on heap regressions against FILE")
+    parser.add_argument("--tolerance", type=float, default=10, help="allowed growth in percent (default 10)")
+    args = parser.parse_args()
+
+    mixes = mix_files(args.mixes)
+    if not build(args):
+        return 2
+    results, code = run(args, mixes)
+    if results is None:
+        return 2
+    if code != 0:
+        return 1  # Measured error paths, not the mix: don't save or compare
+
+    if args.save:
+        Path(args.save).write_text(json.dumps(results, indent=2) + "\n", encoding="utf-8")
+        print(f"\nWrote {args.save}")
+    if args.compare:
+        baseline = json.loads(Path(args.compare).read_text(encoding="utf-8"))
+        return compare(results, baseline, args.tolerance)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
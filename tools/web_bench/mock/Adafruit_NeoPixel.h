@@ -0,0 +1,43 @@
+#ifndef WEB_BENCH_ADAFRUIT_NEOPIXEL_H
+#define WEB_BENCH_ADAFRUIT_NEOPIXEL_H
+
+/**
+ * @file Adafruit_NeoPixel.h
+ * @brief Pixel buffer with no strip attached
+ */
+
+#include <vector>
+#include "Arduino.h"
+
+#define NEO_RGB     0x06
+#define NEO_GRB     0x52
+#define NEO_KHZ800  0x0000
+
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t count, int16_t pin, uint16_t type) : _pixels(count, 0) {
+    (void)pin;
+    (void)type;
+  }
+  void begin() {}
+  void show() {}
+  void clear() { std::fill(_pixels.begin(), _pixels.end(), 0); }
+  void setBrightness(uint8_t b) { _brightness = b; }
+  uint8_t getBrightness() const { return _brightness; }
+  uint16_t numPixels() const { return _pixels.size(); }
+  void setPixelColor(uint16_t n, uint32_t c) { if (n < _pixels.size()) _pixels[n] = c; }
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) { setPixelColor(n, Color(r, g, b)); }
+  uint32_t getPixelColor(uint16_t n) const { return n < _pixels.size() ? _pixels[n] : 0; }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) { return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b; }
+  static uint32_t ColorHSV(uint16_t hue, uint8_t sat = 255, uint8_t val = 255) {
+    (void)hue; (void)sat;
+    return Color(val, val, val);
+  }
+  static uint32_t gamma32(uint32_t c) { return c; }
+
+private:
+  std::vector<uint32_t> _pixels;
+  uint8_t _brightness = 255;
+};
+
+#endif // WEB_BENCH_ADAFRUIT_NEOPIXEL_H
@@ -0,0 +1,157 @@
+#ifndef WEB_BENCH_ARDUINO_H
+#define WEB_BENCH_ARDUINO_H
+
+/**
+ * @file Arduino.h
+ * @brief Host stand-in for the arduino-esp32 core (web bench only)
+ *
+ * Just enough of the core for the sketch to compile and its web task to
+ * run on a PC: String, Serial, timing, the ESP object and PROGMEM (which
+ * is plain memory here). GPIO, temperature and the hardware RNG return
+ * fixed or pseudo-random values.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <random>
+#include <thread>
+#include "WString.h"
+#include "Stream.h"
+#include "IPAddress.h"
+#include "bench_heap.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef int esp_err_t;
+
+#define ESP_OK    0
+#define ESP_FAIL  -1
+
+#define PI        3.1415926535897932384626433832795
+#define HEX       16
+#define DEC       10
+#define LOW       0
+#define HIGH      1
+#define INPUT     0x01
+#define OUTPUT    0x03
+#define INPUT_PULLUP 0x05
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+// ===========================================
+// PROGMEM
+// ===========================================
+// Flash and RAM are the same address space on the ESP32 and here
+
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#if defined(__GLIBC__) && (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+inline size_t strlcat(char* dst, const char* src, size_t size) {
+  size_t len = strnlen(dst, size);
+  return len + strlcpy(dst + len, src, size > len ? size - len : 0);
+}
+#endif
+
+// ===========================================
+// TIMING
+// ===========================================
+
+inline std::chrono::steady_clock::time_point benchBootTime = std::chrono::steady_clock::now();
+
+inline int64_t esp_timer_get_time() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now() - benchBootTime).count();
+}
+
+inline unsigned long millis() { return (unsigned long)(esp_timer_get_time() / 1000); }
+inline unsigned long micros() { return (unsigned long)esp_timer_get_time(); }
+inline void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline void delayMicroseconds(unsigned int us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+inline void yield() { std::this_thread::yield(); }
+
+// ===========================================
+// RANDOM
+// ===========================================
+
+inline std::mt19937& benchRng() {
+  static thread_local std::mt19937 rng(std::random_device{}());
+  return rng;
+}
+
+inline uint32_t esp_random() { return benchRng()(); }
+inline void esp_fill_random(void* buf, size_t len) {
+  for (size_t i = 0; i < len; i++) ((uint8_t*)buf)[i] = esp_random();
+}
+inline void randomSeed(unsigned long seed) { benchRng().seed(seed); }
+inline long random(long howbig) { return howbig > 0 ? esp_random() % howbig : 0; }
+inline long random(long howsmall, long howbig) {
+  return howsmall < howbig ? howsmall + random(howbig - howsmall) : howsmall;
+}
+
+// ===========================================
+// MATH
+// ===========================================
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+template <typename T, typename L, typename H>
+inline auto constrain(T x, L low, H high) -> decltype(x + low + high) {
+  return x < low ? low : (x > high ? high : x);
+}
+
+// ===========================================
+// HARDWARE
+// ===========================================
+
+inline void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+inline int digitalRead(uint8_t pin) { (void)pin; return HIGH; }   // BOOT button not pressed
+inline void digitalWrite(uint8_t pin, uint8_t value) { (void)pin; (void)value; }
+inline float temperatureRead() { return 41.5f; }
+
+class EspClass {
+public:
+  void restart() { Serial.println("[bench] ESP.restart() ignored"); }
+  uint32_t getFreeHeap() { return benchHeapFree(); }
+  uint32_t getMinFreeHeap() { return (uint32_t)benchHeap.minFree.load(); }
+  uint32_t getHeapSize() { return BENCH_HEAP_SIZE; }
+  uint32_t getMaxAllocHeap() { return benchHeapFree(); }
+  uint32_t getCpuFreqMHz() { return 240; }
+  uint32_t getCycleCount() { return (uint32_t)(esp_timer_get_time() * 240); }
+  uint32_t getFlashChipSize() { return 8 * 1024 * 1024; }
+  uint32_t getSketchSize() { return 1100000; }
+  uint64_t getEfuseMac() { return 0x0000aabbccddeeffULL; }
+};
+
+inline EspClass ESP;
+
+#endif // WEB_BENCH_ARDUINO_H
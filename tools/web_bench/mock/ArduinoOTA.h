@@ -0,0 +1,28 @@
+#ifndef WEB_BENCH_ARDUINOOTA_H
+#define WEB_BENCH_ARDUINOOTA_H
+
+/**
+ * @file ArduinoOTA.h
+ * @brief OTA service that never receives an update
+ */
+
+#include <functional>
+#include "Arduino.h"
+
+typedef int ota_error_t;
+
+class ArduinoOTAClass {
+public:
+  ArduinoOTAClass& setHostname(const char* name) { (void)name; return *this; }
+  ArduinoOTAClass& setPassword(const char* pass) { (void)pass; return *this; }
+  ArduinoOTAClass& onStart(std::function<void()> fn) { (void)fn; return *this; }
+  ArduinoOTAClass& onEnd(std::function<void()> fn) { (void)fn; return *this; }
+  ArduinoOTAClass& onProgress(std::function<void(unsigned int, unsigned int)> fn) { (void)fn; return *this; }
+  ArduinoOTAClass& onError(std::function<void(ota_error_t)> fn) { (void)fn; return *this; }
+  void begin() {}
+  void handle() {}
+};
+
+inline ArduinoOTAClass ArduinoOTA;
+
+#endif // WEB_BENCH_ARDUINOOTA_H
@@ -0,0 +1,21 @@
+#ifndef WEB_BENCH_DNSSERVER_H
+#define WEB_BENCH_DNSSERVER_H
+
+/**
+ * @file DNSServer.h
+ * @brief Captive-portal DNS server that answers nothing
+ */
+
+#include "WiFi.h"
+
+class DNSServer {
+public:
+  bool start(uint16_t port, const String& domain, const IPAddress& ip) {
+    (void)port; (void)domain; (void)ip;
+    return true;
+  }
+  void processNextRequest() {}
+  void stop() {}
+};
+
+#endif // WEB_BENCH_DNSSERVER_H
@@ -0,0 +1,58 @@
+#ifndef WEB_BENCH_HTTPCLIENT_H
+#define WEB_BENCH_HTTPCLIENT_H
+
+/**
+ * @file HTTPClient.h
+ * @brief HTTP client whose requests all fail to connect
+ */
+
+#include "WiFi.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED  (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED  (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED       (-4)
+#define HTTPC_ERROR_CONNECTION_LOST     (-5)
+#define HTTPC_ERROR_NO_STREAM           (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER      (-7)
+#define HTTPC_ERROR_READ_TIMEOUT        (-11)
+
+class HTTPClient {
+public:
+  bool begin(const String& url) { (void)url; return true; }
+  bool begin(WiFiClient& client, const String& url) { (void)client; (void)url; return true; }
+  bool begin(WiFiClient& client, const char* host, uint16_t port, const char* uri) {
+    (void)client; (void)host; (void)port; (void)uri;
+    return true;
+  }
+  void end() {}
+  int GET() { return HTTPC_ERROR_CONNECTION_REFUSED; }
+  int POST(const String& body) { (void)body; return HTTPC_ERROR_CONNECTION_REFUSED; }
+  int POST(uint8_t* body, size_t size) { (void)body; (void)size; return HTTPC_ERROR_CONNECTION_REFUSED; }
+  int sendRequest(const char* method, uint8_t* body, size_t size) {
+    (void)method; (void)body; (void)size;
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+  int sendRequest(const char* method, Stream* stream, size_t size) {
+    (void)method; (void)stream; (void)size;
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+  void setReuse(bool reuse) { (void)reuse; }
+  void setConnectTimeout(int32_t ms) { (void)ms; }
+  void setTimeout(uint16_t ms) { (void)ms; }
+  void useHTTP10(bool on) { (void)on; }
+  void addHeader(const String& name, const String& value) { (void)name; (void)value; }
+  void collectHeaders(const char** keys, size_t count) { (void)keys; (void)count; }
+  String header(const char* name) { (void)name; return String(); }
+  bool connected() { return false; }
+  int getSize() { return -1; }
+  String getString() { return String(); }
+  WiFiClient* getStreamPtr() { return nullptr; }
+  WiFiClient& getStream() { return _client; }
+  static String errorToString(int error) { (void)error; return String("connection refused"); }
+
+private:
+  WiFiClient _client;
+};
+
+#endif // WEB_BENCH_HTTPCLIENT_H
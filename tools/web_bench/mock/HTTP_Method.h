@@ -0,0 +1,16 @@
+#ifndef WEB_BENCH_HTTP_METHOD_H
+#define WEB_BENCH_HTTP_METHOD_H
+
+// Same values as arduino-esp32's (from http_parser)
+enum HTTPMethod {
+  HTTP_DELETE = 0,
+  HTTP_GET = 1,
+  HTTP_HEAD = 2,
+  HTTP_POST = 3,
+  HTTP_PUT = 4,
+  HTTP_OPTIONS = 6,
+  HTTP_PATCH = 28,
+};
+#define HTTP_ANY ((HTTPMethod)255)
+
+#endif // WEB_BENCH_HTTP_METHOD_H
@@ -0,0 +1,51 @@
+#ifndef WEB_BENCH_IPADDRESS_H
+#define WEB_BENCH_IPADDRESS_H
+
+/**
+ * @file IPAddress.h
+ * @brief IPv4 address value type
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "WString.h"
+
+class IPAddress {
+public:
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+  IPAddress(uint32_t address) { memcpy(_bytes, &address, 4); }
+
+  bool fromString(const char* s) {
+    unsigned a, b, c, d;
+    char tail;
+    if (sscanf(s, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+      return false;
+    }
+    *this = IPAddress(a, b, c, d);
+    return true;
+  }
+  bool fromString(const String& s) { return fromString(s.c_str()); }
+
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+    return String(buf);
+  }
+
+  operator uint32_t() const {
+    uint32_t v;
+    memcpy(&v, _bytes, 4);
+    return v;
+  }
+  bool operator==(const IPAddress& o) const { return memcmp(_bytes, o._bytes, 4) == 0; }
+  bool operator!=(const IPAddress& o) const { return !(*this == o); }
+  uint8_t operator[](int i) const { return _bytes[i]; }
+  uint8_t& operator[](int i) { return _bytes[i]; }
+
+private:
+  uint8_t _bytes[4] = {0, 0, 0, 0};
+};
+
+#endif // WEB_BENCH_IPADDRESS_H
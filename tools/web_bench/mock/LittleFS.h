@@ -0,0 +1,55 @@
+#ifndef WEB_BENCH_LITTLEFS_H
+#define WEB_BENCH_LITTLEFS_H
+
+/**
+ * @file LittleFS.h
+ * @brief A filesystem that fails to mount
+ *
+ * The outage journal stays closed, so /outages answers from RAM only.
+ */
+
+#include "Arduino.h"
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+class File : public Stream {
+public:
+  size_t write(uint8_t c) override { (void)c; return 0; }
+  size_t write(const uint8_t* buf, size_t size) override { (void)buf; (void)size; return 0; }
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  size_t read(uint8_t* buf, size_t size) { (void)buf; (void)size; return 0; }
+  int peek() override { return -1; }
+  bool seek(uint32_t pos) { (void)pos; return false; }
+  size_t position() const { return 0; }
+  size_t size() const { return 0; }
+  void close() {}
+  operator bool() const { return false; }
+};
+
+class LittleFSFS {
+public:
+  bool begin(bool formatOnFail = false, const char* base = "/littlefs", uint8_t maxOpen = 10,
+             const char* label = "spiffs") {
+    (void)formatOnFail; (void)base; (void)maxOpen; (void)label;
+    return false;
+  }
+  void end() {}
+  File open(const char* path, const char* mode = FILE_READ, bool create = false) {
+    (void)path; (void)mode; (void)create;
+    return File();
+  }
+  bool exists(const char* path) { (void)path; return false; }
+  bool remove(const char* path) { (void)path; return false; }
+  bool rename(const char* from, const char* to) { (void)from; (void)to; return false; }
+  size_t totalBytes() { return 0; }
+  size_t usedBytes() { return 0; }
+  bool format() { return false; }
+};
+
+inline LittleFSFS LittleFS;
+
+#endif // WEB_BENCH_LITTLEFS_H
@@ -0,0 +1,116 @@
+#ifndef WEB_BENCH_PREFERENCES_H
+#define WEB_BENCH_PREFERENCES_H
+
+/**
+ * @file Preferences.h
+ * @brief NVS key-value store in memory (empty at start, lost on exit)
+ *
+ * Values read back as written. The store's own blocks stand in for NVS
+ * and are left out of the heap counts; Strings returned to the sketch
+ * are counted as usual.
+ */
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false) {
+    _ns = name;
+    _readOnly = readOnly;
+    return true;
+  }
+  void end() {}
+
+  bool clear() {
+    if (_readOnly) return false;
+    BenchUntracked untracked;
+    std::lock_guard<std::mutex> guard(lock());
+    auto& all = store();
+    for (auto it = all.begin(); it != all.end();) {
+      it = it->first.compare(0, _ns.size() + 1, _ns + ":") == 0 ? all.erase(it) : std::next(it);
+    }
+    return true;
+  }
+  bool remove(const char* key) {
+    if (_readOnly) return false;
+    BenchUntracked untracked;
+    std::lock_guard<std::mutex> guard(lock());
+    return store().erase(fullKey(key)) > 0;
+  }
+  bool isKey(const char* key) { return find(key, nullptr, 0) >= 0; }
+
+  size_t putBytes(const char* key, const void* value, size_t len) {
+    if (_readOnly) return 0;
+    BenchUntracked untracked;
+    std::lock_guard<std::mutex> guard(lock());
+    store()[fullKey(key)].assign((const uint8_t*)value, (const uint8_t*)value + len);
+    return len;
+  }
+  size_t getBytes(const char* key, void* buf, size_t maxLen) {
+    long n = find(key, buf, maxLen);
+    return n > 0 && (size_t)n <= maxLen ? n : 0;
+  }
+  size_t getBytesLength(const char* key) {
+    long n = find(key, nullptr, 0);
+    return n > 0 ? n : 0;
+  }
+
+  size_t putString(const char* key, const char* value) { return putBytes(key, value, strlen(value) + 1); }
+  size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+  String getString(const char* key, const String& defaultValue = String()) {
+    char buf[4000];
+    long n = find(key, buf, sizeof(buf));
+    return n > 0 && (size_t)n <= sizeof(buf) ? String(buf) : defaultValue;
+  }
+
+  size_t putBool(const char* key, bool v) { return putValue(key, (uint8_t)v); }
+  bool getBool(const char* key, bool d = false) { return getValue<uint8_t>(key, d) != 0; }
+  size_t putUChar(const char* key, uint8_t v) { return putValue(key, v); }
+  uint8_t getUChar(const char* key, uint8_t d = 0) { return getValue(key, d); }
+  size_t putUShort(const char* key, uint16_t v) { return putValue(key, v); }
+  uint16_t getUShort(const char* key, uint16_t d = 0) { return getValue(key, d); }
+  size_t putInt(const char* key, int32_t v) { return putValue(key, v); }
+  int32_t getInt(const char* key, int32_t d = 0) { return getValue(key, d); }
+  size_t putUInt(const char* key, uint32_t v) { return putValue(key, v); }
+  uint32_t getUInt(const char* key, uint32_t d = 0) { return getValue(key, d); }
+  size_t putULong(const char* key, uint32_t v) { return putValue(key, v); }
+  uint32_t getULong(const char* key, uint32_t d = 0) { return getValue(key, d); }
+
+private:
+  std::string _ns;
+  bool _readOnly = false;
+
+  static std::map<std::string, std::vector<uint8_t>>& store() {
+    static std::map<std::string, std::vector<uint8_t>> all;
+    return all;
+  }
+  static std::mutex& lock() {
+    static std::mutex m;
+    return m;
+  }
+  std::string fullKey(const char* key) const { return _ns + ":" + key; }
+
+  // Copies up to maxLen bytes; returns the stored length, -1 if missing
+  long find(const char* key, void* buf, size_t maxLen) {
+    BenchUntracked untracked;
+    std::lock_guard<std::mutex> guard(lock());
+    auto it = store().find(fullKey(key));
+    if (it == store().end()) return -1;
+    if (buf) memcpy(buf, it->second.data(), std::min(maxLen, it->second.size()));
+    return it->second.size();
+  }
+
+  template <typename T>
+  size_t putValue(const char* key, T v) { return putBytes(key, &v, sizeof(v)); }
+  template <typename T>
+  T getValue(const char* key, T d) {
+    T v;
+    return find(key, &v, sizeof(v)) == (long)sizeof(v) ? v : d;
+  }
+};
+
+#endif // WEB_BENCH_PREFERENCES_H
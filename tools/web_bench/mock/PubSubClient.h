@@ -0,0 +1,50 @@
+#ifndef WEB_BENCH_PUBSUBCLIENT_H
+#define WEB_BENCH_PUBSUBCLIENT_H
+
+/**
+ * @file PubSubClient.h
+ * @brief MQTT client that never connects
+ */
+
+#include "WiFi.h"
+
+#define MQTT_CONNECTION_TIMEOUT  (-4)
+#define MQTT_DISCONNECTED        (-1)
+
+class PubSubClient {
+public:
+  PubSubClient(Client& client) { (void)client; }
+  void setServer(const char* host, uint16_t port) { (void)host; (void)port; }
+  void setCallback(void (*cb)(char*, uint8_t*, unsigned int)) { (void)cb; }
+  void setKeepAlive(uint16_t seconds) { (void)seconds; }
+  void setSocketTimeout(uint16_t seconds) { (void)seconds; }
+  bool setBufferSize(uint16_t size) { (void)size; return true; }
+  bool connect(const char* id, const char* user, const char* pass, const char* willTopic,
+               uint8_t willQos, bool willRetain, const char* willMessage) {
+    (void)id; (void)user; (void)pass; (void)willTopic; (void)willQos; (void)willRetain; (void)willMessage;
+    return false;
+  }
+  bool connect(const char* id, const char* willTopic, uint8_t willQos, bool willRetain, const char* willMessage) {
+    return connect(id, nullptr, nullptr, willTopic, willQos, willRetain, willMessage);
+  }
+  bool connected() { return false; }
+  void disconnect() {}
+  int state() { return MQTT_DISCONNECTED; }
+  bool loop() { return false; }
+  bool publish(const char* topic, const char* payload, bool retained = false) {
+    (void)topic; (void)payload; (void)retained;
+    return false;
+  }
+  bool publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained) {
+    (void)topic; (void)payload; (void)length; (void)retained;
+    return false;
+  }
+  bool beginPublish(const char* topic, unsigned int length, bool retained) {
+    (void)topic; (void)length; (void)retained;
+    return false;
+  }
+  size_t write(const uint8_t* buf, size_t size) { (void)buf; (void)size; return 0; }
+  int endPublish() { return 0; }
+};
+
+#endif // WEB_BENCH_PUBSUBCLIENT_H
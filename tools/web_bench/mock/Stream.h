@@ -0,0 +1,112 @@
+#ifndef WEB_BENCH_STREAM_H
+#define WEB_BENCH_STREAM_H
+
+/**
+ * @file Stream.h
+ * @brief Print, Stream and HardwareSerial for the host
+ *
+ * Serial output goes to stderr with --verbose and is dropped otherwise,
+ * so sketch logging doesn't skew the timings.
+ */
+
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "WString.h"
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t size) {
+    for (size_t i = 0; i < size; i++) write(buf[i]);
+    return size;
+  }
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+  size_t write(const char* buf, size_t size) { return write((const uint8_t*)buf, size); }
+  virtual void flush() {}
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const __FlashStringHelper* s) { return write((const char*)s); }
+  size_t print(const String& s) { return write(s.c_str(), s.length()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char v, int base = 10) { return print(String(v, base)); }
+  size_t print(int v, int base = 10) { return print(String(v, base)); }
+  size_t print(unsigned int v, int base = 10) { return print(String(v, base)); }
+  size_t print(long v, int base = 10) { return print(String(v, base)); }
+  size_t print(unsigned long v, int base = 10) { return print(String(v, base)); }
+  size_t print(long long v, int base = 10) { return print(String(v, base)); }
+  size_t print(unsigned long long v, int base = 10) { return print(String(v, base)); }
+  size_t print(double v, int decimals = 2) { return print(String(v, decimals)); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(const T& v) { return print(v) + println(); }
+  template <typename T>
+  size_t println(const T& v, int format) { return print(v, format) + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (n < 0) return 0;
+    return write(buf, (size_t)n < sizeof(buf) ? n : sizeof(buf) - 1);
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  void setTimeout(unsigned long timeout) { _timeout = timeout; }
+  size_t readBytes(char* buf, size_t length) { return readBytes((uint8_t*)buf, length); }
+  virtual size_t readBytes(uint8_t* buf, size_t length) {
+    size_t n = 0;
+    int c;
+    while (n < length && (c = read()) >= 0) buf[n++] = c;
+    return n;
+  }
+  size_t readBytesUntil(char terminator, char* buf, size_t length) {
+    size_t n = 0;
+    int c;
+    while (n < length && (c = read()) >= 0 && c != terminator) buf[n++] = c;
+    return n;
+  }
+  String readStringUntil(char terminator) {
+    String s;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) s += (char)c;
+    return s;
+  }
+
+protected:
+  unsigned long _timeout = 1000;
+};
+
+inline bool benchSerialEcho = false;
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  size_t write(uint8_t c) override {
+    if (benchSerialEcho) fputc(c, stderr);
+    return 1;
+  }
+  size_t write(const uint8_t* buf, size_t size) override {
+    if (benchSerialEcho) fwrite(buf, 1, size, stderr);
+    return size;
+  }
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  operator bool() const { return true; }
+};
+
+inline HardwareSerial Serial;
+
+#endif // WEB_BENCH_STREAM_H
@@ -0,0 +1,358 @@
+#ifndef WEB_BENCH_WSTRING_H
+#define WEB_BENCH_WSTRING_H
+
+/**
+ * @file WString.h
+ * @brief Arduino String for the host, allocating like arduino-esp32's
+ *
+ * Up to STRING_SSO_LEN characters live in the object; longer strings
+ * get a heap buffer rounded up to 16 bytes and grown with realloc, as on
+ * the device. That keeps the bench's blocks-per-request close to what
+ * the ESP32 heap sees.
+ */
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+class __FlashStringHelper;
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper*>(p))
+#define F(s) FPSTR(s)
+
+#define STRING_SSO_LEN 10   // Characters kept without a heap block (32-bit layout)
+
+class StringSumHelper;
+
+class String {
+public:
+  String(const char* cstr = "") { copy(cstr ? cstr : "", cstr ? strlen(cstr) : 0); }
+  String(const char* cstr, unsigned int length) { copy(cstr, length); }
+  String(const String& str) { copy(str.c_str(), str._len); }
+  String(String&& str) { move(str); }
+  String(const __FlashStringHelper* str) : String((const char*)str) {}
+  explicit String(char c) { copy(&c, 1); }
+  explicit String(unsigned char v, unsigned char base = 10) : String((unsigned long)v, base) {}
+  explicit String(int v, unsigned char base = 10) : String((long)v, base) {}
+  explicit String(unsigned int v, unsigned char base = 10) : String((unsigned long)v, base) {}
+  explicit String(long v, unsigned char base = 10) { formatSigned(v, base); }
+  explicit String(unsigned long v, unsigned char base = 10) { formatUnsigned(v, base); }
+  explicit String(long long v, unsigned char base = 10) { formatSigned(v, base); }
+  explicit String(unsigned long long v, unsigned char base = 10) { formatUnsigned(v, base); }
+  explicit String(float v, unsigned int decimals = 2) : String((double)v, decimals) {}
+  explicit String(double v, unsigned int decimals = 2) {
+    char buf[40];
+    int n = snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    copy(buf, n);
+  }
+  ~String() { if (!_sso) free(_heap); }
+
+  String& operator=(const String& rhs) {
+    if (this != &rhs) copy(rhs.c_str(), rhs._len);
+    return *this;
+  }
+  String& operator=(String&& rhs) {
+    if (this != &rhs) {
+      if (!_sso) free(_heap);
+      move(rhs);
+    }
+    return *this;
+  }
+  String& operator=(const char* cstr) {
+    copy(cstr ? cstr : "", cstr ? strlen(cstr) : 0);
+    return *this;
+  }
+  String& operator=(const __FlashStringHelper* str) { return *this = (const char*)str; }
+
+  // ===========================================
+  // MEMORY
+  // ===========================================
+
+  bool reserve(unsigned int size) {
+    if (size <= capacity()) return true;
+    return changeBuffer(size);
+  }
+  unsigned int length() const { return _len; }
+  bool isEmpty() const { return _len == 0; }
+  const char* c_str() const { return _sso ? _buf : _heap; }
+  explicit operator bool() const { return true; }
+
+  // ===========================================
+  // CONCATENATION
+  // ===========================================
+
+  bool concat(const char* cstr, unsigned int length) {
+    if (!cstr) return false;
+    if (length == 0) return true;
+    unsigned int newLen = _len + length;
+    if (!reserve(newLen)) return false;
+    memmove(wbuffer() + _len, cstr, length);
+    _len = newLen;
+    wbuffer()[_len] = '\0';
+    return true;
+  }
+  bool concat(const String& s) { return concat(s.c_str(), s._len); }
+  bool concat(const char* cstr) { return cstr && concat(cstr, strlen(cstr)); }
+  bool concat(const __FlashStringHelper* s) { return concat((const char*)s); }
+  bool concat(char c) { return concat(&c, 1); }
+  bool concat(unsigned char v) { return concat(String(v)); }
+  bool concat(int v) { return concat(String(v)); }
+  bool concat(unsigned int v) { return concat(String(v)); }
+  bool concat(long v) { return concat(String(v)); }
+  bool concat(unsigned long v) { return concat(String(v)); }
+  bool concat(long long v) { return concat(String(v)); }
+  bool concat(unsigned long long v) { return concat(String(v)); }
+  bool concat(float v) { return concat(String(v)); }
+  bool concat(double v) { return concat(String(v)); }
+
+  template <typename T>
+  String& operator+=(const T& rhs) {
+    concat(rhs);
+    return *this;
+  }
+
+  friend StringSumHelper& operator+(const StringSumHelper& lhs, const String& rhs);
+  friend StringSumHelper& operator+(const StringSumHelper& lhs, const char* cstr);
+  friend StringSumHelper& operator+(const StringSumHelper& lhs, char c);
+  friend StringSumHelper& operator+(const StringSumHelper& lhs, int v);
+  friend StringSumHelper& operator+(const StringSumHelper& lhs, unsigned int v);
+  friend StringSumHelper& operator+(const StringSumHelper& lhs, long v);
+  friend StringSumHelper& operator+(const StringSumHelper& lhs, unsigned long v);
+  friend StringSumHelper& operator+(const StringSumHelper& lhs, float v);
+  friend StringSumHelper& operator+(const StringSumHelper& lhs, double v);
+
+  // ===========================================
+  // COMPARISON
+  // ===========================================
+
+  int compareTo(const String& s) const { return strcmp(c_str(), s.c_str()); }
+  bool equals(const String& s) const { return _len == s._len && compareTo(s) == 0; }
+  bool equals(const char* cstr) const { return strcmp(c_str(), cstr ? cstr : "") == 0; }
+  bool equalsIgnoreCase(const String& s) const { return _len == s._len && strcasecmp(c_str(), s.c_str()) == 0; }
+  bool operator==(const String& rhs) const { return equals(rhs); }
+  bool operator==(const char* cstr) const { return equals(cstr); }
+  bool operator!=(const String& rhs) const { return !equals(rhs); }
+  bool operator!=(const char* cstr) const { return !equals(cstr); }
+  bool operator<(const String& rhs) const { return compareTo(rhs) < 0; }
+  bool operator>(const String& rhs) const { return compareTo(rhs) > 0; }
+  bool startsWith(const String& prefix) const {
+    return prefix._len <= _len && strncmp(c_str(), prefix.c_str(), prefix._len) == 0;
+  }
+  bool endsWith(const String& suffix) const {
+    return suffix._len <= _len && strcmp(c_str() + _len - suffix._len, suffix.c_str()) == 0;
+  }
+
+  // ===========================================
+  // CHARACTER ACCESS
+  // ===========================================
+
+  char charAt(unsigned int i) const { return i < _len ? c_str()[i] : 0; }
+  void setCharAt(unsigned int i, char c) { if (i < _len) wbuffer()[i] = c; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char& operator[](unsigned int i) { return wbuffer()[i]; }
+  void getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index = 0) const {
+    if (!bufsize || !buf) return;
+    if (index >= _len) {
+      buf[0] = 0;
+      return;
+    }
+    unsigned int n = bufsize - 1;
+    if (n > _len - index) n = _len - index;
+    memcpy(buf, c_str() + index, n);
+    buf[n] = 0;
+  }
+  void toCharArray(char* buf, unsigned int bufsize, unsigned int index = 0) const {
+    getBytes((unsigned char*)buf, bufsize, index);
+  }
+
+  // ===========================================
+  // SEARCH
+  // ===========================================
+
+  int indexOf(char c, unsigned int from = 0) const {
+    if (from >= _len) return -1;
+    const char* p = strchr(c_str() + from, c);
+    return p ? p - c_str() : -1;
+  }
+  int indexOf(const String& s, unsigned int from = 0) const {
+    if (from >= _len) return -1;
+    const char* p = strstr(c_str() + from, s.c_str());
+    return p ? p - c_str() : -1;
+  }
+  int lastIndexOf(char c) const {
+    const char* p = strrchr(c_str(), c);
+    return p ? p - c_str() : -1;
+  }
+  String substring(unsigned int from) const { return substring(from, _len); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+      unsigned int t = from;
+      from = to;
+      to = t;
+    }
+    if (from >= _len) return String();
+    if (to > _len) to = _len;
+    return String(c_str() + from, to - from);
+  }
+
+  // ===========================================
+  // MODIFICATION
+  // ===========================================
+
+  void replace(char find, char with) {
+    for (unsigned int i = 0; i < _len; i++) {
+      if (wbuffer()[i] == find) wbuffer()[i] = with;
+    }
+  }
+  void replace(const String& find, const String& with) {
+    if (find._len == 0) return;
+    String out;
+    int from = 0;
+    int at;
+    while ((at = indexOf(find, from)) >= 0) {
+      out.concat(c_str() + from, at - from);
+      out.concat(with);
+      from = at + find._len;
+    }
+    if (from == 0) return;
+    out.concat(c_str() + from, _len - from);
+    *this = std::move(out);
+  }
+  void remove(unsigned int index) { remove(index, (unsigned int)-1); }
+  void remove(unsigned int index, unsigned int count) {
+    if (index >= _len) return;
+    if (count > _len - index) count = _len - index;
+    memmove(wbuffer() + index, wbuffer() + index + count, _len - index - count + 1);
+    _len -= count;
+  }
+  void toLowerCase() { for (unsigned int i = 0; i < _len; i++) wbuffer()[i] = tolower(wbuffer()[i]); }
+  void toUpperCase() { for (unsigned int i = 0; i < _len; i++) wbuffer()[i] = toupper(wbuffer()[i]); }
+  void trim() {
+    const char* s = c_str();
+    unsigned int begin = 0;
+    while (begin < _len && isspace((unsigned char)s[begin])) begin++;
+    unsigned int end = _len;
+    while (end > begin && isspace((unsigned char)s[end - 1])) end--;
+    if (begin > 0) memmove(wbuffer(), s + begin, end - begin);
+    _len = end - begin;
+    wbuffer()[_len] = '\0';
+  }
+
+  // ===========================================
+  // CONVERSION
+  // ===========================================
+
+  long toInt() const { return atol(c_str()); }
+  float toFloat() const { return atof(c_str()); }
+  double toDouble() const { return atof(c_str()); }
+
+private:
+  char _buf[STRING_SSO_LEN + 1] = "";
+  char* _heap = nullptr;
+  unsigned int _cap = 0;       // Heap capacity, not counting the NUL
+  unsigned int _len = 0;
+  bool _sso = true;
+
+  unsigned int capacity() const { return _sso ? STRING_SSO_LEN : _cap; }
+  char* wbuffer() { return _sso ? _buf : _heap; }
+
+  // Same sizing as arduino-esp32: small strings stay inline, heap
+  // buffers are rounded up to 16 bytes and grown in place
+  bool changeBuffer(unsigned int maxLen) {
+    if (maxLen <= STRING_SSO_LEN) {
+      if (!_sso) {
+        char temp[STRING_SSO_LEN + 1];
+        memcpy(temp, _heap, maxLen + 1);
+        free(_heap);
+        _heap = nullptr;
+        _sso = true;
+        memcpy(_buf, temp, maxLen + 1);
+      }
+      return true;
+    }
+    size_t newSize = (maxLen + 16) & ~(size_t)0xf;
+    char* buf = (char*)realloc(_sso ? nullptr : _heap, newSize);
+    if (!buf) return false;
+    if (_sso) memcpy(buf, _buf, _len + 1);
+    _heap = buf;
+    _cap = newSize - 1;
+    _sso = false;
+    return true;
+  }
+
+  void copy(const char* cstr, unsigned int length) {
+    if (!reserve(length)) return;
+    memmove(wbuffer(), cstr, length);
+    _len = length;
+    wbuffer()[_len] = '\0';
+  }
+
+  void move(String& rhs) {
+    memcpy(_buf, rhs._buf, sizeof(_buf));
+    _heap = rhs._heap;
+    _cap = rhs._cap;
+    _len = rhs._len;
+    _sso = rhs._sso;
+    rhs._heap = nullptr;
+    rhs._cap = 0;
+    rhs._len = 0;
+    rhs._sso = true;
+    rhs._buf[0] = '\0';
+  }
+
+  void formatSigned(long long v, unsigned char base) {
+    if (v < 0 && base == 10) {
+      formatUnsigned(0ULL - (unsigned long long)v, base);
+      String minus("-");
+      minus.concat(*this);
+      *this = std::move(minus);
+    } else {
+      formatUnsigned((unsigned long long)v, base);
+    }
+  }
+  void formatUnsigned(unsigned long long v, unsigned char base) {
+    char buf[66];
+    char* p = buf + sizeof(buf) - 1;
+    *p = '\0';
+    do {
+      unsigned d = v % base;
+      *--p = d < 10 ? '0' + d : 'a' + d - 10;
+      v /= base;
+    } while (v > 0);
+    copy(p, buf + sizeof(buf) - 1 - p);
+  }
+};
+
+class StringSumHelper : public String {
+public:
+  StringSumHelper(const String& s) : String(s) {}
+  StringSumHelper(const char* p) : String(p) {}
+  StringSumHelper(char c) : String(c) {}
+  StringSumHelper(int v) : String(v) {}
+  StringSumHelper(unsigned int v) : String(v) {}
+  StringSumHelper(long v) : String(v) {}
+  StringSumHelper(unsigned long v) : String(v) {}
+};
+
+#define STRING_SUM(type, expr)                                                 \
+  inline StringSumHelper& operator+(const StringSumHelper& lhs, type rhs) {   \
+    StringSumHelper& a = const_cast<StringSumHelper&>(lhs);                   \
+    a.concat(expr);                                                           \
+    return a;                                                                 \
+  }
+STRING_SUM(const String&, rhs)
+STRING_SUM(const char*, rhs)
+STRING_SUM(char, rhs)
+STRING_SUM(int, rhs)
+STRING_SUM(unsigned int, rhs)
+STRING_SUM(long, rhs)
+STRING_SUM(unsigned long, rhs)
+STRING_SUM(float, rhs)
+STRING_SUM(double, rhs)
+#undef STRING_SUM
+
+inline StringSumHelper& operator+(const StringSumHelper& lhs, const __FlashStringHelper* rhs) {
+  return lhs + (const char*)rhs;
+}
+
+#endif // WEB_BENCH_WSTRING_H
@@ -0,0 +1,131 @@
+#ifndef WEB_BENCH_WIFI_H
+#define WEB_BENCH_WIFI_H
+
+/**
+ * @file WiFi.h
+ * @brief A station that is always connected, and clients that never are
+ *
+ * The bench only serves HTTP; outgoing connections (probes, MQTT,
+ * throughput) fail at once. WiFi reports a fixed SSID, address and RSSI
+ * so /stats and the dashboard have something to show.
+ */
+
+#include <functional>
+#include "Arduino.h"
+
+#define WL_IDLE_STATUS      0
+#define WL_NO_SSID_AVAIL    1
+#define WL_CONNECTED        3
+#define WL_CONNECT_FAILED   4
+#define WL_DISCONNECTED     6
+
+#define WIFI_OFF            0
+#define WIFI_STA            1
+#define WIFI_AP             2
+#define WIFI_AP_STA         3
+#define WIFI_AUTH_OPEN      0
+#define WIFI_SCAN_RUNNING   (-1)
+#define WIFI_SCAN_FAILED    (-2)
+
+typedef int wifi_mode_t;
+typedef int wifi_auth_mode_t;
+typedef int arduino_event_id_t;
+struct arduino_event_info_t {
+  int reason;
+};
+
+#define ARDUINO_EVENT_WIFI_STA_DISCONNECTED 5
+#define ARDUINO_EVENT_WIFI_STA_GOT_IP       7
+
+typedef void (*WiFiEventCb)(arduino_event_id_t event);
+typedef std::function<void(arduino_event_id_t, arduino_event_info_t)> WiFiEventFuncCb;
+
+// ===========================================
+// CLIENTS
+// ===========================================
+
+class Client : public Stream {
+public:
+  virtual int connect(IPAddress ip, uint16_t port) = 0;
+  virtual int connect(const char* host, uint16_t port) = 0;
+  virtual void stop() = 0;
+  virtual uint8_t connected() = 0;
+  virtual operator bool() = 0;
+};
+
+class WiFiClient : public Client {
+public:
+  int connect(IPAddress ip, uint16_t port) override { (void)ip; (void)port; return 0; }
+  int connect(const char* host, uint16_t port) override { (void)host; (void)port; return 0; }
+  int connect(IPAddress ip, uint16_t port, int32_t timeout) { (void)timeout; return connect(ip, port); }
+  int connect(const char* host, uint16_t port, int32_t timeout) { (void)timeout; return connect(host, port); }
+  void stop() override {}
+  uint8_t connected() override { return 0; }
+  operator bool() override { return false; }
+  size_t write(uint8_t c) override { (void)c; return 0; }
+  size_t write(const uint8_t* buf, size_t size) override { (void)buf; (void)size; return 0; }
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int read(uint8_t* buf, size_t size) { (void)buf; (void)size; return -1; }
+  int peek() override { return -1; }
+  void setNoDelay(bool on) { (void)on; }
+  int fd() const { return -1; }
+  IPAddress remoteIP() const { return IPAddress(); }
+};
+
+// ===========================================
+// WIFI
+// ===========================================
+
+class WiFiClass {
+public:
+  int status() { return WL_CONNECTED; }
+  bool mode(wifi_mode_t m) { _mode = m; return true; }
+  wifi_mode_t getMode() { return _mode; }
+  int begin(const char* ssid, const char* pass) { (void)ssid; (void)pass; return WL_CONNECTED; }
+  bool disconnect(bool wifiOff = false, bool eraseAp = false) { (void)wifiOff; (void)eraseAp; return true; }
+  bool setAutoReconnect(bool on) { (void)on; return true; }
+  bool setSleep(bool on) { (void)on; return true; }
+
+  IPAddress localIP() { return IPAddress(192, 168, 1, 50); }
+  IPAddress gatewayIP() { return IPAddress(192, 168, 1, 1); }
+  IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+  IPAddress dnsIP(uint8_t n = 0) { (void)n; return IPAddress(192, 168, 1, 1); }
+  String SSID() { return String("bench"); }
+  String SSID(int n) { (void)n; return String(); }
+  int8_t RSSI() { return -55; }
+  int32_t RSSI(int n) { (void)n; return 0; }
+  int32_t channel() { return 6; }
+  String macAddress() { return String("AA:BB:CC:DD:EE:FF"); }
+  uint8_t* macAddress(uint8_t* mac) {
+    static const uint8_t fixed[6] = {0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+    memcpy(mac, fixed, 6);
+    return mac;
+  }
+  int hostByName(const char* host, IPAddress& out) { (void)host; out = IPAddress(); return 0; }
+
+  int scanNetworks(bool async = false, bool hidden = false, bool passive = false, uint32_t ms = 300) {
+    (void)async; (void)hidden; (void)passive; (void)ms;
+    return 0;
+  }
+  int scanComplete() { return 0; }
+  void scanDelete() {}
+  wifi_auth_mode_t encryptionType(int n) { (void)n; return WIFI_AUTH_OPEN; }
+
+  bool softAP(const char* ssid, const char* pass = nullptr, int channel = 1) {
+    (void)ssid; (void)pass; (void)channel;
+    return true;
+  }
+  IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+
+  int onEvent(WiFiEventCb cb, arduino_event_id_t event = 0) { (void)cb; (void)event; return 0; }
+  int onEvent(WiFiEventFuncCb cb, arduino_event_id_t event = 0) { (void)cb; (void)event; return 0; }
+
+private:
+  wifi_mode_t _mode = WIFI_STA;
+};
+
+inline WiFiClass WiFi;
+
+#endif // WEB_BENCH_WIFI_H
@@ -0,0 +1,31 @@
+#ifndef WEB_BENCH_WIFIUDP_H
+#define WEB_BENCH_WIFIUDP_H
+
+/**
+ * @file WiFiUdp.h
+ * @brief UDP socket that sends nothing and receives nothing
+ */
+
+#include "WiFi.h"
+
+class WiFiUDP : public Stream {
+public:
+  uint8_t begin(uint16_t port) { (void)port; return 0; }
+  void stop() {}
+  int beginPacket(IPAddress ip, uint16_t port) { (void)ip; (void)port; return 0; }
+  int beginPacket(const char* host, uint16_t port) { (void)host; (void)port; return 0; }
+  int endPacket() { return 0; }
+  size_t write(uint8_t c) override { (void)c; return 0; }
+  size_t write(const uint8_t* buf, size_t size) override { (void)buf; (void)size; return 0; }
+  using Print::write;
+  int parsePacket() { return 0; }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int read(uint8_t* buf, size_t size) { (void)buf; (void)size; return 0; }
+  int read(char* buf, size_t size) { (void)buf; (void)size; return 0; }
+  int peek() override { return -1; }
+  IPAddress remoteIP() { return IPAddress(); }
+  uint16_t remotePort() { return 0; }
+};
+
+#endif // WEB_BENCH_WIFIUDP_H
@@ -0,0 +1,47 @@
+#ifndef WEB_BENCH_HEAP_H
+#define WEB_BENCH_HEAP_H
+
+/**
+ * @file bench_heap.h
+ * @brief Heap counters shared by the mocks and the allocation tracker
+ *
+ * web_bench.cpp replaces malloc/free and counts every block taken by a
+ * thread with benchHeapTracked set (the web task). ESP.getFreeHeap() and
+ * heap_caps_get_info() report a device-sized heap minus what is live, so
+ * /stats and the template heap check see the handlers' own use.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#define BENCH_HEAP_SIZE 327680   // ESP32-S3 internal RAM left to the sketch
+
+struct BenchHeap {
+  std::atomic<uint64_t> allocs{0};      // Blocks taken (malloc, calloc, growing realloc)
+  std::atomic<uint64_t> frees{0};
+  std::atomic<uint64_t> bytes{0};       // Bytes requested
+  std::atomic<int64_t> live{0};         // Bytes currently held
+  std::atomic<int64_t> peak{0};         // Highest live since the last reset
+  std::atomic<int64_t> minFree{BENCH_HEAP_SIZE};
+  std::atomic<uint64_t> largest{0};     // Largest single request
+};
+
+inline BenchHeap benchHeap;
+inline thread_local bool benchHeapTracked = false;
+inline const char* benchHeapTask = "Web";   // Task whose blocks are counted
+
+// Mock internals (e.g. the Preferences store) stand in for device code
+// with its own heap; their blocks are left out of the counts
+struct BenchUntracked {
+  bool saved = benchHeapTracked;
+  BenchUntracked() { benchHeapTracked = false; }
+  ~BenchUntracked() { benchHeapTracked = saved; }
+};
+
+inline uint32_t benchHeapFree() {
+  int64_t free = BENCH_HEAP_SIZE - benchHeap.live.load();
+  return free > 0 ? (uint32_t)free : 0;
+}
+
+#endif // WEB_BENCH_HEAP_H
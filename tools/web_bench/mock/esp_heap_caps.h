@@ -0,0 +1,36 @@
+#ifndef WEB_BENCH_ESP_HEAP_CAPS_H
+#define WEB_BENCH_ESP_HEAP_CAPS_H
+
+/**
+ * @file esp_heap_caps.h
+ * @brief Heap info from the bench's allocation counters
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include "bench_heap.h"
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+typedef struct {
+  size_t total_free_bytes;
+  size_t total_allocated_bytes;
+  size_t largest_free_block;
+  size_t minimum_free_bytes;
+  size_t allocated_blocks;
+  size_t free_blocks;
+  size_t total_blocks;
+} multi_heap_info_t;
+
+inline void heap_caps_get_info(multi_heap_info_t* info, uint32_t caps) {
+  (void)caps;
+  *info = multi_heap_info_t();
+  info->total_free_bytes = benchHeapFree();
+  info->total_allocated_bytes = BENCH_HEAP_SIZE - benchHeapFree();
+  info->largest_free_block = benchHeapFree();
+  info->minimum_free_bytes = benchHeap.minFree.load();
+  info->allocated_blocks = benchHeap.allocs.load() - benchHeap.frees.load();
+}
+
+#endif // WEB_BENCH_ESP_HEAP_CAPS_H
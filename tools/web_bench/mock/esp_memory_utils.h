@@ -0,0 +1,16 @@
+#ifndef WEB_BENCH_ESP_MEMORY_UTILS_H
+#define WEB_BENCH_ESP_MEMORY_UTILS_H
+
+/**
+ * @file esp_memory_utils.h
+ * @brief Memory region checks
+ *
+ * The host can't tell a literal from a stack buffer, so every body is
+ * treated as RAM and copied. On the device, send() of a flash literal
+ * is queued by reference instead; output block counts here are an upper
+ * bound.
+ */
+
+inline bool esp_ptr_in_drom(const void* p) { (void)p; return false; }
+
+#endif // WEB_BENCH_ESP_MEMORY_UTILS_H
@@ -0,0 +1,20 @@
+#ifndef WEB_BENCH_ESP_ROM_CRC_H
+#define WEB_BENCH_ESP_ROM_CRC_H
+
+/**
+ * @file esp_rom_crc.h
+ * @brief CRC-32 (little-endian, as the ROM routine computes it)
+ */
+
+#include <cstdint>
+
+inline uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *buf++;
+    for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+#endif // WEB_BENCH_ESP_ROM_CRC_H
@@ -0,0 +1,27 @@
+#ifndef WEB_BENCH_ESP_SNTP_H
+#define WEB_BENCH_ESP_SNTP_H
+
+/**
+ * @file esp_sntp.h
+ * @brief SNTP client that never syncs (the clock stays unsynced)
+ */
+
+#include <sys/time.h>
+#include <time.h>
+#include "Arduino.h"
+
+typedef enum { ESP_SNTP_OPMODE_POLL, ESP_SNTP_OPMODE_LISTENONLY } esp_sntp_operatingmode_t;
+typedef enum { SNTP_SYNC_STATUS_RESET, SNTP_SYNC_STATUS_COMPLETED, SNTP_SYNC_STATUS_IN_PROGRESS } sntp_sync_status_t;
+typedef void (*sntp_sync_time_cb_t)(struct timeval* tv);
+
+inline void esp_sntp_setoperatingmode(esp_sntp_operatingmode_t mode) { (void)mode; }
+inline void esp_sntp_setservername(uint8_t idx, const char* server) { (void)idx; (void)server; }
+inline void esp_sntp_init() {}
+inline void esp_sntp_stop() {}
+inline bool esp_sntp_enabled() { return false; }
+inline void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t cb) { (void)cb; }
+inline void sntp_set_sync_interval(uint32_t ms) { (void)ms; }
+inline bool sntp_restart() { return false; }
+inline sntp_sync_status_t sntp_get_sync_status() { return SNTP_SYNC_STATUS_RESET; }
+
+#endif // WEB_BENCH_ESP_SNTP_H
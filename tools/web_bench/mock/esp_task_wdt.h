@@ -0,0 +1,23 @@
+#ifndef WEB_BENCH_ESP_TASK_WDT_H
+#define WEB_BENCH_ESP_TASK_WDT_H
+
+/**
+ * @file esp_task_wdt.h
+ * @brief Task watchdog that never fires
+ */
+
+#include "Arduino.h"
+
+typedef struct {
+  uint32_t timeout_ms;
+  uint32_t idle_core_mask;
+  bool trigger_panic;
+} esp_task_wdt_config_t;
+
+inline esp_err_t esp_task_wdt_init(const esp_task_wdt_config_t* config) { (void)config; return ESP_OK; }
+inline esp_err_t esp_task_wdt_reconfigure(const esp_task_wdt_config_t* config) { (void)config; return ESP_OK; }
+inline esp_err_t esp_task_wdt_add(TaskHandle_t task) { (void)task; return ESP_OK; }
+inline esp_err_t esp_task_wdt_delete(TaskHandle_t task) { (void)task; return ESP_OK; }
+inline esp_err_t esp_task_wdt_reset() { return ESP_OK; }
+
+#endif // WEB_BENCH_ESP_TASK_WDT_H
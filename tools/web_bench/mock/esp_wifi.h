@@ -0,0 +1,26 @@
+#ifndef WEB_BENCH_ESP_WIFI_H
+#define WEB_BENCH_ESP_WIFI_H
+
+/**
+ * @file esp_wifi.h
+ * @brief Station AP info matching the WiFi mock
+ */
+
+#include "Arduino.h"
+
+typedef struct {
+  uint8_t bssid[6];
+  uint8_t ssid[33];
+  uint8_t primary;
+  int8_t rssi;
+} wifi_ap_record_t;
+
+inline esp_err_t esp_wifi_sta_get_ap_info(wifi_ap_record_t* info) {
+  memset(info, 0, sizeof(*info));
+  strcpy((char*)info->ssid, "bench");
+  info->primary = 6;
+  info->rssi = -55;
+  return ESP_OK;
+}
+
+#endif // WEB_BENCH_ESP_WIFI_H
@@ -0,0 +1,182 @@
+#ifndef WEB_BENCH_FREERTOS_H
+#define WEB_BENCH_FREERTOS_H
+
+/**
+ * @file FreeRTOS.h
+ * @brief FreeRTOS tasks, semaphores and notifications on std::thread
+ *
+ * A task is a detached thread; core and priority are recorded, not
+ * enforced. Critical sections are no-ops: the bench runs the sketch's
+ * web task and nothing else, so there is no second writer to lock out.
+ * uxTaskGetSystemState() and uxTaskGetNumberOfTasks() report no tasks,
+ * which leaves the CPU sampler idle.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include "../bench_heap.h"
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdTRUE                 1
+#define pdFALSE                0
+#define pdPASS                 1
+#define pdFAIL                 0
+#define portMAX_DELAY          0xffffffffu
+#define portTICK_PERIOD_MS     1
+#define pdMS_TO_TICKS(ms)      ((TickType_t)(ms))
+#define portNUM_PROCESSORS     2
+#define tskIDLE_PRIORITY       0
+#define tskNO_AFFINITY         0x7fffffff
+#define configMAX_PRIORITIES   25
+#define configTICK_RATE_HZ     1000
+#define configMAX_TASK_NAME_LEN 16
+#define configGENERATE_RUN_TIME_STATS 1
+#define configUSE_TRACE_FACILITY 1
+#define configTASKLIST_INCLUDE_COREID 1
+#define ARDUINO_RUNNING_CORE   1
+
+// ===========================================
+// CRITICAL SECTIONS
+// ===========================================
+
+struct portMUX_TYPE {
+  int owner;
+};
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux)     ((void)(mux))
+#define portEXIT_CRITICAL(mux)      ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux)  ((void)(mux))
+
+// ===========================================
+// TASKS
+// ===========================================
+
+struct BenchTask {
+  char name[configMAX_TASK_NAME_LEN];
+  BaseType_t core;
+  UBaseType_t priority;
+  std::mutex lock;
+  std::condition_variable wake;
+  uint32_t notified = 0;
+};
+typedef BenchTask* TaskHandle_t;
+
+inline thread_local BenchTask* benchCurrentTask = nullptr;
+
+inline TickType_t xTaskGetTickCount() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (TickType_t)duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack,
+                                          void* param, UBaseType_t priority,
+                                          TaskHandle_t* handle, BaseType_t core) {
+  (void)stack;
+  BenchTask* task = new BenchTask();
+  strncpy(task->name, name, sizeof(task->name) - 1);
+  task->core = core;
+  task->priority = priority;
+  if (handle) *handle = task;
+  std::thread([fn, param, task]() {
+    benchCurrentTask = task;
+    benchHeapTracked = strcmp(task->name, benchHeapTask) == 0;
+    fn(param);
+  }).detach();
+  return pdPASS;
+}
+
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack, void* param,
+                              UBaseType_t priority, TaskHandle_t* handle) {
+  return xTaskCreatePinnedToCore(fn, name, stack, param, priority, handle, tskNO_AFFINITY);
+}
+
+// Only a task ending itself (vTaskDelete(NULL)) is supported
+inline void vTaskDelete(TaskHandle_t task) {
+  if (task == nullptr || task == benchCurrentTask) {
+    while (true) std::this_thread::sleep_for(std::chrono::hours(1));
+  }
+}
+
+inline void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+inline void vTaskDelayUntil(TickType_t* previous, TickType_t increment) {
+  *previous += increment;
+  TickType_t now = xTaskGetTickCount();
+  if ((int32_t)(*previous - now) > 0) vTaskDelay(*previous - now);
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return benchCurrentTask; }
+inline const char* pcTaskGetName(TaskHandle_t task) {
+  task = task ? task : benchCurrentTask;
+  return task ? task->name : "main";
+}
+inline BaseType_t xPortGetCoreID() { return benchCurrentTask ? benchCurrentTask->core & 1 : 1; }
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) { (void)task; return 4096; }
+inline UBaseType_t uxTaskPriorityGet(TaskHandle_t task) { return task ? task->priority : 1; }
+inline void vTaskPrioritySet(TaskHandle_t task, UBaseType_t priority) {
+  if (task) task->priority = priority;
+}
+
+// ===========================================
+// TASK NOTIFICATIONS
+// ===========================================
+
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  if (!task) return pdFAIL;
+  std::lock_guard<std::mutex> guard(task->lock);
+  task->notified++;
+  task->wake.notify_one();
+  return pdPASS;
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) {
+  BenchTask* task = benchCurrentTask;
+  if (!task) return 0;
+  std::unique_lock<std::mutex> guard(task->lock);
+  task->wake.wait_for(guard, std::chrono::milliseconds(wait), [task]() { return task->notified > 0; });
+  uint32_t value = task->notified;
+  if (value) task->notified = clear ? 0 : value - 1;
+  return value;
+}
+
+// ===========================================
+// TASK STATISTICS
+// ===========================================
+
+typedef enum { eRunning, eReady, eBlocked, eSuspended, eDeleted, eInvalid } eTaskState;
+
+typedef struct {
+  TaskHandle_t xHandle;
+  const char* pcTaskName;
+  UBaseType_t xTaskNumber;
+  eTaskState eCurrentState;
+  UBaseType_t uxCurrentPriority;
+  UBaseType_t uxBasePriority;
+  uint32_t ulRunTimeCounter;
+  void* pxStackBase;
+  uint32_t usStackHighWaterMark;
+  BaseType_t xCoreID;
+} TaskStatus_t;
+
+inline UBaseType_t uxTaskGetSystemState(TaskStatus_t* status, UBaseType_t size, uint32_t* total) {
+  (void)status;
+  (void)size;
+  if (total) *total = 0;
+  return 0;
+}
+
+inline UBaseType_t uxTaskGetNumberOfTasks() { return 0; }
+
+#endif // WEB_BENCH_FREERTOS_H
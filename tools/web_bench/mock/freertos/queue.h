@@ -0,0 +1,7 @@
+#ifndef WEB_BENCH_FREERTOS_QUEUE_H
+#define WEB_BENCH_FREERTOS_QUEUE_H
+
+// The sketch uses no queues; kept so <freertos/queue.h> resolves
+#include "FreeRTOS.h"
+
+#endif // WEB_BENCH_FREERTOS_QUEUE_H
@@ -0,0 +1,49 @@
+#ifndef WEB_BENCH_FREERTOS_SEMPHR_H
+#define WEB_BENCH_FREERTOS_SEMPHR_H
+
+/**
+ * @file semphr.h
+ * @brief Binary/mutex semaphores as a counter under a condition variable
+ */
+
+#include "FreeRTOS.h"
+
+struct BenchSemaphore {
+  std::mutex lock;
+  std::condition_variable wake;
+  UBaseType_t count;
+};
+typedef BenchSemaphore* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+  SemaphoreHandle_t s = new BenchSemaphore();
+  s->count = 0;
+  return s;
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+  SemaphoreHandle_t s = new BenchSemaphore();
+  s->count = 1;
+  return s;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait) {
+  std::unique_lock<std::mutex> guard(s->lock);
+  if (!s->wake.wait_for(guard, std::chrono::milliseconds(wait), [s]() { return s->count > 0; })) {
+    return pdFALSE;
+  }
+  s->count--;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  std::lock_guard<std::mutex> guard(s->lock);
+  if (s->count > 0) return pdFALSE;
+  s->count++;
+  s->wake.notify_one();
+  return pdTRUE;
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
+
+#endif // WEB_BENCH_FREERTOS_SEMPHR_H
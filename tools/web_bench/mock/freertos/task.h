@@ -0,0 +1,7 @@
+#ifndef WEB_BENCH_FREERTOS_TASK_H
+#define WEB_BENCH_FREERTOS_TASK_H
+
+// Tasks are declared in FreeRTOS.h
+#include "FreeRTOS.h"
+
+#endif // WEB_BENCH_FREERTOS_TASK_H
@@ -0,0 +1,21 @@
+#ifndef WEB_BENCH_LWIP_SOCKETS_H
+#define WEB_BENCH_LWIP_SOCKETS_H
+
+/**
+ * @file sockets.h
+ * @brief lwIP's BSD socket API is the host's own
+ *
+ * http_server.h runs unchanged on real host sockets.
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#endif // WEB_BENCH_LWIP_SOCKETS_H
@@ -0,0 +1,804 @@
+/**
+ * @file web_bench.cpp
+ * @brief Host load test and heap profile for the web task
+ *
+ * Builds the whole sketch against the stand-ins in mock/ and runs its
+ * real HttpServer and handlers on a host socket. Only the web task is
+ * started; the LED, network and MQTT tasks are not, so the numbers are
+ * the handlers' own.
+ *
+ * Every block the web task takes goes through the malloc replacement
+ * below, which counts allocations, bytes and the live/peak total. Two
+ * passes replay one or more request mixes (mixes/ *.mix):
+ *
+ *   profile  each mix line on its own, sequentially: allocations and
+ *            bytes per request, and bytes still held afterwards
+ *   load     --clients connections in a loop for --seconds: requests/s,
+ *            latency percentiles, status codes, heap peak and the
+ *            server's own drop/reject/pool-miss counters
+ *
+ * Usually run through tools/web_bench.py, which builds this file and
+ * compares the results against a saved baseline.
+ *
+ * Mix file format (one request per line, # starts a comment):
+ *
+ *   GET /stats
+ *   POST /api/settings {"brightness":40}
+ *   POST /mqtt/config enabled=1&broker=10.0.0.2&port=1883
+ *     If-None-Match: {etag}           (indented: extra header for the line above;
+ *                                      {etag} is the asset's current ETag)
+ *   GET /assets/dashboard.*.css       (* matches the current asset hash)
+ *   GET /
+ *     = 304                           (indented "= N": the status expected)
+ *
+ * A body starting with '{' is sent as application/json, anything else
+ * as a form. Every request carries a session cookie from /login.
+ * Without "= N" any 2xx or 304 is expected; any other status, or a
+ * failed or cut-off response, fails the run (exit 1) after the report.
+ *
+ * Byte counts are from a 64-bit host: pointers, String headers and
+ * malloc rounding are larger than on the ESP32, so compare runs with
+ * each other, not with the device's heap.
+ */
+
+#include <arpa/inet.h>
+#include <fnmatch.h>
+#include <malloc.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_heap.h"
+
+// ===========================================
+// HEAP TRACKER
+// ===========================================
+// Replaces malloc and friends (glibc supports this when the whole family
+// is replaced). Every block carries a 16-byte header with its size and
+// whether the web task took it, so a block freed on another thread still
+// comes off the right total.
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_memalign(size_t align, size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace {
+
+constexpr uint32_t BLOCK_MAGIC = 0x57424e48;  // "WBNH"
+constexpr size_t BLOCK_HEADER = 16;
+
+struct BlockHeader {
+  uint64_t size;
+  uint32_t offset;   // From the start of the underlying block to the user pointer
+  uint16_t tracked;
+  uint16_t magic;    // Low half of BLOCK_MAGIC, checked on free
+};
+static_assert(sizeof(BlockHeader) == BLOCK_HEADER, "header must keep 16-byte alignment");
+
+inline BlockHeader* headerOf(void* ptr) {
+  return (BlockHeader*)((char*)ptr - BLOCK_HEADER);
+}
+
+void countAlloc(size_t size) {
+  benchHeap.allocs.fetch_add(1, std::memory_order_relaxed);
+  benchHeap.bytes.fetch_add(size, std::memory_order_relaxed);
+  int64_t live = benchHeap.live.fetch_add(size, std::memory_order_relaxed) + size;
+
+  int64_t peak = benchHeap.peak.load(std::memory_order_relaxed);
+  while (live > peak && !benchHeap.peak.compare_exchange_weak(peak, live)) {}
+  int64_t free = BENCH_HEAP_SIZE - live;
+  int64_t minFree = benchHeap.minFree.load(std::memory_order_relaxed);
+  while (free < minFree && !benchHeap.minFree.compare_exchange_weak(minFree, free)) {}
+  uint64_t largest = benchHeap.largest.load(std::memory_order_relaxed);
+  while (size > largest && !benchHeap.largest.compare_exchange_weak(largest, size)) {}
+}
+
+void* allocBlock(size_t align, size_t size) {
+  if (align < BLOCK_HEADER) align = BLOCK_HEADER;
+  char* raw = (char*)(align == BLOCK_HEADER ? __libc_malloc(size + BLOCK_HEADER)
+                                            : __libc_memalign(align, size + align));
+  if (!raw) return nullptr;
+
+  char* user = raw + (align == BLOCK_HEADER ? BLOCK_HEADER : align);
+  BlockHeader* h = headerOf(user);
+  h->size = size;
+  h->offset = (uint32_t)(user - raw);
+  h->tracked = benchHeapTracked;
+  h->magic = (uint16_t)BLOCK_MAGIC;
+  if (h->tracked) countAlloc(size);
+  return user;
+}
+
+void freeBlock(void* ptr) {
+  BlockHeader* h = headerOf(ptr);
+  if (h->magic != (uint16_t)BLOCK_MAGIC) {
+    __libc_free(ptr);   // Taken before the replacement was live (loader)
+    return;
+  }
+  if (h->tracked) {
+    benchHeap.frees.fetch_add(1, std::memory_order_relaxed);
+    benchHeap.live.fetch_sub(h->size, std::memory_order_relaxed);
+  }
+  h->magic = 0;
+  __libc_free((char*)ptr - h->offset);
+}
+
+}  // namespace
+
+extern "C" {
+
+void* malloc(size_t size) { return allocBlock(BLOCK_HEADER, size); }
+
+void free(void* ptr) {
+  if (ptr) freeBlock(ptr);
+}
+
+void* calloc(size_t count, size_t size) {
+  if (size && count > SIZE_MAX / size) return nullptr;
+  void* ptr = allocBlock(BLOCK_HEADER, count * size);
+  if (ptr) memset(ptr, 0, count * size);
+  return ptr;
+}
+
+// Always moves: a realloc on the device is an allocation too, and
+// String growth is one of the things worth counting
+void* realloc(void* ptr, size_t size) {
+  if (!ptr) return malloc(size);
+  if (size == 0) {
+    free(ptr);
+    return nullptr;
+  }
+  void* moved = malloc(size);
+  if (!moved) return nullptr;
+  size_t old = headerOf(ptr)->size;
+  memcpy(moved, ptr, old < size ? old : size);
+  free(ptr);
+  return moved;
+}
+
+void* memalign(size_t align, size_t size) { return allocBlock(align, size); }
+void* aligned_alloc(size_t align, size_t size) { return allocBlock(align, size); }
+void* valloc(size_t size) { return allocBlock(4096, size); }
+void* pvalloc(size_t size) { return allocBlock(4096, (size + 4095) & ~(size_t)4095); }
+
+int posix_memalign(void** out, size_t align, size_t size) {
+  void* ptr = allocBlock(align, size);
+  if (!ptr) return ENOMEM;
+  *out = ptr;
+  return 0;
+}
+
+size_t malloc_usable_size(void* ptr) { return ptr ? headerOf(ptr)->size : 0; }
+
+}  // extern "C"
+
+// ===========================================
+// SKETCH
+// ===========================================
+// The port comes from the environment: the server object is constructed
+// before main() sees the command line
+
+static uint16_t benchPort() {
+  const char* port = getenv("WEB_BENCH_PORT");
+  return port && *port ? (uint16_t)atoi(port) : 18080;
+}
+
+#include "config.h"
+#undef HTTP_PORT
+#define HTTP_PORT benchPort()
+
+#include "InternetMonitor.ino"
+
+// ===========================================
+// OPTIONS
+// ===========================================
+
+struct BenchOptions {
+  int clients = HTTP_MAX_CLIENTS;
+  int seconds = 10;
+  int repeat = 50;
+  const char* password = "admin";
+  const char* jsonPath = nullptr;
+  bool profile = true;
+  bool load = true;
+  std::vector<std::string> mixes;
+};
+
+static void usage() {
+  fprintf(stderr,
+          "usage: web_bench [options] MIX...\n"
+          "  --clients N    concurrent connections in the load pass (default %d)\n"
+          "  --seconds S    load pass length (default 10)\n"
+          "  --repeat N     requests per mix line in the profile pass (default 50)\n"
+          "  --password P   web password (default admin)\n"
+          "  --json FILE    also write the results as JSON\n"
+          "  --no-profile / --no-load   skip a pass\n"
+          "  --verbose      echo the sketch's Serial output to stderr\n"
+          "The port is WEB_BENCH_PORT (default 18080). Exit status: 0 ok, 1 unexpected\n"
+          "or failed replies (report still written), 2 setup error.\n",
+          HTTP_MAX_CLIENTS);
+}
+
+static bool parseOptions(int argc, char** argv, BenchOptions& opt) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (a == "--clients" && hasValue) opt.clients = atoi(argv[++i]);
+    else if (a == "--seconds" && hasValue) opt.seconds = atoi(argv[++i]);
+    else if (a == "--repeat" && hasValue) opt.repeat = atoi(argv[++i]);
+    else if (a == "--password" && hasValue) opt.password = argv[++i];
+    else if (a == "--json" && hasValue) opt.jsonPath = argv[++i];
+    else if (a == "--no-profile") opt.profile = false;
+    else if (a == "--no-load") opt.load = false;
+    else if (a == "--verbose") benchSerialEcho = true;
+    else if (a.size() > 2 && a.compare(0, 2, "--") == 0) return false;
+    else opt.mixes.push_back(a);
+  }
+  return !opt.mixes.empty() && opt.clients > 0 && opt.seconds >= 0 && opt.repeat > 0;
+}
+
+// ===========================================
+// MIX FILES
+// ===========================================
+
+struct MixRequest {
+  std::string mix;       // File stem, e.g. "dashboard"
+  std::string method;
+  std::string path;
+  std::string body;
+  std::vector<std::string> headers;
+  int expect = 0;        // Expected status, 0: any 2xx or 304
+
+  bool expected(int status) const {
+    return expect ? status == expect : (status >= 200 && status < 300) || status == 304;
+  }
+  std::string label() const { return method + " " + path + (body.empty() ? "" : " " + body); }
+};
+
+static std::string trim(const std::string& s) {
+  size_t a = s.find_first_not_of(" \t\r");
+  size_t b = s.find_last_not_of(" \t\r");
+  return a == std::string::npos ? "" : s.substr(a, b - a + 1);
+}
+
+static std::string mixName(const std::string& path) {
+  size_t slash = path.find_last_of('/');
+  std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+  size_t dot = name.find_last_of('.');
+  return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+// A '*' in a path is filled from the asset table, so mixes survive a
+// rebuilt bundle with a new hash
+static std::string resolveAssetPath(const std::string& path) {
+  if (path.find('*') == std::string::npos) return path;
+  for (size_t i = 0; i < UI_ASSET_COUNT; i++) {
+    if (fnmatch(path.c_str(), uiAssets[i].path, 0) == 0) return uiAssets[i].path;
+  }
+  return path;
+}
+
+static std::string resolveEtag(const std::string& header, const std::string& path) {
+  size_t at = header.find("{etag}");
+  if (at == std::string::npos) return header;
+  for (size_t i = 0; i < UI_ASSET_COUNT; i++) {
+    if (path == uiAssets[i].path) return header.substr(0, at) + uiAssets[i].etag + header.substr(at + 6);
+  }
+  return header;
+}
+
+static bool loadMix(const std::string& file, std::vector<MixRequest>& out) {
+  std::ifstream in(file);
+  if (!in) {
+    fprintf(stderr, "can't read %s\n", file.c_str());
+    return false;
+  }
+
+  std::string line;
+  int lineNo = 0;
+  size_t first = out.size();
+  while (std::getline(in, line)) {
+    lineNo++;
+    bool indented = !line.empty() && (line[0] == ' ' || line[0] == '\t');
+    line = trim(line);
+    if (line.empty() || line[0] == '#') continue;
+
+    if (indented) {
+      if (out.size() == first) {
+        fprintf(stderr, "%s:%d: header before any request\n", file.c_str(), lineNo);
+        return false;
+      }
+      if (line[0] == '=') {
+        out.back().expect = atoi(line.c_str() + 1);
+        continue;
+      }
+      out.back().headers.push_back(resolveEtag(line, out.back().path));
+      continue;
+    }
+
+    MixRequest r;
+    r.mix = mixName(file);
+    size_t sp1 = line.find(' ');
+    if (sp1 == std::string::npos) {
+      fprintf(stderr, "%s:%d: expected METHOD PATH [BODY]\n", file.c_str(), lineNo);
+      return false;
+    }
+    size_t sp2 = line.find(' ', sp1 + 1);
+    r.method = line.substr(0, sp1);
+    r.path = resolveAssetPath(line.substr(sp1 + 1, sp2 == std::string::npos ? std::string::npos : sp2 - sp1 - 1));
+    if (sp2 != std::string::npos) r.body = trim(line.substr(sp2 + 1));
+    out.push_back(r);
+  }
+
+  if (out.size() == first) {
+    fprintf(stderr, "%s: no requests\n", file.c_str());
+    return false;
+  }
+  return true;
+}
+
+// ===========================================
+// CLIENT
+// ===========================================
+
+struct Reply {
+  int status = 0;          // 0: connect/read failed or response cut short
+  std::string head;        // Status line and headers
+  size_t bytes = 0;        // Whole response
+  uint32_t latencyUs = 0;  // Connect to EOF
+};
+
+static std::string buildRequest(const MixRequest& r, const std::string& cookie) {
+  std::string req = r.method + " " + r.path + " HTTP/1.1\r\nHost: bench\r\n";
+  if (!cookie.empty()) req += "Cookie: session=" + cookie + "\r\n";
+  for (const std::string& h : r.headers) req += h + "\r\n";
+  if (!r.body.empty() || r.method == "POST") {
+    req += r.body.size() && r.body[0] == '{' ? "Content-Type: application/json\r\n"
+                                             : "Content-Type: application/x-www-form-urlencoded\r\n";
+    req += "Content-Length: " + std::to_string(r.body.size()) + "\r\n";
+  }
+  req += "Connection: close\r\n\r\n" + r.body;
+  return req;
+}
+
+// One request on its own connection; the server always closes after
+// the response, so the reply ends at EOF
+static Reply sendRequest(const std::string& req) {
+  Reply reply;
+  auto start = std::chrono::steady_clock::now();
+
+  int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0) return reply;
+  struct timeval tv = {5, 0};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(benchPort());
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+      send(fd, req.data(), req.size(), MSG_NOSIGNAL) != (ssize_t)req.size()) {
+    close(fd);
+    return reply;
+  }
+
+  char buf[4096];
+  std::string head;
+  bool headDone = false;
+  ssize_t n;
+  while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) {
+    reply.bytes += n;
+    if (!headDone) {
+      head.append(buf, n);
+      size_t end = head.find("\r\n\r\n");
+      if (end != std::string::npos) {
+        head.resize(end);
+        headDone = true;
+      }
+    }
+  }
+  close(fd);
+
+  reply.latencyUs = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+  if (n != 0 || !headDone || head.compare(0, 5, "HTTP/") != 0) return reply;
+
+  // A body shorter than Content-Length is a cut-off response, not a reply
+  std::string lower = head;
+  std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+  size_t length = lower.find("\r\ncontent-length:");
+  if (length != std::string::npos &&
+      reply.bytes - head.size() - 4 < strtoul(head.c_str() + length + 17, nullptr, 10)) {
+    return reply;
+  }
+  reply.status = atoi(head.c_str() + head.find(' ') + 1);
+  reply.head = head;
+  return reply;
+}
+
+static bool waitForServer() {
+  MixRequest probe = {"", "GET", "/logout", "", {}};
+  for (int i = 0; i < 100; i++) {
+    if (sendRequest(buildRequest(probe, "")).status) return true;
+    delay(50);
+  }
+  return false;
+}
+
+// Up to MAX_SESSIONS logins, so concurrent clients don't all share one
+static std::vector<std::string> login(const char* password, int count) {
+  std::vector<std::string> tokens;
+  MixRequest req = {"", "POST", "/login", std::string("password=") + password, {}};
+  for (int i = 0; i < count && i < MAX_SESSIONS; i++) {
+    Reply r = sendRequest(buildRequest(req, ""));
+    size_t at = r.head.find("session=");
+    if (r.status != 200 || at == std::string::npos) break;
+    at += strlen("session=");
+    tokens.push_back(r.head.substr(at, r.head.find(';', at) - at));
+  }
+  return tokens;
+}
+
+// ===========================================
+// SKETCH STATE
+// ===========================================
+
+// The boot path of setup() that the web task depends on, without
+// WiFi, the LED task or the network and MQTT tasks
+static void benchSetup(const char* password) {
+  stats.bootTime = millis();
+  initLookupTables();
+
+  loadSettingsFromNVS();
+  loadMQTTConfigFromNVS();
+  loadProbeConfigFromNVS();
+  loadThroughputConfigFromNVS();
+  loadClockConfigFromNVS();
+  loadMetricsConfigFromNVS();
+  loadTaskLayoutFromNVS();
+  initHistory();
+  initOutageLog();
+  publishRenderParams();
+
+  loadCredentialsFromNVS();
+  storedWebPasswordHash = sha256(password);
+  changeState(STATE_INTERNET_OK);
+
+  // An hour of checks, so /stats and /history have something to format
+  for (int i = 0; i < 720; i++) {
+    bool ok = i % 97 != 0;
+    stats.totalChecks++;
+    if (ok) stats.successfulChecks++;
+    else stats.failedChecks++;
+    historyRecord(ok, 18 + i % 23);
+  }
+  stats.consecutiveSuccesses = 42;
+
+  setupWebServer();
+}
+
+// ===========================================
+// STATISTICS
+// ===========================================
+
+static double percentile(std::vector<uint32_t>& sorted, double pct) {
+  if (sorted.empty()) return 0;
+  size_t i = (size_t)(pct / 100.0 * (sorted.size() - 1) + 0.5);
+  return sorted[std::min(i, sorted.size() - 1)] / 1000.0;
+}
+
+struct HeapSnapshot {
+  uint64_t allocs, frees, bytes;
+  int64_t live;
+};
+
+static HeapSnapshot heapNow() {
+  return {benchHeap.allocs.load(), benchHeap.frees.load(), benchHeap.bytes.load(), benchHeap.live.load()};
+}
+
+static void resetHeapExtremes() {
+  int64_t live = benchHeap.live.load();
+  benchHeap.peak = live;
+  benchHeap.minFree = BENCH_HEAP_SIZE - live;
+  benchHeap.largest = 0;
+}
+
+// Output blocks and closing sockets are released just after the client
+// sees EOF; give the web task one poll to finish before reading totals
+static void settle() { delay(HTTP_POLL_MS + 5); }
+
+// ===========================================
+// PROFILE PASS
+// ===========================================
+
+struct ProfileRow {
+  const MixRequest* req;
+  int status;
+  size_t responseBytes;
+  double allocsPerReq;
+  double bytesPerReq;
+  int64_t retained;        // Live bytes left after the run
+  double p50Ms;
+  int unexpected;          // Replies with another status (or none)
+};
+
+static std::vector<ProfileRow> runProfile(const std::vector<MixRequest>& mix,
+                                          const std::string& cookie, int repeat) {
+  std::vector<ProfileRow> rows;
+  for (const MixRequest& r : mix) {
+    std::string req = buildRequest(r, cookie);
+    sendRequest(req);   // Warm-up: first-use buffers, lazily built state
+    settle();
+
+    HeapSnapshot before = heapNow();
+    std::vector<uint32_t> latency;
+    Reply last;
+    int unexpected = 0;
+    for (int i = 0; i < repeat; i++) {
+      last = sendRequest(req);
+      latency.push_back(last.latencyUs);
+      if (!r.expected(last.status)) unexpected++;
+    }
+    settle();
+    HeapSnapshot after = heapNow();
+
+    std::sort(latency.begin(), latency.end());
+    rows.push_back({&r, last.status, last.bytes,
+                    (double)(after.allocs - before.allocs) / repeat,
+                    (double)(after.bytes - before.bytes) / repeat,
+                    after.live - before.live, percentile(latency, 50), unexpected});
+  }
+  return rows;
+}
+
+static void printProfile(const std::vector<ProfileRow>& rows) {
+  printf("\nProfile (sequential, per request)\n");
+  printf("  %-44s %6s %8s %8s %10s %9s %8s\n", "request", "status", "bytes", "allocs", "heap B", "retained", "p50 ms");
+  std::string mix;
+  for (const ProfileRow& row : rows) {
+    if (row.req->mix != mix) {
+      mix = row.req->mix;
+      printf("  [%s]\n", mix.c_str());
+    }
+    std::string label = row.req->label();
+    if (label.size() > 44) label = label.substr(0, 41) + "...";
+    printf("  %-44s %6d %8zu %8.1f %10.0f %9lld %8.2f%s\n", label.c_str(), row.status, row.responseBytes,
+           row.allocsPerReq, row.bytesPerReq, (long long)row.retained, row.p50Ms,
+           row.unexpected ? "  <- unexpected status" : "");
+  }
+}
+
+// ===========================================
+// LOAD PASS
+// ===========================================
+
+struct LoadResult {
+  int clients;
+  double seconds;
+  uint64_t requests;
+  uint64_t errors;
+  uint64_t unexpected;     // Answered, but not with the line's expected status
+  std::map<int, uint64_t> statuses;
+  double p50Ms, p90Ms, p99Ms, maxMs;
+  double allocsPerReq, bytesPerReq;
+  int64_t peakLive;
+  int64_t minFree;
+  uint64_t largest;
+  uint32_t dropped, rejected, outAllocs;
+  uint8_t peakActive;
+};
+
+static LoadResult runLoad(const std::vector<MixRequest>& mix, const std::vector<std::string>& cookies,
+                          int clients, int seconds) {
+  std::vector<std::vector<std::string>> requests(clients);
+  for (int c = 0; c < clients; c++) {
+    for (const MixRequest& r : mix) requests[c].push_back(buildRequest(r, cookies[c % cookies.size()]));
+  }
+
+  std::vector<std::vector<uint32_t>> latency(clients);
+  std::vector<std::map<int, uint64_t>> statuses(clients);
+  std::vector<uint64_t> unexpected(clients);
+  std::atomic<bool> stop{false};
+
+  settle();
+  HttpMetrics m0 = server.metrics();
+  HeapSnapshot before = heapNow();
+  resetHeapExtremes();
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  for (int c = 0; c < clients; c++) {
+    threads.emplace_back([&, c]() {
+      // Each client walks the whole mix, starting at a different line
+      size_t i = c * mix.size() / clients;
+      while (!stop.load(std::memory_order_relaxed)) {
+        Reply r = sendRequest(requests[c][i]);
+        if (r.status && !mix[i].expected(r.status)) unexpected[c]++;
+        i = (i + 1) % mix.size();
+        statuses[c][r.status]++;
+        if (r.status) latency[c].push_back(r.latencyUs);
+      }
+    });
+  }
+
+  std::this_thread::sleep_for(std::chrono::seconds(seconds));
+  stop = true;
+  for (std::thread& t : threads) t.join();
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  settle();
+  HeapSnapshot after = heapNow();
+  HttpMetrics m1 = server.metrics();
+
+  LoadResult res = {};
+  res.clients = clients;
+  res.seconds = elapsed;
+  std::vector<uint32_t> all;
+  for (int c = 0; c < clients; c++) {
+    all.insert(all.end(), latency[c].begin(), latency[c].end());
+    res.unexpected += unexpected[c];
+    for (const auto& s : statuses[c]) {
+      if (s.first == 0) res.errors += s.second;
+      else res.statuses[s.first] += s.second;
+    }
+  }
+  std::sort(all.begin(), all.end());
+  res.requests = all.size();
+  res.p50Ms = percentile(all, 50);
+  res.p90Ms = percentile(all, 90);
+  res.p99Ms = percentile(all, 99);
+  res.maxMs = all.empty() ? 0 : all.back() / 1000.0;
+
+  uint64_t n = res.requests ? res.requests : 1;
+  res.allocsPerReq = (double)(after.allocs - before.allocs) / n;
+  res.bytesPerReq = (double)(after.bytes - before.bytes) / n;
+  res.peakLive = benchHeap.peak.load();
+  res.minFree = benchHeap.minFree.load();
+  res.largest = benchHeap.largest.load();
+  res.dropped = m1.dropped - m0.dropped;
+  res.rejected = m1.rejected - m0.rejected;
+  res.outAllocs = m1.outAllocs - m0.outAllocs;
+  res.peakActive = m1.peakActive;
+  return res;
+}
+
+static void printLoad(const LoadResult& r) {
+  printf("\nLoad (%d clients, %.1f s)\n", r.clients, r.seconds);
+  printf("  requests     %llu (%.0f/s), %llu failed, %llu unexpected status\n", (unsigned long long)r.requests,
+         r.requests / r.seconds, (unsigned long long)r.errors, (unsigned long long)r.unexpected);
+  printf("  status      ");
+  for (const auto& s : r.statuses) printf(" %d x%llu", s.first, (unsigned long long)s.second);
+  printf("\n");
+  printf("  latency ms   p50 %.2f  p90 %.2f  p99 %.2f  max %.2f\n", r.p50Ms, r.p90Ms, r.p99Ms, r.maxMs);
+  printf("  heap         %.1f allocs, %.0f bytes per request\n", r.allocsPerReq, r.bytesPerReq);
+  printf("               peak %lld B live, min free %lld of %d, largest block %llu B\n",
+         (long long)r.peakLive, (long long)r.minFree, BENCH_HEAP_SIZE, (unsigned long long)r.largest);
+  printf("  server       dropped %u, rejected %u, pool misses %u, peak connections %u/%d\n",
+         r.dropped, r.rejected, r.outAllocs, r.peakActive, HTTP_MAX_CLIENTS);
+}
+
+// ===========================================
+// JSON REPORT
+// ===========================================
+
+static std::string jsonString(const std::string& s) {
+  std::string out = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') out += '\\';
+    if ((unsigned char)c < 0x20) continue;
+    out += c;
+  }
+  return out + "\"";
+}
+
+static bool writeJson(const char* path, const std::vector<ProfileRow>& rows, const LoadResult* load) {
+  FILE* f = fopen(path, "w");
+  if (!f) {
+    fprintf(stderr, "can't write %s\n", path);
+    return false;
+  }
+
+  fprintf(f, "{\n  \"heap_size\": %d,\n  \"profile\": [", BENCH_HEAP_SIZE);
+  for (size_t i = 0; i < rows.size(); i++) {
+    const ProfileRow& r = rows[i];
+    fprintf(f, "%s\n    {\"mix\": %s, \"request\": %s, \"status\": %d, \"response_bytes\": %zu, "
+               "\"allocs_per_req\": %.2f, \"bytes_per_req\": %.1f, \"retained\": %lld, \"p50_ms\": %.3f, "
+               "\"unexpected\": %d}",
+            i ? "," : "", jsonString(r.req->mix).c_str(), jsonString(r.req->label()).c_str(), r.status,
+            r.responseBytes, r.allocsPerReq, r.bytesPerReq, (long long)r.retained, r.p50Ms, r.unexpected);
+  }
+  fprintf(f, "%s]", rows.empty() ? "" : "\n  ");
+
+  if (load) {
+    fprintf(f, ",\n  \"load\": {\"clients\": %d, \"seconds\": %.2f, \"requests\": %llu, \"errors\": %llu, "
+               "\"unexpected\": %llu, \"rps\": %.1f,\n    \"p50_ms\": %.3f, \"p90_ms\": %.3f, \"p99_ms\": %.3f, \"max_ms\": %.3f,\n"
+               "    \"allocs_per_req\": %.2f, \"bytes_per_req\": %.1f, \"peak_live\": %lld, \"min_free\": %lld, "
+               "\"largest_block\": %llu,\n    \"dropped\": %u, \"rejected\": %u, \"pool_misses\": %u, \"status\": {",
+            load->clients, load->seconds, (unsigned long long)load->requests, (unsigned long long)load->errors,
+            (unsigned long long)load->unexpected, load->requests / load->seconds, load->p50Ms, load->p90Ms, load->p99Ms, load->maxMs,
+            load->allocsPerReq, load->bytesPerReq, (long long)load->peakLive, (long long)load->minFree,
+            (unsigned long long)load->largest, load->dropped, load->rejected, load->outAllocs);
+    bool first = true;
+    for (const auto& s : load->statuses) {
+      fprintf(f, "%s\"%d\": %llu", first ? "" : ", ", s.first, (unsigned long long)s.second);
+      first = false;
+    }
+    fprintf(f, "}}");
+  }
+  fprintf(f, "\n}\n");
+  fclose(f);
+  return true;
+}
+
+// ===========================================
+// MAIN
+// ===========================================
+
+int main(int argc, char** argv) {
+  BenchOptions opt;
+  if (!parseOptions(argc, argv, opt)) {
+    usage();
+    return 2;
+  }
+
+  std::vector<MixRequest> mix;
+  for (const std::string& file : opt.mixes) {
+    if (!loadMix(file, mix)) return 2;
+  }
+
+  benchSetup(opt.password);
+  if (!waitForServer()) {
+    fprintf(stderr, "server not answering on port %u\n", benchPort());
+    return 2;
+  }
+  std::vector<std::string> cookies = login(opt.password, opt.clients);
+  if (cookies.empty()) {
+    fprintf(stderr, "login failed (wrong --password?)\n");
+    return 2;
+  }
+
+  printf("web_bench: %zu requests from %zu mix file(s), port %u\n", mix.size(), opt.mixes.size(), benchPort());
+
+  std::vector<ProfileRow> rows;
+  if (opt.profile) {
+    rows = runProfile(mix, cookies[0], opt.repeat);
+    printProfile(rows);
+  }
+
+  LoadResult load;
+  if (opt.load) {
+    load = runLoad(mix, cookies, opt.clients, opt.seconds);
+    printLoad(load);
+  }
+
+  if (opt.jsonPath && !writeJson(opt.jsonPath, rows, opt.load ? &load : nullptr)) return 2;
+
+  // A run that measured error paths isn't a measurement of the mix
+  uint64_t bad = opt.load ? load.errors + load.unexpected : 0;
+  for (const ProfileRow& row : rows) bad += row.unexpected;
+  if (bad) printf("\nFAIL: %llu replies failed or had an unexpected status\n", (unsigned long long)bad);
+
+  // The web task never returns; leave without running its destructors
+  fflush(stdout);
+  _exit(bad ? 1 : 0);
+}